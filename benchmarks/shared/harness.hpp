@@ -1,10 +1,13 @@
 #pragma once
 
 #include "inputs.hpp"
+#include "perf_counters.hpp"
 
 #include <benchmark/benchmark.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -25,6 +28,7 @@ namespace ccm::bench
 	void unary_fixed(benchmark::State& state, T value, Fn&& fn)
 	{
 		T const x = load_arg(value);
+		perf_scope const perf(state, 1);
 		for (auto _ : state) { benchmark::DoNotOptimize(fn(x)); }
 	}
 
@@ -33,6 +37,7 @@ namespace ccm::bench
 	{
 		T const x = load_arg(x_value);
 		T const y = load_arg(y_value);
+		perf_scope const perf(state, 1);
 		for (auto _ : state) { benchmark::DoNotOptimize(fn(x, y)); }
 	}
 
@@ -42,12 +47,14 @@ namespace ccm::bench
 		T const x = load_arg(x_value);
 		T const y = load_arg(y_value);
 		T const z = load_arg(z_value);
+		perf_scope const perf(state, 1);
 		for (auto _ : state) { benchmark::DoNotOptimize(fn(x, y, z)); }
 	}
 
 	template <typename T, typename Fn>
 	void unary_scalar(benchmark::State& state, Fn&& fn)
 	{
+		perf_scope const perf(state, 1);
 		for (auto _ : state) { benchmark::DoNotOptimize(fn(static_cast<T>(state.range(0)))); }
 		state.SetComplexityN(state.range(0));
 	}
@@ -55,6 +62,7 @@ namespace ccm::bench
 	template <typename Vec, typename Fn>
 	void unary_vector(benchmark::State& state, Fn&& fn, Vec const& inputs)
 	{
+		perf_scope const perf(state, static_cast<std::int64_t>(inputs.size()));
 		for (auto _ : state)
 		{
 			for (auto const& x : inputs) { benchmark::DoNotOptimize(fn(x)); }
@@ -67,6 +75,7 @@ namespace ccm::bench
 	{
 		T const x = static_cast<T>(state.range(0));
 		T const y = static_cast<T>(state.range(0));
+		perf_scope const perf(state, 1);
 		for (auto _ : state) { benchmark::DoNotOptimize(fn(x, y)); }
 		state.SetComplexityN(state.range(0));
 	}
@@ -77,6 +86,7 @@ namespace ccm::bench
 		T const x = static_cast<T>(state.range(0));
 		T const y = static_cast<T>(state.range(0));
 		T const z = static_cast<T>(state.range(0));
+		perf_scope const perf(state, 1);
 		for (auto _ : state) { benchmark::DoNotOptimize(fn(x, y, z)); }
 		state.SetComplexityN(state.range(0));
 	}
@@ -84,6 +94,7 @@ namespace ccm::bench
 	template <typename Fn, typename VecX, typename VecY, typename VecZ>
 	void ternary_vector(benchmark::State& state, Fn&& fn, VecX const& xs, VecY const& ys, VecZ const& zs)
 	{
+		perf_scope const perf(state, static_cast<std::int64_t>(xs.size()));
 		for (auto _ : state)
 		{
 			for (std::size_t i = 0; i < xs.size(); ++i) { benchmark::DoNotOptimize(fn(xs[i], ys[i], zs[i])); }
@@ -94,6 +105,7 @@ namespace ccm::bench
 	template <typename Fn, typename VecX, typename VecY>
 	void binary_vector(benchmark::State& state, Fn&& fn, VecX const& xs, VecY const& ys)
 	{
+		perf_scope const perf(state, static_cast<std::int64_t>(xs.size()));
 		for (auto _ : state)
 		{
 			for (std::size_t i = 0; i < xs.size(); ++i) { benchmark::DoNotOptimize(fn(xs[i], ys[i])); }
@@ -101,4 +113,126 @@ namespace ccm::bench
 		state.SetComplexityN(state.range(0));
 	}
 
+	// Throughput and latency modes. Throughput calls fn on independent inputs, so the core overlaps
+	// consecutive calls; latency feeds every result into the next input through chain(), so the loop
+	// time is the dependent-chain latency of fn plus an and, an or and two register moves. Both
+	// report items per second.
+	template <typename T>
+	using chain_bits = std::conditional_t<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>;
+
+	// x made data dependent on carry: carry's bits are or-ed in under a mask that is zero at run time
+	// but unknown to the compiler. Unlike x + 0 * carry, x stays intact for NaN and infinite carries.
+	template <typename T>
+	T chain(T x, T carry, chain_bits<T> mask)
+	{
+		static_assert(sizeof(T) == sizeof(chain_bits<T>), "chain() needs a float or double sized argument");
+		chain_bits<T> x_bits{};
+		chain_bits<T> carry_bits{};
+		std::memcpy(&x_bits, &x, sizeof(T));
+		std::memcpy(&carry_bits, &carry, sizeof(T));
+		x_bits |= carry_bits & mask;
+		std::memcpy(&x, &x_bits, sizeof(T));
+		return x;
+	}
+
+	template <typename T, typename Fn>
+	void unary_throughput(benchmark::State& state, Fn&& fn, std::vector<T> const& xs)
+	{
+		perf_scope const perf(state, static_cast<std::int64_t>(xs.size()));
+		for (auto _ : state)
+		{
+			for (T const& x : xs) { benchmark::DoNotOptimize(fn(x)); }
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(xs.size()));
+		state.SetComplexityN(state.range(0));
+	}
+
+	template <typename T, typename Fn>
+	void unary_latency(benchmark::State& state, Fn&& fn, std::vector<T> const& xs)
+	{
+		auto const mask = load_arg(chain_bits<T>{ 0 });
+		T carry{};
+		perf_scope const perf(state, static_cast<std::int64_t>(xs.size()));
+		for (auto _ : state)
+		{
+			for (T const& x : xs) { carry = fn(chain(x, carry, mask)); }
+			benchmark::DoNotOptimize(carry);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(xs.size()));
+		state.SetComplexityN(state.range(0));
+	}
+
+	template <typename T, typename Fn>
+	void binary_throughput(benchmark::State& state, Fn&& fn, std::vector<T> const& xs, std::vector<T> const& ys)
+	{
+		perf_scope const perf(state, static_cast<std::int64_t>(xs.size()));
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < xs.size(); ++i) { benchmark::DoNotOptimize(fn(xs[i], ys[i])); }
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(xs.size()));
+		state.SetComplexityN(state.range(0));
+	}
+
+	// The chain runs through the first argument.
+	template <typename T, typename Fn>
+	void binary_latency(benchmark::State& state, Fn&& fn, std::vector<T> const& xs, std::vector<T> const& ys)
+	{
+		auto const mask = load_arg(chain_bits<T>{ 0 });
+		T carry{};
+		perf_scope const perf(state, static_cast<std::int64_t>(xs.size()));
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < xs.size(); ++i) { carry = fn(chain(xs[i], carry, mask), ys[i]); }
+			benchmark::DoNotOptimize(carry);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(xs.size()));
+		state.SetComplexityN(state.range(0));
+	}
+
+	template <typename T, typename Fn>
+	void ternary_throughput(benchmark::State& state, Fn&& fn, std::vector<T> const& xs, std::vector<T> const& ys, std::vector<T> const& zs)
+	{
+		perf_scope const perf(state, static_cast<std::int64_t>(xs.size()));
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < xs.size(); ++i) { benchmark::DoNotOptimize(fn(xs[i], ys[i], zs[i])); }
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(xs.size()));
+		state.SetComplexityN(state.range(0));
+	}
+
+	// The chain runs through the first argument.
+	template <typename T, typename Fn>
+	void ternary_latency(benchmark::State& state, Fn&& fn, std::vector<T> const& xs, std::vector<T> const& ys, std::vector<T> const& zs)
+	{
+		auto const mask = load_arg(chain_bits<T>{ 0 });
+		T carry{};
+		perf_scope const perf(state, static_cast<std::int64_t>(xs.size()));
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < xs.size(); ++i) { carry = fn(chain(xs[i], carry, mask), ys[i], zs[i]); }
+			benchmark::DoNotOptimize(carry);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(xs.size()));
+		state.SetComplexityN(state.range(0));
+	}
+
+	// Batch mode: fn(in, out, count) over the whole input set once per iteration, as the ccm::batch
+	// entry points take it. Reports an elements counter as a rate, i.e. elements per second.
+	template <typename T, typename Fn>
+	void unary_batch(benchmark::State& state, Fn&& fn, std::vector<T> const& xs)
+	{
+		std::vector<T> out(xs.size());
+		perf_scope const perf(state, static_cast<std::int64_t>(xs.size()));
+		for (auto _ : state)
+		{
+			fn(xs.data(), out.data(), xs.size());
+			benchmark::DoNotOptimize(out.data());
+			benchmark::ClobberMemory();
+		}
+		state.counters["elements"] = benchmark::Counter(static_cast<double>(state.iterations()) * static_cast<double>(xs.size()), benchmark::Counter::kIsRate);
+		state.SetComplexityN(state.range(0));
+	}
+
 } // namespace ccm::bench
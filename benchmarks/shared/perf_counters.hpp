@@ -0,0 +1,218 @@
+#pragma once
+
+// Optional hardware counters for the harness loops. With CCM_BENCH_PERF=1 in the environment on
+// Linux, every harness driver counts cycles, instructions, branch misses and L1D read misses of
+// its timed loop through perf_event_open and reports them per element as Google Benchmark
+// counters. Events the kernel refuses (perf_event_paranoid, containers, VMs without a PMU) are
+// left out; when none opens the benchmark is labelled instead. -DCCM_BM_CONFIG_NO_PERF, or any
+// other platform, compiles the counters out.
+//
+// A ccmath built with CCM_CONFIG_ENABLE_PATH_STATS (CCMATH_ENABLE_PATH_STATS) also gets the kernel
+// path hits of each loop, per element, as path.<name> counters, e.g. path.pow.double_double=1.
+//
+// In a multi-threaded benchmark every thread counts its own events and the counters report the
+// per-element average over threads. The path counters are process-wide, so thread 0 resets and
+// reports them for the elements of all threads.
+
+#include <benchmark/benchmark.h>
+
+#include <ccmath/math/misc/path_stats.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#if defined(__linux__) && !defined(CCM_BM_CONFIG_NO_PERF)
+	#include <linux/perf_event.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+
+	#define CCMATH_BENCH_HAS_PERF 1
+#else
+	#define CCMATH_BENCH_HAS_PERF 0
+#endif
+
+namespace ccm::bench
+{
+	inline bool perf_requested()
+	{
+		static bool const requested = []
+		{
+			char const* value = std::getenv("CCM_BENCH_PERF");
+			return value != nullptr && value[0] != '\0' && value[0] != '0';
+		}();
+		return requested;
+	}
+
+	class perf_counters
+	{
+	public:
+		enum event : std::size_t
+		{
+			cycles,
+			instructions,
+			branch_misses,
+			l1d_misses,
+			event_count,
+		};
+
+		perf_counters()
+		{
+#if CCMATH_BENCH_HAS_PERF
+			if (!perf_requested()) { return; }
+			constexpr std::uint64_t l1d_read_miss =
+				PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8U) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+			m_fd[cycles]		= open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+			m_fd[instructions]	= open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+			m_fd[branch_misses] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+			m_fd[l1d_misses]	= open(PERF_TYPE_HW_CACHE, l1d_read_miss);
+#endif
+		}
+
+		~perf_counters()
+		{
+#if CCMATH_BENCH_HAS_PERF
+			for (int fd : m_fd)
+			{
+				if (fd >= 0) { ::close(fd); }
+			}
+#endif
+		}
+
+		perf_counters(perf_counters const&)	= delete;
+		perf_counters& operator				=(perf_counters const&) = delete;
+
+		[[nodiscard]] bool any_open() const
+		{
+			for (int fd : m_fd)
+			{
+				if (fd >= 0) { return true; }
+			}
+			return false;
+		}
+
+		void start()
+		{
+#if CCMATH_BENCH_HAS_PERF
+			for (int fd : m_fd)
+			{
+				if (fd < 0) { continue; }
+				::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+				::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+			}
+#endif
+		}
+
+		// Stops the counters and reads them; multiplexed events are scaled to the whole interval from
+		// their enabled and running times.
+		void stop()
+		{
+#if CCMATH_BENCH_HAS_PERF
+			for (std::size_t e = 0; e < event_count; ++e)
+			{
+				m_valid[e] = false;
+				if (m_fd[e] < 0) { continue; }
+				::ioctl(m_fd[e], PERF_EVENT_IOC_DISABLE, 0);
+				std::uint64_t sample[3] = {}; // value, time enabled, time running
+				if (::read(m_fd[e], sample, sizeof(sample)) != static_cast<ssize_t>(sizeof(sample)) || sample[2] == 0) { continue; }
+				m_value[e] = static_cast<double>(sample[0]) * static_cast<double>(sample[1]) / static_cast<double>(sample[2]);
+				m_valid[e] = true;
+			}
+#endif
+		}
+
+		[[nodiscard]] bool valid(event e) const { return m_valid[e]; }
+		[[nodiscard]] double value(event e) const { return m_value[e]; }
+
+	private:
+#if CCMATH_BENCH_HAS_PERF
+		static int open(std::uint32_t type, std::uint64_t config)
+		{
+			perf_event_attr attr{};
+			attr.size			= sizeof(attr);
+			attr.type			= type;
+			attr.config			= config;
+			attr.disabled		= 1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv		= 1;
+			attr.read_format	= PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+		}
+#endif
+
+		int m_fd[event_count]		= { -1, -1, -1, -1 };
+		double m_value[event_count]	= {};
+		bool m_valid[event_count]	= {};
+	};
+
+	// Counts one run of a harness loop, from construction to destruction, and reports the events per
+	// element: cycles_per_op, instructions_per_op, ipc, branch_misses_per_op and l1d_misses_per_op.
+	// Path-stats builds add one path.<name> counter per kernel path the loop hit.
+	class perf_scope
+	{
+	public:
+		perf_scope(benchmark::State& state, std::int64_t items_per_iteration) : m_state{ state }, m_items{ items_per_iteration }
+		{
+			if constexpr (ccm::path_stats::enabled)
+			{
+				if (state.thread_index() == 0) { ccm::path_stats::reset(); }
+			}
+			if (!perf_requested()) { return; }
+			if (!m_counters.any_open())
+			{
+				state.SetLabel("perf counters unavailable");
+				return;
+			}
+			m_counters.start();
+		}
+
+		~perf_scope()
+		{
+			if constexpr (ccm::path_stats::enabled)
+			{
+				if (m_state.thread_index() == 0) { report_paths(); }
+			}
+			if (!m_counters.any_open()) { return; }
+			m_counters.stop();
+			double const ops = static_cast<double>(m_state.iterations()) * static_cast<double>(m_items);
+			if (ops <= 0.0) { return; }
+			report("cycles_per_op", perf_counters::cycles, ops);
+			report("instructions_per_op", perf_counters::instructions, ops);
+			report("branch_misses_per_op", perf_counters::branch_misses, ops);
+			report("l1d_misses_per_op", perf_counters::l1d_misses, ops);
+			if (m_counters.valid(perf_counters::cycles) && m_counters.valid(perf_counters::instructions) && m_counters.value(perf_counters::cycles) > 0.0)
+			{
+				m_state.counters["ipc"] =
+					benchmark::Counter(m_counters.value(perf_counters::instructions) / m_counters.value(perf_counters::cycles), benchmark::Counter::kAvgThreads);
+			}
+		}
+
+		perf_scope(perf_scope const&) = delete;
+		perf_scope& operator		  =(perf_scope const&) = delete;
+
+	private:
+		void report_paths()
+		{
+			double const ops = static_cast<double>(m_state.iterations()) * static_cast<double>(m_items) * static_cast<double>(m_state.threads());
+			if (ops <= 0.0) { return; }
+			auto const hits = ccm::path_stats::snapshot();
+			for (std::size_t i = 0; i < ccm::path_stats::path_count; ++i)
+			{
+				if (hits.hits[i] == 0) { continue; }
+				auto const p = static_cast<ccm::path_stats::path>(i);
+				m_state.counters[std::string("path.") + ccm::path_stats::name(p)] = static_cast<double>(hits.hits[i]) / ops;
+			}
+		}
+
+		void report(char const* name, perf_counters::event e, double ops)
+		{
+			if (m_counters.valid(e)) { m_state.counters[name] = benchmark::Counter(m_counters.value(e) / ops, benchmark::Counter::kAvgThreads); }
+		}
+
+		benchmark::State& m_state;
+		std::int64_t m_items;
+		perf_counters m_counters;
+	};
+} // namespace ccm::bench
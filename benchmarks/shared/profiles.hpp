@@ -0,0 +1,165 @@
+#pragma once
+
+// Input streams for the regimes named in tools/asmlab/registry/benchmark_profiles.json. The
+// benchmark build turns each profile's "inputs" object and the path_mix weights into
+// bench_profiles.gen.hpp; a profile stream draws every element from one profile, and a mix stream
+// draws the profile of each element by the weights listed for the function.
+
+#include "harness.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace ccm::bench
+{
+	enum class dist_kind : std::uint8_t
+	{
+		uniform,	 // uniform on [min, max)
+		log_uniform, // uniform exponent: 2^u with u uniform on [log2(min), log2(max))
+		integer,	 // uniform integer on [min, max]
+		choice,		 // uniform pick among values
+	};
+
+	struct dist_spec
+	{
+		dist_kind kind;
+		double min;
+		double max;
+		double values[8];
+		int value_count;
+	};
+
+	struct profile_spec
+	{
+		char const* name;
+		bool latency; // mode_default is latency
+		dist_spec x;
+		dist_spec y;
+	};
+
+	struct mix_entry
+	{
+		char const* function;
+		char const* profile;
+		double weight;
+	};
+} // namespace ccm::bench
+
+#include "bench_profiles.gen.hpp"
+
+namespace ccm::bench
+{
+	inline profile_spec const* find_profile(char const* name)
+	{
+		for (profile_spec const& p : k_profiles)
+		{
+			if (std::strcmp(p.name, name) == 0) { return &p; }
+		}
+		return nullptr;
+	}
+
+	inline double draw(std::mt19937& gen, dist_spec const& d)
+	{
+		switch (d.kind)
+		{
+		case dist_kind::uniform: return std::uniform_real_distribution<double>(d.min, d.max)(gen);
+		case dist_kind::log_uniform: return std::exp2(std::uniform_real_distribution<double>(std::log2(d.min), std::log2(d.max))(gen));
+		case dist_kind::integer:
+			return static_cast<double>(std::uniform_int_distribution<std::int64_t>(static_cast<std::int64_t>(d.min), static_cast<std::int64_t>(d.max))(gen));
+		case dist_kind::choice: return d.values[std::uniform_int_distribution<int>(0, d.value_count - 1)(gen)];
+		}
+		return 0.0;
+	}
+
+	struct profile_inputs
+	{
+		std::vector<double> xs;
+		std::vector<double> ys;
+		bool latency = false;
+	};
+
+	// count (x, y) pairs from one profile; empty when the profile is unknown.
+	inline profile_inputs profile_stream(std::int64_t count, char const* profile, std::uint_fast32_t seed = 937162211)
+	{
+		profile_inputs out;
+		profile_spec const* p = find_profile(profile);
+		if (p == nullptr) { return out; }
+		std::mt19937 gen(seed);
+		out.latency = p->latency;
+		out.xs.reserve(static_cast<std::size_t>(count));
+		out.ys.reserve(static_cast<std::size_t>(count));
+		for (std::int64_t i = 0; i < count; ++i)
+		{
+			out.xs.push_back(draw(gen, p->x));
+			out.ys.push_back(draw(gen, p->y));
+		}
+		return out;
+	}
+
+	// count (x, y) pairs whose profiles follow the path_mix weights of function; empty when it has none.
+	// Each pair comes from a single profile, so binary functions see the argument combinations it names.
+	inline profile_inputs mix_stream(std::int64_t count, char const* function, std::uint_fast32_t seed = 937162211)
+	{
+		profile_inputs out;
+		std::vector<profile_spec const*> profiles;
+		std::vector<double> weights;
+		for (mix_entry const& m : k_path_mix)
+		{
+			if (m.function == nullptr || std::strcmp(m.function, function) != 0) { continue; }
+			profile_spec const* p = find_profile(m.profile);
+			if (p == nullptr) { continue; }
+			profiles.push_back(p);
+			weights.push_back(m.weight);
+		}
+		if (profiles.empty()) { return out; }
+
+		std::mt19937 gen(seed);
+		std::discrete_distribution<std::size_t> pick(weights.begin(), weights.end());
+		out.xs.reserve(static_cast<std::size_t>(count));
+		out.ys.reserve(static_cast<std::size_t>(count));
+		for (std::int64_t i = 0; i < count; ++i)
+		{
+			profile_spec const* p = profiles[pick(gen)];
+			out.xs.push_back(draw(gen, p->x));
+			out.ys.push_back(draw(gen, p->y));
+		}
+		return out;
+	}
+
+	// fn over a profile or mix stream, in the profile's mode_default; mix streams run as throughput.
+	template <typename Fn>
+	void unary_stream(benchmark::State& state, Fn&& fn, profile_inputs const& in)
+	{
+		if (in.xs.empty())
+		{
+			state.SkipWithError("no such benchmark profile or path mix");
+			return;
+		}
+		if (in.latency) { unary_latency(state, fn, in.xs); }
+		else
+		{
+			unary_throughput(state, fn, in.xs);
+		}
+	}
+
+	template <typename Fn>
+	void binary_stream(benchmark::State& state, Fn&& fn, profile_inputs const& in)
+	{
+		if (in.xs.empty())
+		{
+			state.SkipWithError("no such benchmark profile or path mix");
+			return;
+		}
+		if (in.latency) { binary_latency(state, fn, in.xs, in.ys); }
+		else
+		{
+			binary_throughput(state, fn, in.xs, in.ys);
+		}
+	}
+} // namespace ccm::bench
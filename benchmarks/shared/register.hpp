@@ -2,9 +2,11 @@
 
 #include "harness.hpp"
 #include "paths.hpp"
+#include "profiles.hpp"
 
 #include <benchmark/benchmark.h>
 
+#include <cstddef>
 #include <cstdint>
 
 #define CCMATH_BENCH_APPLY_RANGE ->RangeMultiplier(2)->Range(ccm::bench::kRangeMin, ccm::bench::kRangeMax)->Complexity()
@@ -207,3 +209,218 @@
 	CCMATH_BENCH_DECLARE_TERNARY_SUITE(Module, Name, , StdBody, CcmBody)
 
 #define CCMATH_BENCH_REGISTER_TERNARY_COMPARE(Module, Name) CCMATH_BENCH_REGISTER_TERNARY_SUITE(Module, Name, )
+
+// Latency and throughput modes over random doubles, see harness.hpp. The latency bodies see x
+// already carrying the previous result, so they are written like the COMPARE ones.
+#define CCMATH_BENCH_DECLARE_UNARY_LATENCY_SUITE(Module, Name, Suffix, StdBody, CcmBody)                                                                       \
+	static void BM_##Module##_##Name##_std##Suffix##_latency(benchmark::State& state)                                                                          \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::unary_latency(state, [&](double x) { StdBody; }, xs);                                                                                      \
+	}                                                                                                                                                          \
+	static void BM_##Module##_##Name##_ccm##Suffix##_latency(benchmark::State& state)                                                                          \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::unary_latency(state, [&](double x) { CcmBody; }, xs);                                                                                      \
+	}
+
+#define CCMATH_BENCH_REGISTER_UNARY_LATENCY_SUITE(Module, Name, Suffix)                                                                                        \
+	BENCHMARK(BM_##Module##_##Name##_std##Suffix##_latency) CCMATH_BENCH_APPLY_RANGE;                                                                          \
+	BENCHMARK(BM_##Module##_##Name##_ccm##Suffix##_latency) CCMATH_BENCH_APPLY_RANGE;
+
+#define CCMATH_BENCH_DECLARE_UNARY_THROUGHPUT_SUITE(Module, Name, Suffix, StdBody, CcmBody)                                                                    \
+	static void BM_##Module##_##Name##_std##Suffix##_throughput(benchmark::State& state)                                                                       \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::unary_throughput(state, [&](double x) { StdBody; }, xs);                                                                                   \
+	}                                                                                                                                                          \
+	static void BM_##Module##_##Name##_ccm##Suffix##_throughput(benchmark::State& state)                                                                       \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::unary_throughput(state, [&](double x) { CcmBody; }, xs);                                                                                   \
+	}
+
+#define CCMATH_BENCH_REGISTER_UNARY_THROUGHPUT_SUITE(Module, Name, Suffix)                                                                                     \
+	BENCHMARK(BM_##Module##_##Name##_std##Suffix##_throughput) CCMATH_BENCH_APPLY_RANGE;                                                                       \
+	BENCHMARK(BM_##Module##_##Name##_ccm##Suffix##_throughput) CCMATH_BENCH_APPLY_RANGE;
+
+#define CCMATH_BENCH_DECLARE_BINARY_LATENCY_SUITE(Module, Name, Suffix, StdBody, CcmBody)                                                                      \
+	static void BM_##Module##_##Name##_std##Suffix##_latency(benchmark::State& state)                                                                          \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto ys = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::binary_latency(state, [&](double x, double y) { StdBody; }, xs, ys);                                                                       \
+	}                                                                                                                                                          \
+	static void BM_##Module##_##Name##_ccm##Suffix##_latency(benchmark::State& state)                                                                          \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto ys = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::binary_latency(state, [&](double x, double y) { CcmBody; }, xs, ys);                                                                       \
+	}
+
+#define CCMATH_BENCH_REGISTER_BINARY_LATENCY_SUITE(Module, Name, Suffix)                                                                                       \
+	BENCHMARK(BM_##Module##_##Name##_std##Suffix##_latency) CCMATH_BENCH_APPLY_RANGE;                                                                          \
+	BENCHMARK(BM_##Module##_##Name##_ccm##Suffix##_latency) CCMATH_BENCH_APPLY_RANGE;
+
+#define CCMATH_BENCH_DECLARE_BINARY_THROUGHPUT_SUITE(Module, Name, Suffix, StdBody, CcmBody)                                                                   \
+	static void BM_##Module##_##Name##_std##Suffix##_throughput(benchmark::State& state)                                                                       \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto ys = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::binary_throughput(state, [&](double x, double y) { StdBody; }, xs, ys);                                                                    \
+	}                                                                                                                                                          \
+	static void BM_##Module##_##Name##_ccm##Suffix##_throughput(benchmark::State& state)                                                                       \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto ys = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::binary_throughput(state, [&](double x, double y) { CcmBody; }, xs, ys);                                                                    \
+	}
+
+#define CCMATH_BENCH_REGISTER_BINARY_THROUGHPUT_SUITE(Module, Name, Suffix)                                                                                    \
+	BENCHMARK(BM_##Module##_##Name##_std##Suffix##_throughput) CCMATH_BENCH_APPLY_RANGE;                                                                       \
+	BENCHMARK(BM_##Module##_##Name##_ccm##Suffix##_throughput) CCMATH_BENCH_APPLY_RANGE;
+
+#define CCMATH_BENCH_DECLARE_TERNARY_LATENCY_SUITE(Module, Name, Suffix, StdBody, CcmBody)                                                                     \
+	static void BM_##Module##_##Name##_std##Suffix##_latency(benchmark::State& state)                                                                          \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto ys = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto zs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::ternary_latency(state, [&](double x, double y, double z) { StdBody; }, xs, ys, zs);                                                        \
+	}                                                                                                                                                          \
+	static void BM_##Module##_##Name##_ccm##Suffix##_latency(benchmark::State& state)                                                                          \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto ys = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto zs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::ternary_latency(state, [&](double x, double y, double z) { CcmBody; }, xs, ys, zs);                                                        \
+	}
+
+#define CCMATH_BENCH_REGISTER_TERNARY_LATENCY_SUITE(Module, Name, Suffix)                                                                                      \
+	BENCHMARK(BM_##Module##_##Name##_std##Suffix##_latency) CCMATH_BENCH_APPLY_RANGE;                                                                          \
+	BENCHMARK(BM_##Module##_##Name##_ccm##Suffix##_latency) CCMATH_BENCH_APPLY_RANGE;
+
+#define CCMATH_BENCH_DECLARE_TERNARY_THROUGHPUT_SUITE(Module, Name, Suffix, StdBody, CcmBody)                                                                  \
+	static void BM_##Module##_##Name##_std##Suffix##_throughput(benchmark::State& state)                                                                       \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto ys = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto zs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::ternary_throughput(state, [&](double x, double y, double z) { StdBody; }, xs, ys, zs);                                                     \
+	}                                                                                                                                                          \
+	static void BM_##Module##_##Name##_ccm##Suffix##_throughput(benchmark::State& state)                                                                       \
+	{                                                                                                                                                          \
+		auto xs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto ys = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		auto zs = ccm::bench::random_doubles(state.range(0));                                                                                                  \
+		ccm::bench::ternary_throughput(state, [&](double x, double y, double z) { CcmBody; }, xs, ys, zs);                                                     \
+	}
+
+#define CCMATH_BENCH_REGISTER_TERNARY_THROUGHPUT_SUITE(Module, Name, Suffix)                                                                                   \
+	BENCHMARK(BM_##Module##_##Name##_std##Suffix##_throughput) CCMATH_BENCH_APPLY_RANGE;                                                                       \
+	BENCHMARK(BM_##Module##_##Name##_ccm##Suffix##_throughput) CCMATH_BENCH_APPLY_RANGE;
+
+// Batch mode: a std loop, a ccm scalar loop and BatchBody, which sees in, out and n.
+#define CCMATH_BENCH_DECLARE_UNARY_BATCH_SUITE(Module, Name, StdBody, CcmBody, BatchBody)                                                                      \
+	static void BM_##Module##_##Name##_std_loop_batch(benchmark::State& state)                                                                                 \
+	{                                                                                                                                                          \
+		auto inputs = ccm::bench::random_doubles(state.range(0));                                                                                              \
+		auto scalar = [&](double x) { StdBody; };                                                                                                              \
+		ccm::bench::unary_batch(                                                                                                                               \
+			state, [&](double const * in, double * out, std::size_t n) { for (std::size_t i = 0; i < n; ++i) { out[i] = scalar(in[i]); } }, inputs);           \
+	}                                                                                                                                                          \
+	static void BM_##Module##_##Name##_ccm_loop_batch(benchmark::State& state)                                                                                 \
+	{                                                                                                                                                          \
+		auto inputs = ccm::bench::random_doubles(state.range(0));                                                                                              \
+		auto scalar = [&](double x) { CcmBody; };                                                                                                              \
+		ccm::bench::unary_batch(                                                                                                                               \
+			state, [&](double const * in, double * out, std::size_t n) { for (std::size_t i = 0; i < n; ++i) { out[i] = scalar(in[i]); } }, inputs);           \
+	}                                                                                                                                                          \
+	static void BM_##Module##_##Name##_ccm_batch(benchmark::State& state)                                                                                      \
+	{                                                                                                                                                          \
+		auto inputs = ccm::bench::random_doubles(state.range(0));                                                                                              \
+		ccm::bench::unary_batch(state, [&](double const * in, double * out, std::size_t n) { BatchBody; }, inputs);                                            \
+	}
+
+#define CCMATH_BENCH_REGISTER_UNARY_BATCH_SUITE(Module, Name)                                                                                                  \
+	BENCHMARK(BM_##Module##_##Name##_std_loop_batch) CCMATH_BENCH_APPLY_RANGE;                                                                                 \
+	BENCHMARK(BM_##Module##_##Name##_ccm_loop_batch) CCMATH_BENCH_APPLY_RANGE;                                                                                 \
+	BENCHMARK(BM_##Module##_##Name##_ccm_batch) CCMATH_BENCH_APPLY_RANGE;
+
+#define CCMATH_BENCH_UNARY_LATENCY(Module, Name, StdBody, CcmBody)                                                                                             \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_UNARY_LATENCY_SUITE(Module, Name, , StdBody, CcmBody))                                                             \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_UNARY_LATENCY_SUITE(Module, Name, ))
+
+#define CCMATH_BENCH_UNARY_THROUGHPUT(Module, Name, StdBody, CcmBody)                                                                                          \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_UNARY_THROUGHPUT_SUITE(Module, Name, , StdBody, CcmBody))                                                          \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_UNARY_THROUGHPUT_SUITE(Module, Name, ))
+
+#define CCMATH_BENCH_UNARY_MODES(Module, Name, StdBody, CcmBody)                                                                                               \
+	CCMATH_BENCH_UNARY_LATENCY(Module, Name, StdBody, CcmBody)                                                                                                 \
+	CCMATH_BENCH_UNARY_THROUGHPUT(Module, Name, StdBody, CcmBody)
+
+#define CCMATH_BENCH_BINARY_LATENCY(Module, Name, StdBody, CcmBody)                                                                                            \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_BINARY_LATENCY_SUITE(Module, Name, , StdBody, CcmBody))                                                            \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_BINARY_LATENCY_SUITE(Module, Name, ))
+
+#define CCMATH_BENCH_BINARY_THROUGHPUT(Module, Name, StdBody, CcmBody)                                                                                         \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_BINARY_THROUGHPUT_SUITE(Module, Name, , StdBody, CcmBody))                                                         \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_BINARY_THROUGHPUT_SUITE(Module, Name, ))
+
+#define CCMATH_BENCH_BINARY_MODES(Module, Name, StdBody, CcmBody)                                                                                              \
+	CCMATH_BENCH_BINARY_LATENCY(Module, Name, StdBody, CcmBody)                                                                                                \
+	CCMATH_BENCH_BINARY_THROUGHPUT(Module, Name, StdBody, CcmBody)
+
+#define CCMATH_BENCH_TERNARY_LATENCY(Module, Name, StdBody, CcmBody)                                                                                           \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_TERNARY_LATENCY_SUITE(Module, Name, , StdBody, CcmBody))                                                           \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_TERNARY_LATENCY_SUITE(Module, Name, ))
+
+#define CCMATH_BENCH_TERNARY_THROUGHPUT(Module, Name, StdBody, CcmBody)                                                                                        \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_TERNARY_THROUGHPUT_SUITE(Module, Name, , StdBody, CcmBody))                                                        \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_TERNARY_THROUGHPUT_SUITE(Module, Name, ))
+
+#define CCMATH_BENCH_TERNARY_MODES(Module, Name, StdBody, CcmBody)                                                                                             \
+	CCMATH_BENCH_TERNARY_LATENCY(Module, Name, StdBody, CcmBody)                                                                                               \
+	CCMATH_BENCH_TERNARY_THROUGHPUT(Module, Name, StdBody, CcmBody)
+
+#define CCMATH_BENCH_UNARY_BATCH(Module, Name, StdBody, CcmBody, BatchBody)                                                                                    \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_UNARY_BATCH_SUITE(Module, Name, StdBody, CcmBody, BatchBody))                                                      \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_UNARY_BATCH_SUITE(Module, Name))
+
+// Profile and path-mix streams from asmlab's benchmark_profiles.json, see profiles.hpp. A profile
+// runs in its mode_default, so the latency profiles chain like the _LATENCY suites.
+#define CCMATH_BENCH_DECLARE_UNARY_STREAM_SUITE(Module, Name, Stream, Source, Key, StdBody, CcmBody)                                                           \
+	static void BM_##Module##_##Name##_std_##Stream(benchmark::State& state)                                                                                   \
+	{ ccm::bench::unary_stream(state, [&](double x) { StdBody; }, Source(state.range(0), Key)); }                                                              \
+	static void BM_##Module##_##Name##_ccm_##Stream(benchmark::State& state)                                                                                   \
+	{ ccm::bench::unary_stream(state, [&](double x) { CcmBody; }, Source(state.range(0), Key)); }
+
+#define CCMATH_BENCH_REGISTER_UNARY_STREAM_SUITE(Module, Name, Stream)                                                                                         \
+	BENCHMARK(BM_##Module##_##Name##_std_##Stream) CCMATH_BENCH_APPLY_RANGE;                                                                                   \
+	BENCHMARK(BM_##Module##_##Name##_ccm_##Stream) CCMATH_BENCH_APPLY_RANGE;
+
+#define CCMATH_BENCH_DECLARE_BINARY_STREAM_SUITE(Module, Name, Stream, Source, Key, StdBody, CcmBody)                                                          \
+	static void BM_##Module##_##Name##_std_##Stream(benchmark::State& state)                                                                                   \
+	{ ccm::bench::binary_stream(state, [&](double x, double y) { StdBody; }, Source(state.range(0), Key)); }                                                   \
+	static void BM_##Module##_##Name##_ccm_##Stream(benchmark::State& state)                                                                                   \
+	{ ccm::bench::binary_stream(state, [&](double x, double y) { CcmBody; }, Source(state.range(0), Key)); }
+
+#define CCMATH_BENCH_REGISTER_BINARY_STREAM_SUITE(Module, Name, Stream)                                                                                        \
+	BENCHMARK(BM_##Module##_##Name##_std_##Stream) CCMATH_BENCH_APPLY_RANGE;                                                                                   \
+	BENCHMARK(BM_##Module##_##Name##_ccm_##Stream) CCMATH_BENCH_APPLY_RANGE;
+
+#define CCMATH_BENCH_UNARY_PROFILE_STREAM(Module, Name, Profile, StdBody, CcmBody)                                                                             \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_UNARY_STREAM_SUITE(Module, Name, Profile##_stream, ccm::bench::profile_stream, #Profile, StdBody, CcmBody))        \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_UNARY_STREAM_SUITE(Module, Name, Profile##_stream))
+
+#define CCMATH_BENCH_UNARY_PATH_MIX(Module, Name, StdBody, CcmBody)                                                                                            \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_UNARY_STREAM_SUITE(Module, Name, path_mix, ccm::bench::mix_stream, #Name, StdBody, CcmBody))                       \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_UNARY_STREAM_SUITE(Module, Name, path_mix))
+
+#define CCMATH_BENCH_BINARY_PROFILE_STREAM(Module, Name, Profile, StdBody, CcmBody)                                                                            \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_BINARY_STREAM_SUITE(Module, Name, Profile##_stream, ccm::bench::profile_stream, #Profile, StdBody, CcmBody))       \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_BINARY_STREAM_SUITE(Module, Name, Profile##_stream))
+
+#define CCMATH_BENCH_BINARY_PATH_MIX(Module, Name, StdBody, CcmBody)                                                                                           \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_DECLARE_BINARY_STREAM_SUITE(Module, Name, path_mix, ccm::bench::mix_stream, #Name, StdBody, CcmBody))                      \
+	CCMATH_BENCH_IF_CT(CCMATH_BENCH_REGISTER_BINARY_STREAM_SUITE(Module, Name, path_mix))
@@ -0,0 +1,149 @@
+#pragma once
+
+// Multi-threaded scaling drivers. Each benchmark runs at 1, 2, 4, ... threads up to
+// CCM_BENCH_MAX_THREADS (default: the hardware concurrency), every thread over its own input and
+// output buffers, padded by a cache line on each side so no two threads' data share a line. The
+// elements counter is the throughput of all threads together; scaling_reporter adds speedup over
+// the single-thread run of the same benchmark and efficiency, the speedup per thread. Efficiency
+// well under 1 with cores to spare points at shared state in the kernels: tables that no longer
+// fit in each core's L1/L2, or writes to a line another core reads.
+
+#include "inputs.hpp"
+#include "perf_counters.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ccm::bench
+{
+	inline constexpr std::int64_t kScalingL1Elements = 1 << 10;
+	inline constexpr std::int64_t kScalingL2Elements = 1 << 14;
+
+	inline int scaling_max_threads()
+	{
+		static int const threads = []
+		{
+			char const* value = std::getenv("CCM_BENCH_MAX_THREADS");
+			int const requested = value != nullptr ? std::atoi(value) : 0;
+			if (requested > 0) { return requested; }
+			unsigned const hw = std::thread::hardware_concurrency();
+			return hw > 0 ? static_cast<int>(hw) : 1;
+		}();
+		return threads;
+	}
+
+	template <typename T>
+	class padded_buffer
+	{
+	public:
+		static constexpr std::size_t kPad = 64 / sizeof(T) + 1;
+
+		explicit padded_buffer(std::size_t count) : m_storage(count + 2 * kPad) {}
+
+		T* data() { return m_storage.data() + kPad; }
+		T const* data() const { return m_storage.data() + kPad; }
+
+	private:
+		std::vector<T> m_storage;
+	};
+
+	// fn(x, y, out, out2, n) over this thread's buffers; x and y are uniform in [lo, hi).
+	template <typename T, typename Fn>
+	void scaling_batch(benchmark::State& state, double lo, double hi, Fn&& fn)
+	{
+		auto const n = static_cast<std::size_t>(state.range(0));
+		padded_buffer<T> x(n);
+		padded_buffer<T> y(n);
+		padded_buffer<T> out(n);
+		padded_buffer<T> out2(n);
+		auto const xs = thread_rng().doubles(state.range(0), lo, hi);
+		auto const ys = thread_rng().doubles(state.range(0), lo, hi);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			x.data()[i] = static_cast<T>(xs[i]);
+			y.data()[i] = static_cast<T>(ys[i]);
+		}
+
+		perf_scope const perf(state, state.range(0));
+		for (auto _ : state)
+		{
+			fn(x.data(), y.data(), out.data(), out2.data(), n);
+			benchmark::DoNotOptimize(out.data());
+			benchmark::DoNotOptimize(out2.data());
+			benchmark::ClobberMemory();
+		}
+		state.counters["elements"] = benchmark::Counter(static_cast<double>(state.iterations()) * static_cast<double>(n), benchmark::Counter::kIsRate);
+	}
+
+	// Forwards to the reporter --benchmark_format selects, adding speedup and efficiency to each run
+	// that has a single-thread run of the same benchmark and arguments.
+	class scaling_reporter : public benchmark::BenchmarkReporter
+	{
+	public:
+		explicit scaling_reporter(benchmark::BenchmarkReporter* inner) : m_inner{ inner } {}
+
+		bool ReportContext(Context const& context) override { return m_inner->ReportContext(context); }
+
+		void ReportRuns(std::vector<Run> const& runs) override
+		{
+			std::vector<Run> annotated(runs);
+			for (Run& run : annotated)
+			{
+				auto const elements = run.counters.find("elements");
+				if (elements == run.counters.end()) { continue; }
+				if (run.run_type == Run::RT_Aggregate && run.aggregate_name != "mean" && run.aggregate_name != "median") { continue; }
+				std::string const key = run.run_name.function_name + "/" + run.run_name.args + "/" + run.aggregate_name;
+				double const rate	  = elements->second.value;
+				if (run.threads == 1) { m_single[key] = rate; }
+				auto const single = m_single.find(key);
+				if (single == m_single.end() || single->second <= 0.0) { continue; }
+				double const speedup		= rate / single->second;
+				run.counters["speedup"]	= speedup;
+				run.counters["efficiency"] = speedup / static_cast<double>(run.threads);
+			}
+			m_inner->ReportRuns(annotated);
+		}
+
+		void Finalize() override { m_inner->Finalize(); }
+
+	private:
+		benchmark::BenchmarkReporter* m_inner;
+		std::map<std::string, double> m_single;
+	};
+
+	inline int scaling_main(int argc, char** argv)
+	{
+		benchmark::Initialize(&argc, argv);
+		if (benchmark::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+		scaling_reporter reporter(benchmark::CreateDefaultDisplayReporter());
+		benchmark::RunSpecifiedBenchmarks(&reporter);
+		benchmark::Shutdown();
+		return 0;
+	}
+} // namespace ccm::bench
+
+#define CCMATH_BENCH_APPLY_SCALING                                                                                                                             \
+	->Arg(ccm::bench::kScalingL1Elements)->Arg(ccm::bench::kScalingL2Elements)->ThreadRange(1, ccm::bench::scaling_max_threads())->UseRealTime()
+
+// Body sees x, y, out, out2 and n, e.g. ccm::batch::exp(x, out, n).
+#define CCMATH_BENCH_SCALING(Name, Type, Lo, Hi, Body)                                                                                                         \
+	static void BM_scaling_##Name##_##Type(benchmark::State& state)                                                                                            \
+	{                                                                                                                                                          \
+		ccm::bench::scaling_batch<Type>(state, Lo, Hi,                                                                                                         \
+			[](Type const* x, Type const* y, Type* out, Type* out2, std::size_t n)                                                                             \
+			{                                                                                                                                                  \
+				static_cast<void>(x);                                                                                                                          \
+				static_cast<void>(y);                                                                                                                          \
+				static_cast<void>(out2);                                                                                                                       \
+				Body;                                                                                                                                          \
+			});                                                                                                                                                \
+	}                                                                                                                                                          \
+	BENCHMARK(BM_scaling_##Name##_##Type) CCMATH_BENCH_APPLY_SCALING;
@@ -6,4 +6,6 @@
 
 CCMATH_BENCH_TERNARY_COMPARE(basic, fma, return std::fma(x, y, z);, return ccm::fma(x, y, z);)
 
+CCMATH_BENCH_TERNARY_MODES(basic, fma, return std::fma(x, y, z), return ccm::fma(x, y, z))
+
 BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double fmax_rt(double x, double y)
+	{ return ccm::rt::fmax_rt(x, y); }
+} // namespace
+
+CCMATH_BENCH_BINARY_COMPARE_PATHS(basic, fmax,
+	return std::fmax(static_cast<double>(x), static_cast<double>(y)),
+	return ccm::fmax(static_cast<double>(x), static_cast<double>(y)),
+	return fmax_rt(static_cast<double>(x), static_cast<double>(y)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double fmin_rt(double x, double y)
+	{ return ccm::rt::fmin_rt(x, y); }
+} // namespace
+
+CCMATH_BENCH_BINARY_COMPARE_PATHS(basic, fmin,
+	return std::fmin(static_cast<double>(x), static_cast<double>(y)),
+	return ccm::fmin(static_cast<double>(x), static_cast<double>(y)),
+	return fmin_rt(static_cast<double>(x), static_cast<double>(y)))
+
+BENCHMARK_MAIN();
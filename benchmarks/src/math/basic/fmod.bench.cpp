@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double fmod_rt(double x, double y)
+	{ return ccm::rt::fmod_rt(x, y); }
+} // namespace
+
+CCMATH_BENCH_BINARY_COMPARE_PATHS(basic, fmod,
+	return std::fmod(static_cast<double>(x), static_cast<double>(y)),
+	return ccm::fmod(static_cast<double>(x), static_cast<double>(y)),
+	return fmod_rt(static_cast<double>(x), static_cast<double>(y)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double remainder_rt(double x, double y)
+	{ return ccm::rt::remainder_rt(x, y); }
+} // namespace
+
+CCMATH_BENCH_BINARY_COMPARE_PATHS(basic, remainder,
+	return std::remainder(static_cast<double>(x), static_cast<double>(y)),
+	return ccm::remainder(static_cast<double>(x), static_cast<double>(y)),
+	return remainder_rt(static_cast<double>(x), static_cast<double>(y)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,11 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+CCMATH_BENCH_BINARY_COMPARE(basic, remquo,
+	int quo = 0; return std::remquo(static_cast<double>(x), static_cast<double>(y), &quo);,
+	int quo = 0; return ccm::remquo(static_cast<double>(x), static_cast<double>(y), &quo);)
+
+BENCHMARK_MAIN();
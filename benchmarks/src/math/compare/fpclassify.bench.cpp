@@ -0,0 +1,9 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+CCMATH_BENCH_UNARY_COMPARE(compare, fpclassify, return std::fpclassify(static_cast<double>(x));, return ccm::fpclassify(static_cast<double>(x));)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,9 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+CCMATH_BENCH_UNARY_COMPARE(compare, isfinite, return std::isfinite(static_cast<double>(x));, return ccm::isfinite(static_cast<double>(x));)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,11 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+CCMATH_BENCH_BINARY_COMPARE(compare, isunordered,
+	return std::isunordered(static_cast<double>(x), static_cast<double>(y));,
+	return ccm::isunordered(static_cast<double>(x), static_cast<double>(y));)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,9 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+CCMATH_BENCH_UNARY_COMPARE(compare, signbit, return std::signbit(static_cast<double>(x));, return ccm::signbit(static_cast<double>(x));)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,22 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double exp_rt(double v)
+	{ return ccm::rt::exp_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(expo, exp,
+	return std::exp(static_cast<double>(x)),
+	return ccm::exp(static_cast<double>(x)),
+	return exp_rt(static_cast<double>(x)))
+
+CCMATH_BENCH_UNARY_MODES(expo, exp, return std::exp(x), return ccm::exp(x))
+
+CCMATH_BENCH_UNARY_BATCH(expo, exp, return std::exp(x), return ccm::exp(x), ccm::batch::exp(in, out, n))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double exp2_rt(double v)
+	{ return ccm::rt::exp2_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(expo, exp2,
+	return std::exp2(static_cast<double>(x)),
+	return ccm::exp2(static_cast<double>(x)),
+	return exp2_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double expm1_rt(double v)
+	{ return ccm::rt::expm1_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(expo, expm1,
+	return std::expm1(static_cast<double>(x)),
+	return ccm::expm1(static_cast<double>(x)),
+	return expm1_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,28 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double log_rt(double v)
+	{ return ccm::rt::log_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(expo, log,
+	return std::log(static_cast<double>(x)),
+	return ccm::log(static_cast<double>(x)),
+	return log_rt(static_cast<double>(x)))
+
+CCMATH_BENCH_UNARY_MODES(expo, log, return std::log(x), return ccm::log(x))
+
+CCMATH_BENCH_UNARY_BATCH(expo, log, return std::log(x), return ccm::log(x), ccm::batch::log(in, out, n))
+
+CCMATH_BENCH_UNARY_PROFILE_STREAM(expo, log, positive_finite_general, return std::log(x), return ccm::log(x))
+CCMATH_BENCH_UNARY_PROFILE_STREAM(expo, log, near_one, return std::log(x), return ccm::log(x))
+CCMATH_BENCH_UNARY_PROFILE_STREAM(expo, log, subnormal, return std::log(x), return ccm::log(x))
+CCMATH_BENCH_UNARY_PROFILE_STREAM(expo, log, nan_inf_signed_zero, return std::log(x), return ccm::log(x))
+CCMATH_BENCH_UNARY_PATH_MIX(expo, log, return std::log(x), return ccm::log(x))
+
+BENCHMARK_MAIN();
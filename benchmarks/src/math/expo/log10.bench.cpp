@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double log10_rt(double v)
+	{ return ccm::rt::log10_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(expo, log10,
+	return std::log10(static_cast<double>(x)),
+	return ccm::log10(static_cast<double>(x)),
+	return log10_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double log1p_rt(double v)
+	{ return ccm::rt::log1p_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(expo, log1p,
+	return std::log1p(static_cast<double>(x)),
+	return ccm::log1p(static_cast<double>(x)),
+	return log1p_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double log2_rt(double v)
+	{ return ccm::rt::log2_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(expo, log2,
+	return std::log2(static_cast<double>(x)),
+	return ccm::log2(static_cast<double>(x)),
+	return log2_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double copysign_rt(double x, double y)
+	{ return ccm::rt::copysign_rt(x, y); }
+} // namespace
+
+CCMATH_BENCH_BINARY_COMPARE_PATHS(fmanip, copysign,
+	return std::copysign(static_cast<double>(x), static_cast<double>(y)),
+	return ccm::copysign(static_cast<double>(x), static_cast<double>(y)),
+	return copysign_rt(static_cast<double>(x), static_cast<double>(y)))
+
+BENCHMARK_MAIN();
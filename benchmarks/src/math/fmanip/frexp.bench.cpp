@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double frexp_rt(double v, int * exp)
+	{ return ccm::rt::frexp_rt(v, *exp); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(fmanip, frexp,
+	int exp = 0; return std::frexp(static_cast<double>(x), &exp),
+	int exp = 0; return ccm::frexp(static_cast<double>(x), &exp),
+	int exp = 0; return frexp_rt(static_cast<double>(x), &exp))
+
+BENCHMARK_MAIN();
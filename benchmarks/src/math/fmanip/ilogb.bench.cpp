@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline int ilogb_rt(double v)
+	{ return ccm::rt::ilogb_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(fmanip, ilogb,
+	return std::ilogb(static_cast<double>(x)),
+	return ccm::ilogb(static_cast<double>(x)),
+	return ilogb_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
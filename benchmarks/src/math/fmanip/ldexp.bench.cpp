@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double ldexp_rt(double v, int exp)
+	{ return ccm::rt::ldexp_rt(v, exp); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(fmanip, ldexp,
+	return std::ldexp(static_cast<double>(x), 7),
+	return ccm::ldexp(static_cast<double>(x), 7),
+	return ldexp_rt(static_cast<double>(x), 7))
+
+BENCHMARK_MAIN();
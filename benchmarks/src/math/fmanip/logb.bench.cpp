@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double logb_rt(double v)
+	{ return ccm::rt::logb_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(fmanip, logb,
+	return std::logb(static_cast<double>(x)),
+	return ccm::logb(static_cast<double>(x)),
+	return logb_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
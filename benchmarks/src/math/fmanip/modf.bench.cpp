@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double modf_rt(double v, double * ipart)
+	{ return ccm::rt::modf_rt(v, *ipart); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(fmanip, modf,
+	double ipart = 0.0; return std::modf(static_cast<double>(x), &ipart),
+	double ipart = 0.0; return ccm::modf(static_cast<double>(x), &ipart),
+	double ipart = 0.0; return modf_rt(static_cast<double>(x), &ipart))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double nextafter_rt(double x, double y)
+	{ return ccm::rt::nextafter_rt(x, y); }
+} // namespace
+
+CCMATH_BENCH_BINARY_COMPARE_PATHS(fmanip, nextafter,
+	return std::nextafter(static_cast<double>(x), static_cast<double>(y)),
+	return ccm::nextafter(static_cast<double>(x), static_cast<double>(y)),
+	return nextafter_rt(static_cast<double>(x), static_cast<double>(y)))
+
+BENCHMARK_MAIN();
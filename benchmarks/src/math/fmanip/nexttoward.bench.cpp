@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double nexttoward_rt(double v, long double to)
+	{ return ccm::rt::nexttoward_rt(v, to); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(fmanip, nexttoward,
+	return std::nexttoward(static_cast<double>(x), 0.0L),
+	return ccm::nexttoward(static_cast<double>(x), 0.0L),
+	return nexttoward_rt(static_cast<double>(x), 0.0L))
+
+BENCHMARK_MAIN();
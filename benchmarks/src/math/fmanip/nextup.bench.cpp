@@ -0,0 +1,9 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+CCMATH_BENCH_UNARY_COMPARE(fmanip, nextup, return std::nextafter(static_cast<double>(x), HUGE_VAL);, return ccm::nextup(static_cast<double>(x));)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double scalbn_rt(double v, int exp)
+	{ return ccm::rt::scalbn_rt(v, exp); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(fmanip, scalbn,
+	return std::scalbn(static_cast<double>(x), 7),
+	return ccm::scalbn(static_cast<double>(x), 7),
+	return scalbn_rt(static_cast<double>(x), 7))
+
+BENCHMARK_MAIN();
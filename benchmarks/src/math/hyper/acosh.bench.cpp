@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double acosh_rt(double v)
+	{ return ccm::rt::acosh_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(hyper, acosh,
+	return std::acosh(1.0 + static_cast<double>(x)),
+	return ccm::acosh(1.0 + static_cast<double>(x)),
+	return acosh_rt(1.0 + static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double asinh_rt(double v)
+	{ return ccm::rt::asinh_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(hyper, asinh,
+	return std::asinh(static_cast<double>(x)),
+	return ccm::asinh(static_cast<double>(x)),
+	return asinh_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double atanh_rt(double v)
+	{ return ccm::rt::atanh_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(hyper, atanh,
+	return std::atanh(static_cast<double>(x)),
+	return ccm::atanh(static_cast<double>(x)),
+	return atanh_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
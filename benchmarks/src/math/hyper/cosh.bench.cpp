@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double cosh_rt(double v)
+	{ return ccm::rt::cosh_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(hyper, cosh,
+	return std::cosh(static_cast<double>(x)),
+	return ccm::cosh(static_cast<double>(x)),
+	return cosh_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
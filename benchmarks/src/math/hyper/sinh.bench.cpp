@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double sinh_rt(double v)
+	{ return ccm::rt::sinh_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(hyper, sinh,
+	return std::sinh(static_cast<double>(x)),
+	return ccm::sinh(static_cast<double>(x)),
+	return sinh_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,23 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double sinhcosh_rt(double v)
+	{
+		double s = 0.0;
+		double c = 0.0;
+		ccm::rt::sinhcosh_rt(v, s, c);
+		return s + c;
+	}
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(hyper, sinhcosh,
+	return std::sinh(static_cast<double>(x)) + std::cosh(static_cast<double>(x)),
+	double s = 0.0; double c = 0.0; ccm::sinhcosh(static_cast<double>(x), &s, &c); return s + c,
+	return sinhcosh_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
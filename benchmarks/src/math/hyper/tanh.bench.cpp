@@ -0,0 +1,22 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double tanh_rt(double v)
+	{ return ccm::rt::tanh_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(hyper, tanh,
+	return std::tanh(static_cast<double>(x)),
+	return ccm::tanh(static_cast<double>(x)),
+	return tanh_rt(static_cast<double>(x)))
+
+CCMATH_BENCH_UNARY_MODES(hyper, tanh, return std::tanh(x), return ccm::tanh(x))
+
+CCMATH_BENCH_UNARY_BATCH(hyper, tanh, return std::tanh(x), return ccm::tanh(x), ccm::batch::tanh(in, out, n))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double gamma_rt(double v)
+	{ return ccm::rt::gamma_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(misc, gamma,
+	return std::tgamma(static_cast<double>(x)),
+	return ccm::gamma(static_cast<double>(x)),
+	return gamma_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
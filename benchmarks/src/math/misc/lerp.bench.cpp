@@ -0,0 +1,11 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+CCMATH_BENCH_TERNARY_COMPARE(misc, lerp,
+	return static_cast<double>(x) + static_cast<double>(z) * (static_cast<double>(y) - static_cast<double>(x));,
+	return ccm::lerp(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z));)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double lgamma_rt(double v)
+	{ return ccm::rt::lgamma_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(misc, lgamma,
+	return std::lgamma(static_cast<double>(x)),
+	return ccm::lgamma(static_cast<double>(x)),
+	return lgamma_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
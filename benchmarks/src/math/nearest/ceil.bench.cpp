@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double ceil_rt(double v)
+	{ return ccm::rt::ceil_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(nearest, ceil,
+	return std::ceil(static_cast<double>(x)),
+	return ccm::ceil(static_cast<double>(x)),
+	return ceil_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
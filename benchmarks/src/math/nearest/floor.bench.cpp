@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double floor_rt(double v)
+	{ return ccm::rt::floor_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(nearest, floor,
+	return std::floor(static_cast<double>(x)),
+	return ccm::floor(static_cast<double>(x)),
+	return floor_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double nearbyint_rt(double v)
+	{ return ccm::rt::nearbyint_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(nearest, nearbyint,
+	return std::nearbyint(static_cast<double>(x)),
+	return ccm::nearbyint(static_cast<double>(x)),
+	return nearbyint_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
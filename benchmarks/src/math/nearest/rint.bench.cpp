@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double rint_rt(double v)
+	{ return ccm::rt::rint_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(nearest, rint,
+	return std::rint(static_cast<double>(x)),
+	return ccm::rint(static_cast<double>(x)),
+	return rint_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double round_rt(double v)
+	{ return ccm::rt::round_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(nearest, round,
+	return std::round(static_cast<double>(x)),
+	return ccm::round(static_cast<double>(x)),
+	return round_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,22 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double cbrt_rt(double v)
+	{ return ccm::rt::cbrt_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(power, cbrt,
+	return std::cbrt(static_cast<double>(x)),
+	return ccm::cbrt(static_cast<double>(x)),
+	return cbrt_rt(static_cast<double>(x)))
+
+CCMATH_BENCH_UNARY_MODES(power, cbrt, return std::cbrt(x), return ccm::cbrt(x))
+
+CCMATH_BENCH_UNARY_BATCH(power, cbrt, return std::cbrt(x), return ccm::cbrt(x), ccm::batch::cbrt(in, out, n))
+
+BENCHMARK_MAIN();
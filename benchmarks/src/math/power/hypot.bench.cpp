@@ -0,0 +1,20 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double hypot_rt(double x, double y)
+	{ return ccm::rt::hypot_rt(x, y); }
+} // namespace
+
+CCMATH_BENCH_BINARY_COMPARE_PATHS(power, hypot,
+	return std::hypot(static_cast<double>(x), static_cast<double>(y)),
+	return ccm::hypot(static_cast<double>(x), static_cast<double>(y)),
+	return hypot_rt(static_cast<double>(x), static_cast<double>(y)))
+
+CCMATH_BENCH_BINARY_MODES(power, hypot, return std::hypot(x, y), return ccm::hypot(x, y))
+
+BENCHMARK_MAIN();
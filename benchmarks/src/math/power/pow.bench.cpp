@@ -0,0 +1,26 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double pow_rt(double x, double y)
+	{ return ccm::rt::pow_rt(x, y); }
+} // namespace
+
+CCMATH_BENCH_BINARY_COMPARE_PATHS(power, pow,
+	return std::pow(static_cast<double>(x), static_cast<double>(y)),
+	return ccm::pow(static_cast<double>(x), static_cast<double>(y)),
+	return pow_rt(static_cast<double>(x), static_cast<double>(y)))
+
+CCMATH_BENCH_BINARY_MODES(power, pow, return std::pow(x, y), return ccm::pow(x, y))
+
+CCMATH_BENCH_BINARY_PROFILE_STREAM(power, pow, positive_finite_general, return std::pow(x, y), return ccm::pow(x, y))
+CCMATH_BENCH_BINARY_PROFILE_STREAM(power, pow, near_one, return std::pow(x, y), return ccm::pow(x, y))
+CCMATH_BENCH_BINARY_PROFILE_STREAM(power, pow, integer_exponent, return std::pow(x, y), return ccm::pow(x, y))
+CCMATH_BENCH_BINARY_PROFILE_STREAM(power, pow, nan_inf_signed_zero, return std::pow(x, y), return ccm::pow(x, y))
+CCMATH_BENCH_BINARY_PATH_MIX(power, pow, return std::pow(x, y), return ccm::pow(x, y))
+
+BENCHMARK_MAIN();
@@ -20,4 +20,6 @@ CCMATH_BENCH_UNARY_PROFILE_PATHS(power, sqrt, positive_finite_general, 4.0,
 	return ccm::sqrt(x),
 	return sqrt_rt(x))
 
+CCMATH_BENCH_UNARY_MODES(power, sqrt, return std::sqrt(x), return ccm::sqrt(x))
+
 BENCHMARK_MAIN();
@@ -0,0 +1,51 @@
+#include "shared/scaling.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+namespace
+{
+	using long_double = long double;
+} // namespace
+
+// exp_data, shared by exp, exp2 and expm1 and both precisions.
+CCMATH_BENCH_SCALING(exp, double, -10.0, 10.0, ccm::batch::exp(x, out, n))
+CCMATH_BENCH_SCALING(exp, float, -10.0, 10.0, ccm::batch::exp(x, out, n))
+CCMATH_BENCH_SCALING(exp2, double, -10.0, 10.0, ccm::batch::exp2(x, out, n))
+CCMATH_BENCH_SCALING(expm1, double, -10.0, 10.0, ccm::batch::expm1(x, out, n))
+
+// log tables.
+CCMATH_BENCH_SCALING(log, double, 0.001, 1000.0, ccm::batch::log(x, out, n))
+CCMATH_BENCH_SCALING(log, float, 0.001, 1000.0, ccm::batch::log(x, out, n))
+CCMATH_BENCH_SCALING(log2, double, 0.001, 1000.0, ccm::batch::log2(x, out, n))
+CCMATH_BENCH_SCALING(log10, double, 0.001, 1000.0, ccm::batch::log10(x, out, n))
+CCMATH_BENCH_SCALING(log1p, double, -0.5, 10.0, ccm::batch::log1p(x, out, n))
+
+// pow has no batch entry point; a loop over the same buffers covers pow_data, powf_data and
+// powl_ld80_tables.
+CCMATH_BENCH_SCALING(pow, double, 0.1, 10.0, for (std::size_t i = 0; i < n; ++i) { out[i] = ccm::pow(x[i], y[i]); })
+CCMATH_BENCH_SCALING(pow, float, 0.1, 10.0, for (std::size_t i = 0; i < n; ++i) { out[i] = ccm::pow(x[i], y[i]); })
+CCMATH_BENCH_SCALING(pow, long_double, 0.1, 10.0, for (std::size_t i = 0; i < n; ++i) { out[i] = ccm::pow(x[i], y[i]); })
+CCMATH_BENCH_SCALING(cbrt, double, -100.0, 100.0, ccm::batch::cbrt(x, out, n))
+CCMATH_BENCH_SCALING(hypot, double, -100.0, 100.0, ccm::batch::hypot(x, y, out, n))
+
+// sin/cos reduction tables.
+CCMATH_BENCH_SCALING(sin, double, -100.0, 100.0, ccm::batch::sin(x, out, n))
+CCMATH_BENCH_SCALING(sin, float, -100.0, 100.0, ccm::batch::sin(x, out, n))
+CCMATH_BENCH_SCALING(cos, double, -100.0, 100.0, ccm::batch::cos(x, out, n))
+CCMATH_BENCH_SCALING(sincos, double, -100.0, 100.0, ccm::batch::sincos(x, out, out2, n))
+CCMATH_BENCH_SCALING(tan, double, -100.0, 100.0, ccm::batch::tan(x, out, n))
+CCMATH_BENCH_SCALING(asin, double, -1.0, 1.0, ccm::batch::asin(x, out, n))
+CCMATH_BENCH_SCALING(acos, double, -1.0, 1.0, ccm::batch::acos(x, out, n))
+CCMATH_BENCH_SCALING(atan, double, -10.0, 10.0, ccm::batch::atan(x, out, n))
+CCMATH_BENCH_SCALING(atan2, double, -10.0, 10.0, ccm::batch::atan2(y, x, out, n))
+
+CCMATH_BENCH_SCALING(sinh, double, -5.0, 5.0, ccm::batch::sinh(x, out, n))
+CCMATH_BENCH_SCALING(cosh, double, -5.0, 5.0, ccm::batch::cosh(x, out, n))
+CCMATH_BENCH_SCALING(sinhcosh, double, -5.0, 5.0, ccm::batch::sinhcosh(x, out, out2, n))
+CCMATH_BENCH_SCALING(tanh, double, -5.0, 5.0, ccm::batch::tanh(x, out, n))
+CCMATH_BENCH_SCALING(asinh, double, -10.0, 10.0, ccm::batch::asinh(x, out, n))
+CCMATH_BENCH_SCALING(acosh, double, 1.0, 100.0, ccm::batch::acosh(x, out, n))
+CCMATH_BENCH_SCALING(atanh, double, -0.99, 0.99, ccm::batch::atanh(x, out, n))
+
+int main(int argc, char** argv)
+{ return ccm::bench::scaling_main(argc, argv); }
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double acos_rt(double v)
+	{ return ccm::rt::acos_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(trig, acos,
+	return std::acos(static_cast<double>(x)),
+	return ccm::acos(static_cast<double>(x)),
+	return acos_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double asin_rt(double v)
+	{ return ccm::rt::asin_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(trig, asin,
+	return std::asin(static_cast<double>(x)),
+	return ccm::asin(static_cast<double>(x)),
+	return asin_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double atan_rt(double v)
+	{ return ccm::rt::atan_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(trig, atan,
+	return std::atan(static_cast<double>(x)),
+	return ccm::atan(static_cast<double>(x)),
+	return atan_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double atan2_rt(double x, double y)
+	{ return ccm::rt::atan2_rt(x, y); }
+} // namespace
+
+CCMATH_BENCH_BINARY_COMPARE_PATHS(trig, atan2,
+	return std::atan2(static_cast<double>(x), static_cast<double>(y)),
+	return ccm::atan2(static_cast<double>(x), static_cast<double>(y)),
+	return atan2_rt(static_cast<double>(x), static_cast<double>(y)))
+
+BENCHMARK_MAIN();
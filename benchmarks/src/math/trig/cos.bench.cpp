@@ -0,0 +1,27 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double cos_rt(double v)
+	{ return ccm::rt::cos_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(trig, cos,
+	return std::cos(static_cast<double>(x)),
+	return ccm::cos(static_cast<double>(x)),
+	return cos_rt(static_cast<double>(x)))
+
+CCMATH_BENCH_UNARY_MODES(trig, cos, return std::cos(x), return ccm::cos(x))
+
+CCMATH_BENCH_UNARY_BATCH(trig, cos, return std::cos(x), return ccm::cos(x), ccm::batch::cos(in, out, n))
+
+CCMATH_BENCH_UNARY_PROFILE_STREAM(trig, cos, positive_finite_general, return std::cos(x), return ccm::cos(x))
+CCMATH_BENCH_UNARY_PROFILE_STREAM(trig, cos, huge_argument, return std::cos(x), return ccm::cos(x))
+CCMATH_BENCH_UNARY_PROFILE_STREAM(trig, cos, nan_inf_signed_zero, return std::cos(x), return ccm::cos(x))
+CCMATH_BENCH_UNARY_PATH_MIX(trig, cos, return std::cos(x), return ccm::cos(x))
+
+BENCHMARK_MAIN();
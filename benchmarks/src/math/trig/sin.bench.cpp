@@ -0,0 +1,27 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double sin_rt(double v)
+	{ return ccm::rt::sin_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(trig, sin,
+	return std::sin(static_cast<double>(x)),
+	return ccm::sin(static_cast<double>(x)),
+	return sin_rt(static_cast<double>(x)))
+
+CCMATH_BENCH_UNARY_MODES(trig, sin, return std::sin(x), return ccm::sin(x))
+
+CCMATH_BENCH_UNARY_BATCH(trig, sin, return std::sin(x), return ccm::sin(x), ccm::batch::sin(in, out, n))
+
+CCMATH_BENCH_UNARY_PROFILE_STREAM(trig, sin, positive_finite_general, return std::sin(x), return ccm::sin(x))
+CCMATH_BENCH_UNARY_PROFILE_STREAM(trig, sin, huge_argument, return std::sin(x), return ccm::sin(x))
+CCMATH_BENCH_UNARY_PROFILE_STREAM(trig, sin, nan_inf_signed_zero, return std::sin(x), return ccm::sin(x))
+CCMATH_BENCH_UNARY_PATH_MIX(trig, sin, return std::sin(x), return ccm::sin(x))
+
+BENCHMARK_MAIN();
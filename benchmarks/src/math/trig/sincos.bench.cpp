@@ -0,0 +1,36 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double sincos_rt(double v)
+	{
+		double s = 0.0;
+		double c = 0.0;
+		ccm::rt::sincos_rt(v, s, c);
+		return s + c;
+	}
+
+	inline double sincos_sum(double v)
+	{
+		double s = 0.0;
+		double c = 0.0;
+		ccm::sincos(v, &s, &c);
+		return s + c;
+	}
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(trig, sincos,
+	return std::sin(static_cast<double>(x)) + std::cos(static_cast<double>(x)),
+	double s = 0.0; double c = 0.0; ccm::sincos(static_cast<double>(x), &s, &c); return s + c,
+	return sincos_rt(static_cast<double>(x)))
+
+CCMATH_BENCH_UNARY_PROFILE_STREAM(trig, sincos, positive_finite_general, return std::sin(x) + std::cos(x), return sincos_sum(x))
+CCMATH_BENCH_UNARY_PROFILE_STREAM(trig, sincos, huge_argument, return std::sin(x) + std::cos(x), return sincos_sum(x))
+CCMATH_BENCH_UNARY_PROFILE_STREAM(trig, sincos, nan_inf_signed_zero, return std::sin(x) + std::cos(x), return sincos_sum(x))
+CCMATH_BENCH_UNARY_PATH_MIX(trig, sincos, return std::sin(x) + std::cos(x), return sincos_sum(x))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+#include "shared/register.hpp"
+
+#include <ccmath/ccmath.hpp>
+
+#include <cmath>
+
+namespace
+{
+	inline double tan_rt(double v)
+	{ return ccm::rt::tan_rt(v); }
+} // namespace
+
+CCMATH_BENCH_UNARY_COMPARE_PATHS(trig, tan,
+	return std::tan(static_cast<double>(x)),
+	return ccm::tan(static_cast<double>(x)),
+	return tan_rt(static_cast<double>(x)))
+
+BENCHMARK_MAIN();
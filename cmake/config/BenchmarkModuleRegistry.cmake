@@ -1,16 +1,36 @@
 # Declarative benchmark registry.
 # Add a function: drop benchmarks/src/math/<module>/<fn>.bench.cpp and append below.
 
-set(CCMATH_BENCH_MODULE_ORDER basic power nearest compare)
+set(CCMATH_BENCH_MODULE_ORDER basic compare expo fmanip hyper misc nearest power trig scaling)
 
-set(CCMATH_BENCH_MODULE_basic_FUNCTIONS abs fdim fma)
+set(CCMATH_BENCH_MODULE_basic_FUNCTIONS abs fdim fma fmax fmin fmod remainder remquo)
 set(CCMATH_BENCH_MODULE_basic_OPTION CCM_BENCH_BASIC)
 
-set(CCMATH_BENCH_MODULE_power_FUNCTIONS sqrt)
-set(CCMATH_BENCH_MODULE_power_OPTION CCM_BENCH_POWER)
+set(CCMATH_BENCH_MODULE_compare_FUNCTIONS
+        fpclassify isfinite isgreater isgreaterequal isinf isless islessequal islessgreater isnan isnormal isunordered signbit)
+set(CCMATH_BENCH_MODULE_compare_OPTION CCM_BENCH_COMPARE)
+
+set(CCMATH_BENCH_MODULE_expo_FUNCTIONS exp exp2 expm1 log log10 log1p log2)
+set(CCMATH_BENCH_MODULE_expo_OPTION CCM_BENCH_EXPO)
+
+set(CCMATH_BENCH_MODULE_fmanip_FUNCTIONS copysign frexp ilogb ldexp logb modf nextafter nextdown nexttoward nextup scalbn)
+set(CCMATH_BENCH_MODULE_fmanip_OPTION CCM_BENCH_FMANIP)
+
+set(CCMATH_BENCH_MODULE_hyper_FUNCTIONS acosh asinh atanh cosh sinh sinhcosh tanh)
+set(CCMATH_BENCH_MODULE_hyper_OPTION CCM_BENCH_HYPER)
 
-set(CCMATH_BENCH_MODULE_nearest_FUNCTIONS trunc)
+set(CCMATH_BENCH_MODULE_misc_FUNCTIONS gamma lerp lgamma)
+set(CCMATH_BENCH_MODULE_misc_OPTION CCM_BENCH_MISC)
+
+set(CCMATH_BENCH_MODULE_nearest_FUNCTIONS ceil floor nearbyint rint round trunc)
 set(CCMATH_BENCH_MODULE_nearest_OPTION CCM_BENCH_NEAREST)
 
-set(CCMATH_BENCH_MODULE_compare_FUNCTIONS)
-set(CCMATH_BENCH_MODULE_compare_OPTION CCM_BENCH_COMPARE)
+set(CCMATH_BENCH_MODULE_power_FUNCTIONS cbrt hypot pow sqrt)
+set(CCMATH_BENCH_MODULE_power_OPTION CCM_BENCH_POWER)
+
+set(CCMATH_BENCH_MODULE_trig_FUNCTIONS acos asin atan atan2 cos sin sincos tan)
+set(CCMATH_BENCH_MODULE_trig_OPTION CCM_BENCH_TRIG)
+
+# Multi-threaded scaling of the batch entry points, see benchmarks/shared/scaling.hpp.
+set(CCMATH_BENCH_MODULE_scaling_FUNCTIONS batch_scaling)
+set(CCMATH_BENCH_MODULE_scaling_OPTION CCM_BENCH_SCALING)
@@ -14,6 +14,7 @@ set(CCMATH_LIBRARY_MANIFEST_OPTION_KEYS
         disable_errno
         reduced_precision_powl
         deterministic
+        path_stats
 )
 
 set(CCMATH_LIBRARY_MANIFEST_OPTION_runtime_simd_CMAKE_VAR CCMATH_DISABLE_RUNTIME_SIMD)
@@ -46,7 +47,15 @@ set(CCMATH_LIBRARY_MANIFEST_OPTION_deterministic_CMAKE_INVERT FALSE)
 set(CCMATH_LIBRARY_MANIFEST_OPTION_deterministic_MESON_OPTION deterministic)
 set(CCMATH_LIBRARY_MANIFEST_OPTION_deterministic_DEFINE CCM_CONFIG_DETERMINISTIC)
 set(CCMATH_LIBRARY_MANIFEST_OPTION_deterministic_DESCRIPTION
-        "Produce bit-identical cross-hardware math: route transcendentals through the generic kernels (no libm), force the correctly-rounded FMA path, disable runtime SIMD, and evaluate long double in double precision (GCC/Clang)")
+        "Produce bit-identical cross-hardware math: route transcendentals through the generic kernels (no libm), force the correctly-rounded FMA path, keep runtime SIMD on its bit-identical kernels (no SVML), and evaluate long double in double precision (GCC/Clang)")
+
+set(CCMATH_LIBRARY_MANIFEST_OPTION_path_stats_CMAKE_VAR CCMATH_ENABLE_PATH_STATS)
+set(CCMATH_LIBRARY_MANIFEST_OPTION_path_stats_CMAKE_DEFAULT OFF)
+set(CCMATH_LIBRARY_MANIFEST_OPTION_path_stats_CMAKE_INVERT FALSE)
+set(CCMATH_LIBRARY_MANIFEST_OPTION_path_stats_MESON_OPTION enable_path_stats)
+set(CCMATH_LIBRARY_MANIFEST_OPTION_path_stats_DEFINE CCM_CONFIG_ENABLE_PATH_STATS)
+set(CCMATH_LIBRARY_MANIFEST_OPTION_path_stats_DESCRIPTION
+        "Count hits of the named pow, sin/cos and log kernel paths in relaxed atomic counters (ccm::path_stats); diagnostic builds only")
 
 function(ccmath_manifest_declare_library_options)
     foreach (_ccmath_manifest_key IN LISTS CCMATH_LIBRARY_MANIFEST_OPTION_KEYS)
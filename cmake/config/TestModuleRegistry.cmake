@@ -7,7 +7,9 @@ set(CCMATH_UNIT_MODULE_basic_EXCLUDE
         src/math/basic/fma_constexpr_upward_config_test.cpp)
 set(CCMATH_UNIT_MODULE_compare ccmath-simple-compare)
 set(CCMATH_UNIT_MODULE_expo ccmath-simple-exponential)
+set(CCMATH_UNIT_MODULE_fast ccmath-simple-fast)
 set(CCMATH_UNIT_MODULE_fmanip ccmath-simple-fmanip)
+set(CCMATH_UNIT_MODULE_hyper ccmath-simple-hyperbolic)
 set(CCMATH_UNIT_MODULE_nearest ccmath-simple-nearest)
 set(CCMATH_UNIT_MODULE_power ccmath-simple-power)
 set(CCMATH_UNIT_MODULE_trig ccmath-simple-trigonometric)
@@ -19,7 +21,9 @@ set(CCMATH_UNIT_MATH_MODULE_ORDER
         basic
         compare
         expo
+        fast
         fmanip
+        hyper
         nearest
         power
         trig
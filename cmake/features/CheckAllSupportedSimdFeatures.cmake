@@ -7,7 +7,9 @@ endif ()
 include(${CCMATH_ROOT_DIR}/cmake/features/simd/SelectSimdInstructionSet.cmake)
 
 include(${CCMATH_ROOT_DIR}/cmake/features/simd/CheckFMASupport.cmake)
+include(${CCMATH_ROOT_DIR}/cmake/features/simd/CheckAVX512Support.cmake)
 
-if (NOT CCMATH_DISABLE_SVML_USAGE)
+# SVML results differ from the generic kernels, so deterministic builds never use it.
+if (NOT CCMATH_DISABLE_SVML_USAGE AND NOT CCMATH_ENABLE_DETERMINISTIC)
     include(${CCMATH_ROOT_DIR}/cmake/features/simd/CheckSVMLSupport.cmake)
 endif ()
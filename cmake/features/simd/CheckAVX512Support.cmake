@@ -0,0 +1,19 @@
+include(CheckCXXSourceCompiles)
+
+# AVX-512 is never assumed by default (see SelectSimdInstructionSet.cmake), so this
+# only passes when the toolchain flags already target it, e.g. -march=native on a
+# Xeon or -march=x86-64-v4. The probe also uses a k-register mask so toolchains
+# with only partial AVX-512 headers are rejected.
+check_cxx_source_compiles("
+        #include <immintrin.h>
+        int main() {
+            __m512 value = _mm512_set1_ps(1.0f);
+            __mmask16 mask = _mm512_cmp_ps_mask(value, _mm512_setzero_ps(), _CMP_GT_OQ);
+            value = _mm512_mask_add_ps(value, mask, value, value);
+            return static_cast<int>(_mm512_reduce_add_ps(value));
+        }
+    " CCMATH_SIMD_HAS_AVX512F_SUPPORT)
+
+if (CCMATH_SIMD_HAS_AVX512F_SUPPORT)
+  add_compile_definitions(CCM_CONFIG_RT_SIMD_HAS_AVX512F)
+endif ()
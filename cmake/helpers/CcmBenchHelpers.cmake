@@ -24,6 +24,142 @@ function(ccmath_bench_module_enabled MODULE OUT_VAR)
     endif ()
 endfunction()
 
+# C++ literal for one entry of an asmlab "choice" input list.
+function(ccmath_bench_profile_literal VALUE OUT_VAR)
+    if (VALUE STREQUAL "nan")
+        set(_literal "std::numeric_limits<double>::quiet_NaN()")
+    elseif (VALUE STREQUAL "inf")
+        set(_literal "std::numeric_limits<double>::infinity()")
+    elseif (VALUE STREQUAL "-inf")
+        set(_literal "-std::numeric_limits<double>::infinity()")
+    elseif (VALUE MATCHES "^-?[0-9]+$")
+        set(_literal "${VALUE}.0")
+    else ()
+        set(_literal "${VALUE}")
+    endif ()
+    set(${OUT_VAR} "${_literal}" PARENT_SCOPE)
+endfunction()
+
+# Initializer for the dist_spec of argument ARG of a profile's "inputs" object.
+function(ccmath_bench_profile_dist JSON PROFILE ARG OUT_VAR)
+    string(JSON _kind ERROR_VARIABLE _missing GET "${JSON}" profiles ${PROFILE} inputs ${ARG} kind)
+    if (_missing)
+        set(${OUT_VAR} "{ dist_kind::uniform, 0.0, 1.0, {}, 0 }" PARENT_SCOPE)
+        return ()
+    endif ()
+
+    if (_kind STREQUAL "choice")
+        string(JSON _count LENGTH "${JSON}" profiles ${PROFILE} inputs ${ARG} values)
+        if (_count GREATER 8)
+            message(FATAL_ERROR "benchmark profile ${PROFILE}.${ARG}: at most 8 choice values")
+        endif ()
+        set(_values "")
+        math(EXPR _last "${_count} - 1")
+        foreach (_i RANGE ${_last})
+            string(JSON _value GET "${JSON}" profiles ${PROFILE} inputs ${ARG} values ${_i})
+            ccmath_bench_profile_literal("${_value}" _literal)
+            list(APPEND _values "${_literal}")
+        endforeach ()
+        list(JOIN _values ", " _values)
+        set(${OUT_VAR} "{ dist_kind::choice, 0.0, 0.0, { ${_values} }, ${_count} }" PARENT_SCOPE)
+    elseif (_kind MATCHES "^(uniform|log_uniform|integer)$")
+        string(JSON _min GET "${JSON}" profiles ${PROFILE} inputs ${ARG} min)
+        string(JSON _max GET "${JSON}" profiles ${PROFILE} inputs ${ARG} max)
+        ccmath_bench_profile_literal("${_min}" _min)
+        ccmath_bench_profile_literal("${_max}" _max)
+        set(${OUT_VAR} "{ dist_kind::${_kind}, ${_min}, ${_max}, {}, 0 }" PARENT_SCOPE)
+    else ()
+        message(FATAL_ERROR "benchmark profile ${PROFILE}.${ARG}: unknown input kind '${_kind}'")
+    endif ()
+endfunction()
+
+# Writes ${OUT_DIR}/bench_profiles.gen.hpp from asmlab's benchmark_profiles.json: one profile_spec per
+# profile with an "inputs" object, and the path_mix weights. Profiles named by path_scenarios.json
+# must exist in benchmark_profiles.json.
+function(ccmath_generate_bench_profiles OUT_DIR)
+    set(_registry "${CCMATH_BENCH_ROOT}/../tools/asmlab/registry")
+    set(_profiles_json "${_registry}/benchmark_profiles.json")
+    set(_scenarios_json "${_registry}/path_scenarios.json")
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${_profiles_json}" "${_scenarios_json}")
+
+    file(READ "${_profiles_json}" _json)
+    string(JSON _profile_count LENGTH "${_json}" profiles)
+    math(EXPR _last "${_profile_count} - 1")
+    set(_profiles "")
+    set(_names "")
+    foreach (_i RANGE ${_last})
+        string(JSON _name MEMBER "${_json}" profiles ${_i})
+        list(APPEND _names ${_name})
+        string(JSON _inputs ERROR_VARIABLE _missing GET "${_json}" profiles ${_name} inputs)
+        if (_missing)
+            continue ()
+        endif ()
+        string(JSON _mode ERROR_VARIABLE _missing GET "${_json}" profiles ${_name} mode_default)
+        if (_mode STREQUAL "latency")
+            set(_latency true)
+        else ()
+            set(_latency false)
+        endif ()
+        ccmath_bench_profile_dist("${_json}" ${_name} x _x)
+        ccmath_bench_profile_dist("${_json}" ${_name} y _y)
+        string(APPEND _profiles "\t\t{ \"${_name}\", ${_latency}, ${_x}, ${_y} },\n")
+    endforeach ()
+
+    set(_mixes "")
+    string(JSON _mix_count ERROR_VARIABLE _missing LENGTH "${_json}" path_mix)
+    if (NOT _missing AND _mix_count GREATER 0)
+        math(EXPR _last "${_mix_count} - 1")
+        foreach (_i RANGE ${_last})
+            string(JSON _function MEMBER "${_json}" path_mix ${_i})
+            if (_function MATCHES "^_")
+                continue ()
+            endif ()
+            string(JSON _entry_count LENGTH "${_json}" path_mix ${_function})
+            math(EXPR _entry_last "${_entry_count} - 1")
+            foreach (_j RANGE ${_entry_last})
+                string(JSON _profile MEMBER "${_json}" path_mix ${_function} ${_j})
+                string(JSON _weight GET "${_json}" path_mix ${_function} ${_profile})
+                if (NOT _profile IN_LIST _names)
+                    message(FATAL_ERROR "benchmark_profiles.json: path_mix.${_function} names unknown profile '${_profile}'")
+                endif ()
+                string(APPEND _mixes "\t\t{ \"${_function}\", \"${_profile}\", ${_weight} },\n")
+            endforeach ()
+        endforeach ()
+    endif ()
+
+    file(READ "${_scenarios_json}" _scenarios)
+    string(JSON _function_count LENGTH "${_scenarios}" scenarios)
+    math(EXPR _last "${_function_count} - 1")
+    foreach (_i RANGE ${_last})
+        string(JSON _function MEMBER "${_scenarios}" scenarios ${_i})
+        string(JSON _scenario_count LENGTH "${_scenarios}" scenarios ${_function})
+        math(EXPR _scenario_last "${_scenario_count} - 1")
+        foreach (_j RANGE ${_scenario_last})
+            string(JSON _scenario MEMBER "${_scenarios}" scenarios ${_function} ${_j})
+            string(JSON _profile ERROR_VARIABLE _missing GET "${_scenarios}" scenarios ${_function} ${_scenario} input_profile)
+            if (NOT _missing AND NOT _profile IN_LIST _names)
+                message(FATAL_ERROR "path_scenarios.json: ${_function}.${_scenario} names unknown profile '${_profile}'")
+            endif ()
+        endforeach ()
+    endforeach ()
+
+    file(CONFIGURE OUTPUT "${OUT_DIR}/bench_profiles.gen.hpp" CONTENT [=[
+#pragma once
+
+// Generated by ccmath_generate_bench_profiles() from tools/asmlab/registry/benchmark_profiles.json.
+
+namespace ccm::bench
+{
+	inline constexpr profile_spec k_profiles[] = {
+@_profiles@	};
+
+	inline constexpr mix_entry k_path_mix[] = {
+@_mixes@		{ nullptr, nullptr, 0.0 },
+	};
+} // namespace ccm::bench
+]=] @ONLY)
+endfunction()
+
 function(ccmath_add_bench_target FUNCTION)
     set(options)
     set(oneValueArgs MODULE)
@@ -41,7 +177,7 @@ function(ccmath_add_bench_target FUNCTION)
     set(_target ccm_benchmark_${FUNCTION})
     add_executable(${_target} ${CCM_SOURCES})
     target_link_libraries(${_target} PRIVATE ccmath::ccmath benchmark::benchmark)
-    target_include_directories(${_target} PRIVATE "${CCMATH_BENCH_ROOT}/shared" "${CCMATH_BENCH_ROOT}")
+    target_include_directories(${_target} PRIVATE "${CCMATH_BENCH_ROOT}/shared" "${CCMATH_BENCH_ROOT}" "${CMAKE_BINARY_DIR}/generated/bench")
     target_compile_features(${_target} PRIVATE cxx_std_17)
 
     if (CCM_COMPILE_DEFINITIONS)
@@ -56,6 +192,8 @@ function(ccmath_apply_bench_registry)
         message(FATAL_ERROR "ccmath_apply_bench_registry requires benchmark::benchmark")
     endif ()
 
+    ccmath_generate_bench_profiles("${CMAKE_BINARY_DIR}/generated/bench")
+
     set(_all_targets "")
     foreach (_module IN LISTS CCMATH_BENCH_MODULE_ORDER)
         ccmath_bench_module_enabled(${_module} _enabled)
@@ -13,12 +13,18 @@
 /// Basic math func
 #include "math/basic.hpp"
 
+/// Batch func
+#include "math/batch.hpp"
+
 /// Comparison func
 #include "math/compare.hpp"
 
 /// Exponential func
 #include "math/expo.hpp"
 
+/// Fast tier func
+#include "math/fast.hpp"
+
 /// Float manipulation func
 #include "math/fmanip.hpp"
 
@@ -38,6 +44,9 @@
 #include "math/trig.hpp"
 
 /// Uncategorized func
+#include "ccmath/math/misc/assume_round_to_nearest.hpp"
 #include "ccmath/math/misc/gamma.hpp"
 #include "ccmath/math/misc/lerp.hpp"
 #include "ccmath/math/misc/lgamma.hpp"
+#include "ccmath/math/misc/path_stats.hpp"
+#include "ccmath/math/misc/suppress_math_side_effects.hpp"
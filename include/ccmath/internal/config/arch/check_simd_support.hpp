@@ -15,6 +15,7 @@
  * 			- SSE4.1
  * 			- SSE4.2
  * 			- AVX2
+ * 			- AVX-512F
  *
  * 		ARM:
  * 			- NEON
@@ -64,6 +65,14 @@
 		#define CCMATH_HAS_SIMD_AVX2 1
 	#endif
 
+// Advanced Vector Extensions 512 Foundation (AVX-512F)
+	#if defined(__AVX512F__) || defined(CCM_CONFIG_RT_SIMD_HAS_AVX512F)
+		#ifndef CCMATH_HAS_SIMD
+			#define CCMATH_HAS_SIMD 1
+		#endif
+		#define CCMATH_HAS_SIMD_AVX512F 1
+	#endif
+
 // FMA (Fused Multiply-Add) Extensions
 	#if defined(__FMA__) || defined(CCM_CONFIG_RT_SIMD_HAS_FMA)
 		#ifndef CCMATH_HAS_SIMD
@@ -74,7 +83,8 @@
 
 // Intel Short Vector Math Library (SVML)
 // As far as I am aware, there is no reliable way to detect SVML support at compile-time.
-	#if defined(CCM_CONFIG_RT_SIMD_HAS_SVML)
+// Deterministic builds never use it: its results differ from the generic kernels and between releases.
+	#if defined(CCM_CONFIG_RT_SIMD_HAS_SVML) && !defined(CCM_CONFIG_DETERMINISTIC)
 		#ifndef CCMATH_HAS_SIMD
 			#define CCMATH_HAS_SIMD 1
 		#endif
@@ -82,7 +92,9 @@
 	#endif
 
 // ARM Advanced SIMD (NEON)
-	#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(CCM_CONFIG_RT_SIMD_HAS_NEON)
+// AArch32 NEON flushes subnormals to zero, so deterministic builds only take NEON on AArch64.
+	#if (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(CCM_CONFIG_RT_SIMD_HAS_NEON)) &&                                                              \
+		(!defined(CCM_CONFIG_DETERMINISTIC) || defined(__aarch64__) || defined(_M_ARM64))
 		#ifndef CCMATH_HAS_SIMD
 			#define CCMATH_HAS_SIMD 1
 		#endif
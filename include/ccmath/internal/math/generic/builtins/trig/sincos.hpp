@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "ccmath/internal/math/generic/builtins/builtin_helpers.hpp"
+#include "ccmath/internal/support/always_false.hpp"
+
+#include <type_traits>
+
+/// CCMATH_HAS_BUILTIN_SINCOS
+/// This is a macro that is defined if the compiler has runtime __builtin functions for sincos.
+/// Where the C library has no sincos, the compiler lowers the builtin to separate sin and cos calls.
+///
+/// Compilers with Support:
+/// - GCC
+/// - Clang
+
+#ifndef CCMATH_HAS_BUILTIN_SINCOS
+	#if defined(__GNUC__) && !defined(__clang__)
+		#define CCMATH_HAS_BUILTIN_SINCOS
+	#elif defined(__clang__) && defined(__has_builtin)
+		#if __has_builtin(__builtin_sincos)
+			#define CCMATH_HAS_BUILTIN_SINCOS
+		#endif
+	#endif
+#endif
+
+namespace ccm::builtin
+{
+	// clang-format off
+	/**
+	 * @internal
+	 */
+	template <typename T>
+	inline constexpr bool has_runtime_sincos =
+#ifdef CCMATH_HAS_BUILTIN_SINCOS
+		is_valid_transcendental_builtin_type<T>;
+#else
+		false;
+#endif
+	// clang-format on
+
+	/**
+	 * @internal
+	 * Wrapper for runtime __builtin_sincos functions.
+	 * This should be used internally and always be wrapped in an if constexpr statement.
+	 */
+	template <typename T>
+	auto sincos_rt(T x, T & sin_out, T & cos_out) -> std::enable_if_t<has_runtime_sincos<T>>
+	{
+		if constexpr (std::is_same_v<T, float>) { __builtin_sincosf(x, &sin_out, &cos_out); }
+		else if constexpr (std::is_same_v<T, double>) { __builtin_sincos(x, &sin_out, &cos_out); }
+		else if constexpr (std::is_same_v<T, long double>) { __builtin_sincosl(x, &sin_out, &cos_out); }
+		else
+		{
+			// This should never be reached
+			static_assert(ccm::support::always_false<T>, "Unsupported type for sincos");
+		}
+	}
+} // namespace ccm::builtin
+
+// Cleanup the global namespace
+#undef CCMATH_HAS_BUILTIN_SINCOS
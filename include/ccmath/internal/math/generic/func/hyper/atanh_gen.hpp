@@ -10,7 +10,20 @@
 
 #pragma once
 
-namespace ccm
-{
+#include "ccmath/internal/math/generic/func/hyper/impl/inv_hyper_impl.hpp"
+
+#include <type_traits>
 
-} // namespace ccm
+namespace ccm::gen
+{
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T atanh_gen(T num) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::atanh_impl(num); }
+		else if constexpr (std::is_same_v<T, double>) { return ccm::internal::impl::atanh_impl(num); }
+		else
+		{
+			return static_cast<T>(ccm::internal::impl::atanh_impl(static_cast<double>(num)));
+		}
+	}
+} // namespace ccm::gen
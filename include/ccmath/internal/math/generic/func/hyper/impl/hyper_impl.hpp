@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// sinh, cosh and tanh on top of exp_double_impl. Below |x| = 1 the kernels sum
+// the Taylor series of sinh and cosh, truncated below the last bit, and
+// so avoid the cancellation of e^x - e^-x near zero; tanh adds to x the
+// small quotient (sinh(x) - x cosh(x)) / cosh(x), summed the same way.
+// From 1 on they take e = exp(|x|) once and work with e and 1 / e, dropping
+// 1 / e past 22, where it no longer reaches the last bit. Past the overflow
+// threshold of exp, sinh and cosh are (e^(|x|/2) / 2) * e^(|x|/2), which
+// overflows exactly where the result does. The three stay within 1.6 ulp,
+// and sinh and cosh within 2 ulp past that threshold; sinhcosh shares the one
+// exp between sinh and cosh. The float kernels evaluate the double ones on the
+// widened input and round once, within a hair of correct rounding, and
+// hyper_simd_impl.hpp replays all of them operation for operation.
+
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/math/expo/impl/exp_double_impl.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace ccm::internal::impl
+{
+	namespace hyper_detail
+	{
+		// Below k_tiny, sinh(x) and tanh(x) round to x and cosh(x) to 1.
+		inline constexpr double k_tiny = 0x1p-26;
+		// From k_exp_min the kernels go through exp; below it, through the series.
+		inline constexpr double k_exp_min = 1.0;
+		// From k_drop_inv the 1 / e term is below the last bit of e, and tanh(x) rounds to +-1.
+		inline constexpr double k_drop_inv = 22.0;
+		// log(2^1024): from here exp(|x|) overflows.
+		inline constexpr double k_exp_max = 0x1.62e42fefa39efp+9;
+
+		// 1 / (2k + 1)! and 1 / (2k)! for k = 1, 2, ...
+		inline constexpr double k_sinh_poly[9] = { 0x1.5555555555555p-3,  0x1.1111111111111p-7,	 0x1.a01a01a01a01ap-13,
+												   0x1.71de3a556c734p-19, 0x1.ae64567f544e4p-26, 0x1.6124613a86d09p-33,
+												   0x1.ae7f3e733b81fp-41, 0x1.952c77030ad4ap-49, 0x1.2f49b46814157p-57 };
+		inline constexpr double k_cosh_poly[10] = { 0x1p-1,				   0x1.5555555555555p-5,  0x1.6c16c16c16c17p-10, 0x1.a01a01a01a01ap-16,
+													0x1.27e4fb7789f5cp-22, 0x1.1eed8eff8d898p-29, 0x1.93974a8c07c9dp-37, 0x1.ae7f3e733b81fp-45,
+													0x1.6827863b97d97p-53, 0x1.e542ba4020225p-62 };
+
+		// 1 / (2k + 1)! - 1 / (2k)!, the difference of the two above term by term.
+		inline constexpr double k_tanh_poly[10] = { -0x1.5555555555555p-2,  -0x1.1111111111111p-5,  -0x1.3813813813814p-10, -0x1.71de3a556c734p-16,
+													-0x1.0cfeb60f94b0ep-22, -0x1.08db48ebe51c7p-29, -0x1.78af56a4d411bp-37, -0x1.952c77030ad4ap-45,
+													-0x1.5532eaf516982p-53, -0x1.e542ba4020225p-62 };
+
+		// sinh(a) - a over a^3 as a polynomial in z = a^2.
+		constexpr double sinh_tail(double z) noexcept
+		{
+			double p = k_sinh_poly[8];
+			for (int i = 7; i >= 0; --i) { p = k_sinh_poly[i] + z * p; }
+			return p;
+		}
+
+		// cosh(a) - 1 over a^2 as a polynomial in z = a^2.
+		constexpr double cosh_tail(double z) noexcept
+		{
+			double p = k_cosh_poly[9];
+			for (int i = 8; i >= 0; --i) { p = k_cosh_poly[i] + z * p; }
+			return p;
+		}
+
+		// (sinh(a) - a cosh(a)) / a^3 as a polynomial in z = a^2.
+		constexpr double tanh_tail(double z) noexcept
+		{
+			double p = k_tanh_poly[9];
+			for (int i = 8; i >= 0; --i) { p = k_tanh_poly[i] + z * p; }
+			return p;
+		}
+
+		// sinh(a), cosh(a) and tanh(a) for k_tiny <= a < k_exp_min.
+		constexpr double sinh_series(double a) noexcept
+		{
+			const double z = a * a;
+			return a + a * (z * sinh_tail(z));
+		}
+
+		constexpr double cosh_series(double a) noexcept
+		{
+			const double z = a * a;
+			return 1.0 + z * cosh_tail(z);
+		}
+
+		// tanh(a) = a + (sinh(a) - a cosh(a)) / cosh(a), so only the small correction carries rounding.
+		constexpr double tanh_series(double a) noexcept
+		{
+			const double z = a * a;
+			return a + a * ((z * tanh_tail(z)) / (1.0 + z * cosh_tail(z)));
+		}
+
+		// (e^(a/2) / 2) * e^(a/2) for a >= k_exp_max: the halves of sinh(a) and cosh(a) that do not overflow early.
+		constexpr double half_exp_squared(double a) noexcept
+		{
+			const double w = exp_double_impl(0.5 * a);
+			return (0.5 * w) * w;
+		}
+
+		// The bits of |x|, which order like |x| and leave NaN above infinity without a comparison that could raise.
+		constexpr std::uint64_t abs_bits(double x) noexcept
+		{ return support::double_to_uint64(x) & 0x7fff'ffff'ffff'ffffULL; }
+
+		inline constexpr std::uint64_t k_inf_bits		= 0x7ff0'0000'0000'0000ULL;
+		inline constexpr std::uint64_t k_tiny_bits		= support::double_to_uint64(k_tiny);
+		inline constexpr std::uint64_t k_exp_min_bits	= support::double_to_uint64(k_exp_min);
+		inline constexpr std::uint64_t k_drop_inv_bits	= support::double_to_uint64(k_drop_inv);
+		inline constexpr std::uint64_t k_exp_max_bits	= support::double_to_uint64(k_exp_max);
+	} // namespace hyper_detail
+
+	constexpr double sinh_double_impl(double x) noexcept
+	{
+		const std::uint64_t a_bits = hyper_detail::abs_bits(x);
+		const double a			   = support::uint64_to_double(a_bits);
+
+		// NaN, infinities and the overflow range; sinh(+-inf) = +-inf.
+		if (CCM_UNLIKELY(a_bits >= hyper_detail::k_exp_max_bits))
+		{
+			if (a_bits > hyper_detail::k_inf_bits) { return x + x; }
+			const double h = hyper_detail::half_exp_squared(a);
+			return x < 0.0 ? -h : h;
+		}
+		if (a_bits < hyper_detail::k_tiny_bits) { return x; }
+
+		double s = 0.0;
+		if (a_bits < hyper_detail::k_exp_min_bits) { s = hyper_detail::sinh_series(a); }
+		else
+		{
+			const double e = exp_double_impl(a);
+			s			   = a_bits < hyper_detail::k_drop_inv_bits ? 0.5 * (e - 1.0 / e) : 0.5 * e;
+		}
+		return x < 0.0 ? -s : s;
+	}
+
+	constexpr double cosh_double_impl(double x) noexcept
+	{
+		const std::uint64_t a_bits = hyper_detail::abs_bits(x);
+		const double a			   = support::uint64_to_double(a_bits);
+
+		if (CCM_UNLIKELY(a_bits >= hyper_detail::k_exp_max_bits))
+		{
+			if (a_bits > hyper_detail::k_inf_bits) { return x + x; }
+			return hyper_detail::half_exp_squared(a);
+		}
+		if (a_bits < hyper_detail::k_tiny_bits) { return 1.0; }
+		if (a_bits < hyper_detail::k_exp_min_bits) { return hyper_detail::cosh_series(a); }
+
+		const double e = exp_double_impl(a);
+		return a_bits < hyper_detail::k_drop_inv_bits ? 0.5 * (e + 1.0 / e) : 0.5 * e;
+	}
+
+	constexpr double tanh_double_impl(double x) noexcept
+	{
+		const std::uint64_t a_bits = hyper_detail::abs_bits(x);
+		const double a			   = support::uint64_to_double(a_bits);
+
+		// NaN, and the range where tanh(x) rounds to +-1.
+		if (CCM_UNLIKELY(a_bits >= hyper_detail::k_drop_inv_bits))
+		{
+			if (a_bits > hyper_detail::k_inf_bits) { return x + x; }
+			return x < 0.0 ? -1.0 : 1.0;
+		}
+		if (a_bits < hyper_detail::k_tiny_bits) { return x; }
+
+		double t = 0.0;
+		if (a_bits < hyper_detail::k_exp_min_bits) { t = hyper_detail::tanh_series(a); }
+		else
+		{
+			// 1 - 2 / (e^2a + 1), with no cancellation for a >= 1.
+			const double e2 = exp_double_impl(a + a);
+			t				= 1.0 - 2.0 / (e2 + 1.0);
+		}
+		return x < 0.0 ? -t : t;
+	}
+
+	// sinh(x) and cosh(x) from one exp.
+	constexpr void sinhcosh_double_impl(double x, double & sinh_out, double & cosh_out) noexcept
+	{
+		const std::uint64_t a_bits = hyper_detail::abs_bits(x);
+		const double a			   = support::uint64_to_double(a_bits);
+
+		if (CCM_UNLIKELY(a_bits >= hyper_detail::k_exp_max_bits))
+		{
+			if (a_bits > hyper_detail::k_inf_bits)
+			{
+				sinh_out = x + x;
+				cosh_out = x + x;
+				return;
+			}
+			const double h = hyper_detail::half_exp_squared(a);
+			sinh_out	   = x < 0.0 ? -h : h;
+			cosh_out	   = h;
+			return;
+		}
+		if (a_bits < hyper_detail::k_tiny_bits)
+		{
+			sinh_out = x;
+			cosh_out = 1.0;
+			return;
+		}
+
+		double s = 0.0;
+		if (a_bits < hyper_detail::k_exp_min_bits)
+		{
+			s		 = hyper_detail::sinh_series(a);
+			cosh_out = hyper_detail::cosh_series(a);
+		}
+		else
+		{
+			const double e = exp_double_impl(a);
+			if (a_bits < hyper_detail::k_drop_inv_bits)
+			{
+				const double r = 1.0 / e;
+				s			   = 0.5 * (e - r);
+				cosh_out	   = 0.5 * (e + r);
+			}
+			else
+			{
+				s		 = 0.5 * e;
+				cosh_out = s;
+			}
+		}
+		sinh_out = x < 0.0 ? -s : s;
+	}
+
+	constexpr float sinh_float_impl(float x) noexcept
+	{ return static_cast<float>(sinh_double_impl(static_cast<double>(x))); }
+
+	constexpr float cosh_float_impl(float x) noexcept
+	{ return static_cast<float>(cosh_double_impl(static_cast<double>(x))); }
+
+	constexpr float tanh_float_impl(float x) noexcept
+	{ return static_cast<float>(tanh_double_impl(static_cast<double>(x))); }
+
+	constexpr void sinhcosh_float_impl(float x, float & sinh_out, float & cosh_out) noexcept
+	{
+		double s = 0.0;
+		double c = 0.0;
+		sinhcosh_double_impl(static_cast<double>(x), s, c);
+		sinh_out = static_cast<float>(s);
+		cosh_out = static_cast<float>(c);
+	}
+
+	template <typename T>
+	constexpr T sinh_impl(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return sinh_float_impl(x); }
+		else
+		{
+			return static_cast<T>(sinh_double_impl(static_cast<double>(x)));
+		}
+	}
+
+	template <typename T>
+	constexpr T cosh_impl(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return cosh_float_impl(x); }
+		else
+		{
+			return static_cast<T>(cosh_double_impl(static_cast<double>(x)));
+		}
+	}
+
+	template <typename T>
+	constexpr T tanh_impl(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return tanh_float_impl(x); }
+		else
+		{
+			return static_cast<T>(tanh_double_impl(static_cast<double>(x)));
+		}
+	}
+
+	template <typename T>
+	constexpr void sinhcosh_impl(T x, T & sinh_out, T & cosh_out) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { sinhcosh_float_impl(x, sinh_out, cosh_out); }
+		else
+		{
+			double s = 0.0;
+			double c = 0.0;
+			sinhcosh_double_impl(static_cast<double>(x), s, c);
+			sinh_out = static_cast<T>(s);
+			cosh_out = static_cast<T>(c);
+		}
+	}
+} // namespace ccm::internal::impl
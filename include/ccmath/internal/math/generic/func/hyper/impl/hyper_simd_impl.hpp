@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized sinh, cosh, tanh and sinhcosh. The kernels replay hyper_impl.hpp
+// operation for operation, with exp through exp_simd_impl, so every lane is
+// bit identical to the scalar kernel. Each branch of the scalar kernel runs on
+// all lanes and the result is selected per lane; lanes a branch does not own
+// run it on a benign value, so they raise nothing the scalar kernel does not.
+// The overflow branch only runs when some lane needs it.
+
+#include "ccmath/internal/math/generic/func/hyper/impl/hyper_impl.hpp"
+#include "ccmath/internal/math/runtime/pp/conversion.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/math/expo/impl/exp_simd_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	namespace hyper_detail
+	{
+		template <typename Abi, std::size_t N>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_horner(pp::basic_simd<double, Abi> const & z, double const (&poly)[N]) noexcept
+		{
+			using DVec = pp::basic_simd<double, Abi>;
+			DVec p	   = DVec(poly[N - 1]);
+			for (std::size_t i = N - 1; i-- > 0;) { p = DVec(poly[i]) + z * p; }
+			return p;
+		}
+
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_sinh_series(pp::basic_simd<double, Abi> const & a) noexcept
+		{
+			const auto z = a * a;
+			return a + a * (z * lane_horner(z, k_sinh_poly));
+		}
+
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_cosh_series(pp::basic_simd<double, Abi> const & a) noexcept
+		{
+			using DVec = pp::basic_simd<double, Abi>;
+			const auto z = a * a;
+			return DVec(1.0) + z * lane_horner(z, k_cosh_poly);
+		}
+
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_tanh_series(pp::basic_simd<double, Abi> const & a) noexcept
+		{
+			using DVec = pp::basic_simd<double, Abi>;
+			const auto z = a * a;
+			return a + a * ((z * lane_horner(z, k_tanh_poly)) / (DVec(1.0) + z * lane_horner(z, k_cosh_poly)));
+		}
+
+		// The lanes of a split the way the scalar kernels branch on |x|.
+		template <typename Abi>
+		struct lane_ranges
+		{
+			pp::basic_simd<double, Abi> a;
+			pp::basic_simd<std::uint64_t, Abi> sign;
+			pp::basic_simd_mask<sizeof(double), Abi> nan;
+			pp::basic_simd_mask<sizeof(double), Abi> tiny;
+			pp::basic_simd_mask<sizeof(double), Abi> series;
+			pp::basic_simd_mask<sizeof(double), Abi> drop_inv;
+			pp::basic_simd_mask<sizeof(double), Abi> big;
+		};
+
+		template <typename Abi>
+		CCM_ALWAYS_INLINE lane_ranges<Abi> lane_classify(pp::basic_simd<double, Abi> const & x) noexcept
+		{
+			using U64			= pp::basic_simd<std::uint64_t, Abi>;
+			const U64 x_bits	= pp::simd_bit_cast<std::uint64_t>(x);
+			const U64 a_bits	= x_bits & U64(0x7fff'ffff'ffff'ffffULL);
+			const auto tiny		= a_bits < U64(k_tiny_bits);
+			return { pp::simd_bit_cast<double>(a_bits),
+					 x_bits & U64(0x8000'0000'0000'0000ULL),
+					 a_bits > U64(k_inf_bits),
+					 tiny,
+					 (a_bits < U64(k_exp_min_bits)) & ~tiny,
+					 a_bits >= U64(k_drop_inv_bits),
+					 a_bits >= U64(k_exp_max_bits) };
+		}
+
+		// -v on the lanes with the sign bit set, as the scalar kernels negate a non-negative result for negative x.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_with_sign(pp::basic_simd<double, Abi> const & v, pp::basic_simd<std::uint64_t, Abi> const & sign) noexcept
+		{ return pp::simd_bit_cast<double>(pp::simd_bit_cast<std::uint64_t>(v) | sign); }
+
+		// half_exp_squared on the overflow lanes, and v elsewhere.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_overflow_or(lane_ranges<Abi> const & r, pp::basic_simd<double, Abi> const & v) noexcept
+		{
+			using DVec = pp::basic_simd<double, Abi>;
+			if (!pp::any_of(r.big)) { return v; }
+			const DVec w = exp_simd_impl(DVec(0.5) * pp::simd_select(r.big & ~r.nan, r.a, DVec(0.0)));
+			return pp::simd_select(r.big, (DVec(0.5) * w) * w, v);
+		}
+
+		// x + x on the NaN lanes, and v elsewhere.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_nan_or(lane_ranges<Abi> const & r, pp::basic_simd<double, Abi> const & x,
+																  pp::basic_simd<double, Abi> const & v) noexcept
+		{
+			using DVec = pp::basic_simd<double, Abi>;
+			if (!pp::any_of(r.nan)) { return v; }
+			const DVec xn = pp::simd_select(r.nan, x, DVec(0.0));
+			return pp::simd_select(r.nan, xn + xn, v);
+		}
+
+		// The exp branch's e = exp(|x|) on the lanes between the series and the overflow range, exp(1) elsewhere.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_exp_of_abs(lane_ranges<Abi> const & r) noexcept
+		{
+			using DVec = pp::basic_simd<double, Abi>;
+			return exp_simd_impl(pp::simd_select(r.series | r.tiny | r.big, DVec(1.0), r.a));
+		}
+	} // namespace hyper_detail
+
+	// sinh(x) for vectors of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> sinh_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec	 = pp::basic_simd<double, Abi>;
+		const auto r = hyper_detail::lane_classify(x);
+
+		const DVec ser = hyper_detail::lane_sinh_series(pp::simd_select(r.series, r.a, DVec(0.5)));
+		const DVec e   = hyper_detail::lane_exp_of_abs(r);
+		const DVec inv = DVec(1.0) / pp::simd_select(r.drop_inv, DVec(1.0), e);
+		DVec s		   = pp::simd_select(r.drop_inv, DVec(0.5) * e, DVec(0.5) * (e - inv));
+		s			   = hyper_detail::lane_overflow_or(r, pp::simd_select(r.series, ser, s));
+		s			   = pp::simd_select(r.tiny, x, hyper_detail::lane_with_sign(s, r.sign));
+		return hyper_detail::lane_nan_or(r, x, s);
+	}
+
+	// cosh(x) for vectors of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> cosh_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec	 = pp::basic_simd<double, Abi>;
+		const auto r = hyper_detail::lane_classify(x);
+
+		const DVec ser = hyper_detail::lane_cosh_series(pp::simd_select(r.series, r.a, DVec(0.5)));
+		const DVec e   = hyper_detail::lane_exp_of_abs(r);
+		const DVec inv = DVec(1.0) / pp::simd_select(r.drop_inv, DVec(1.0), e);
+		DVec c		   = pp::simd_select(r.drop_inv, DVec(0.5) * e, DVec(0.5) * (e + inv));
+		c			   = hyper_detail::lane_overflow_or(r, pp::simd_select(r.series, ser, c));
+		c			   = pp::simd_select(r.tiny, DVec(1.0), c);
+		return hyper_detail::lane_nan_or(r, x, c);
+	}
+
+	// tanh(x) for vectors of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> tanh_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec	 = pp::basic_simd<double, Abi>;
+		const auto r = hyper_detail::lane_classify(x);
+
+		const DVec ser = hyper_detail::lane_tanh_series(pp::simd_select(r.series, r.a, DVec(0.5)));
+		const DVec a   = pp::simd_select(r.series | r.tiny | r.drop_inv, DVec(1.0), r.a);
+		const DVec e2  = exp_simd_impl(a + a);
+		DVec t		   = pp::simd_select(r.series, ser, DVec(1.0) - DVec(2.0) / (e2 + DVec(1.0)));
+		t			   = pp::simd_select(r.drop_inv, DVec(1.0), t);
+		t			   = pp::simd_select(r.tiny, x, hyper_detail::lane_with_sign(t, r.sign));
+		return hyper_detail::lane_nan_or(r, x, t);
+	}
+
+	// sinh(x) and cosh(x) for vectors of double precision lanes, from one exp.
+	template <typename Abi>
+	CCM_ALWAYS_INLINE void sinhcosh_simd_impl(pp::basic_simd<double, Abi> const & x, pp::basic_simd<double, Abi> & sinh_out,
+											  pp::basic_simd<double, Abi> & cosh_out) noexcept
+	{
+		using DVec	 = pp::basic_simd<double, Abi>;
+		const auto r = hyper_detail::lane_classify(x);
+
+		const DVec as	 = pp::simd_select(r.series, r.a, DVec(0.5));
+		const DVec s_ser = hyper_detail::lane_sinh_series(as);
+		const DVec c_ser = hyper_detail::lane_cosh_series(as);
+		const DVec e	 = hyper_detail::lane_exp_of_abs(r);
+		const DVec inv	 = DVec(1.0) / pp::simd_select(r.drop_inv, DVec(1.0), e);
+		const DVec half	 = DVec(0.5) * e;
+		DVec s			 = pp::simd_select(r.drop_inv, half, DVec(0.5) * (e - inv));
+		DVec c			 = pp::simd_select(r.drop_inv, half, DVec(0.5) * (e + inv));
+		s				 = hyper_detail::lane_overflow_or(r, pp::simd_select(r.series, s_ser, s));
+		c				 = hyper_detail::lane_overflow_or(r, pp::simd_select(r.series, c_ser, c));
+		sinh_out		 = hyper_detail::lane_nan_or(r, x, pp::simd_select(r.tiny, x, hyper_detail::lane_with_sign(s, r.sign)));
+		cosh_out		 = hyper_detail::lane_nan_or(r, x, pp::simd_select(r.tiny, DVec(1.0), c));
+	}
+
+	// sinh(x) for vectors of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> sinh_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{ return pp::static_simd_cast<float>(sinh_simd_impl(pp::static_simd_cast<double>(x))); }
+
+	// cosh(x) for vectors of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> cosh_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{ return pp::static_simd_cast<float>(cosh_simd_impl(pp::static_simd_cast<double>(x))); }
+
+	// tanh(x) for vectors of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> tanh_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{ return pp::static_simd_cast<float>(tanh_simd_impl(pp::static_simd_cast<double>(x))); }
+
+	// sinh(x) and cosh(x) for vectors of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	CCM_ALWAYS_INLINE void sinhcosh_simd_impl(pp::basic_simd<float, Abi> const & x, pp::basic_simd<float, Abi> & sinh_out,
+											  pp::basic_simd<float, Abi> & cosh_out) noexcept
+	{
+		pp::basic_simd<double, Abi> s;
+		pp::basic_simd<double, Abi> c;
+		sinhcosh_simd_impl(pp::static_simd_cast<double>(x), s, c);
+		sinh_out = pp::static_simd_cast<float>(s);
+		cosh_out = pp::static_simd_cast<float>(c);
+	}
+} // namespace ccm::internal::impl
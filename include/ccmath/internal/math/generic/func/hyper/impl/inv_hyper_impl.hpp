@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// asinh, acosh and atanh on top of log_double_impl, following FreeBSD's
+// e_acosh.c, s_asinh.c and e_atanh.c (Sun Microsystems).
+// Each is rewritten so the logarithm's argument carries no cancellation: near
+// the origin as log1p of a small positive value, further out as log of an
+// argument free of the x - sqrt(x^2 - 1) difference, and past 2^28 as
+// log(|x|) + log(2). The double kernels stay within about 2.3 ulp. The float kernels
+// evaluate the double ones on the widened input and round once, and
+// inv_hyper_simd_impl.hpp replays all of them operation for operation. The
+// domain errors (acosh below 1, atanh beyond +-1) and atanh's poles at +-1
+// report through errno and the floating-point exceptions like ccm::log.
+
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/fenv/fenv_support.hpp"
+#include "ccmath/math/expo/impl/log_double_impl.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::internal::impl
+{
+	namespace inv_hyper_detail
+	{
+		inline constexpr double k_ln2 = 0x1.62e42fefa39efp-1;
+
+		// Below 2^-28, asinh(x) and atanh(x) round to x; from 2^28, asinh(x) and acosh(x) are log(|x|) + log(2).
+		inline constexpr std::uint64_t k_tiny_bits = 0x3e30'0000'0000'0000ULL;
+		inline constexpr std::uint64_t k_big_bits  = 0x41b0'0000'0000'0000ULL;
+		inline constexpr std::uint64_t k_two_bits  = 0x4000'0000'0000'0000ULL;
+		inline constexpr std::uint64_t k_half_bits = 0x3fe0'0000'0000'0000ULL;
+		inline constexpr std::uint64_t k_one_bits  = 0x3ff0'0000'0000'0000ULL;
+		inline constexpr std::uint64_t k_inf_bits  = 0x7ff0'0000'0000'0000ULL;
+
+		constexpr std::uint64_t abs_bits(double x) noexcept
+		{ return support::double_to_uint64(x) & 0x7fff'ffff'ffff'ffffULL; }
+
+		// The NaN of a domain error and the infinity of a pole, with their errno and fenv side effects.
+		template <typename T>
+		constexpr T domain_error() noexcept
+		{
+			support::fenv::set_errno_if_required(EDOM);
+			support::fenv::raise_except_if_required(FE_INVALID);
+			return std::numeric_limits<T>::quiet_NaN();
+		}
+
+		template <typename T>
+		constexpr T pole_error(T x) noexcept
+		{
+			support::fenv::set_errno_if_required(ERANGE);
+			support::fenv::raise_except_if_required(FE_DIVBYZERO);
+			return x < T(0) ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+		}
+
+		// log1p(v) for v >= 0 as log(1 + v) plus the first order correction for the rounding of 1 + v.
+		// log1p_double_impl's reduced polynomial loses a few hundred ulp on [0, 0.41]; this keeps
+		// log_double_impl's accuracy and replays lane for lane on log_simd_impl.
+		constexpr double log1p_nonneg(double v) noexcept
+		{
+			const double u = 1.0 + v;
+			if (u == 1.0) { return v; }
+			return log_double_impl(u) + (v - (u - 1.0)) / u;
+		}
+	} // namespace inv_hyper_detail
+
+	constexpr double asinh_double_impl(double x) noexcept
+	{
+		const std::uint64_t a_bits = inv_hyper_detail::abs_bits(x);
+
+		// asinh(+-inf) = +-inf and NaN propagates.
+		if (CCM_UNLIKELY(a_bits >= inv_hyper_detail::k_inf_bits)) { return x + x; }
+		if (a_bits < inv_hyper_detail::k_tiny_bits) { return x; }
+
+		const double a = support::uint64_to_double(a_bits);
+		double w	   = 0.0;
+		if (a_bits >= inv_hyper_detail::k_big_bits) { w = log_double_impl(a) + inv_hyper_detail::k_ln2; }
+		else if (a_bits > inv_hyper_detail::k_two_bits)
+		{
+			// log(a + sqrt(a^2 + 1)) = log(2a + 1 / (sqrt(a^2 + 1) + a)).
+			w = log_double_impl(2.0 * a + 1.0 / (ccm::sqrt(a * a + 1.0) + a));
+		}
+		else
+		{
+			// log1p(a + (sqrt(a^2 + 1) - 1)), with the difference rewritten as a^2 / (1 + sqrt(1 + a^2)).
+			const double t = a * a;
+			w			   = inv_hyper_detail::log1p_nonneg(a + t / (1.0 + ccm::sqrt(1.0 + t)));
+		}
+		return x < 0.0 ? -w : w;
+	}
+
+	constexpr double acosh_double_impl(double x) noexcept
+	{
+		const std::uint64_t x_bits = support::double_to_uint64(x);
+
+		if (CCM_UNLIKELY((x_bits & 0x7fff'ffff'ffff'ffffULL) > inv_hyper_detail::k_inf_bits)) { return x + x; }
+		// Below 1, including -inf, the sign bit makes x_bits compare above every positive x.
+		if (CCM_UNLIKELY(x_bits < inv_hyper_detail::k_one_bits || x_bits > inv_hyper_detail::k_inf_bits)) { return inv_hyper_detail::domain_error<double>(); }
+		if (CCM_UNLIKELY(x_bits == inv_hyper_detail::k_inf_bits)) { return x; }
+
+		if (x_bits >= inv_hyper_detail::k_big_bits) { return log_double_impl(x) + inv_hyper_detail::k_ln2; }
+		if (x_bits > inv_hyper_detail::k_two_bits)
+		{
+			// log(x + sqrt(x^2 - 1)) = log(2x - 1 / (x + sqrt(x^2 - 1))).
+			return log_double_impl(2.0 * x - 1.0 / (x + ccm::sqrt(x * x - 1.0)));
+		}
+		// log1p(t + sqrt(2t + t^2)) with t = x - 1, which is exact on [1, 2].
+		const double t = x - 1.0;
+		return inv_hyper_detail::log1p_nonneg(t + ccm::sqrt(2.0 * t + t * t));
+	}
+
+	constexpr double atanh_double_impl(double x) noexcept
+	{
+		const std::uint64_t a_bits = inv_hyper_detail::abs_bits(x);
+
+		if (CCM_UNLIKELY(a_bits > inv_hyper_detail::k_inf_bits)) { return x + x; }
+		if (CCM_UNLIKELY(a_bits > inv_hyper_detail::k_one_bits)) { return inv_hyper_detail::domain_error<double>(); }
+		if (CCM_UNLIKELY(a_bits == inv_hyper_detail::k_one_bits)) { return inv_hyper_detail::pole_error(x); }
+		if (a_bits < inv_hyper_detail::k_tiny_bits) { return x; }
+
+		// atanh(a) = log1p(2a / (1 - a)) / 2, with 2a / (1 - a) split as 2a + 2a^2 / (1 - a) below 1/2.
+		const double a = support::uint64_to_double(a_bits);
+		double w	   = 0.0;
+		if (a_bits < inv_hyper_detail::k_half_bits)
+		{
+			const double t = a + a;
+			w			   = 0.5 * inv_hyper_detail::log1p_nonneg(t + t * a / (1.0 - a));
+		}
+		else
+		{
+			w = 0.5 * inv_hyper_detail::log1p_nonneg((a + a) / (1.0 - a));
+		}
+		return x < 0.0 ? -w : w;
+	}
+
+	constexpr float asinh_float_impl(float x) noexcept
+	{ return static_cast<float>(asinh_double_impl(static_cast<double>(x))); }
+
+	constexpr float acosh_float_impl(float x) noexcept
+	{ return static_cast<float>(acosh_double_impl(static_cast<double>(x))); }
+
+	constexpr float atanh_float_impl(float x) noexcept
+	{ return static_cast<float>(atanh_double_impl(static_cast<double>(x))); }
+
+	template <typename T>
+	constexpr T asinh_impl(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return asinh_float_impl(x); }
+		else
+		{
+			return static_cast<T>(asinh_double_impl(static_cast<double>(x)));
+		}
+	}
+
+	template <typename T>
+	constexpr T acosh_impl(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return acosh_float_impl(x); }
+		else
+		{
+			return static_cast<T>(acosh_double_impl(static_cast<double>(x)));
+		}
+	}
+
+	template <typename T>
+	constexpr T atanh_impl(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return atanh_float_impl(x); }
+		else
+		{
+			return static_cast<T>(atanh_double_impl(static_cast<double>(x)));
+		}
+	}
+} // namespace ccm::internal::impl
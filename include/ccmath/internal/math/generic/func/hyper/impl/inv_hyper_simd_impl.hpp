@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized asinh, acosh and atanh. The kernels replay inv_hyper_impl.hpp
+// operation for operation, with the logarithm through log_simd_impl, so every
+// lane is bit identical to the scalar kernel. The branches of each scalar
+// kernel only differ in the argument they hand to the logarithm and in what
+// they add to it, so the argument is selected per lane and the logarithm runs
+// once. Lanes a branch does not own run it on a benign value. Lanes with NaN
+// or infinite inputs, and those that raise domain or pole errors, are
+// recomputed with the scalar kernel for its errno and fenv side effects.
+
+#include "ccmath/internal/math/generic/func/hyper/impl/inv_hyper_impl.hpp"
+#include "ccmath/internal/math/runtime/pp/conversion.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/math/expo/impl/log_simd_impl.hpp"
+
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	namespace inv_hyper_detail
+	{
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_sqrt(pp::basic_simd<double, Abi> const & x) noexcept
+		{ return pp::basic_simd<double, Abi>::from_member(pp::SimdTraits<double, Abi>::op_sqrt(x.get())); }
+
+		// log1p_nonneg per lane; every lane of v must be non-negative and finite.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_log1p_nonneg(pp::basic_simd<double, Abi> const & v) noexcept
+		{
+			using DVec	 = pp::basic_simd<double, Abi>;
+			const DVec u = DVec(1.0) + v;
+			return pp::simd_select(u == DVec(1.0), v, log_simd_impl(u) + (v - (u - DVec(1.0))) / u);
+		}
+
+		// -v on the lanes with the sign bit set, as the scalar kernels negate a positive result for negative x.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> lane_with_sign(pp::basic_simd<double, Abi> const & v, pp::basic_simd<std::uint64_t, Abi> const & sign) noexcept
+		{ return pp::simd_bit_cast<double>(pp::simd_bit_cast<std::uint64_t>(v) | sign); }
+
+		// The scalar kernel's result on the lanes of mask, and v elsewhere.
+		template <typename Abi, typename Kernel>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> scalar_or(pp::basic_simd_mask<sizeof(double), Abi> const & mask, pp::basic_simd<double, Abi> const & x,
+																pp::basic_simd<double, Abi> const & v, Kernel kernel) noexcept
+		{
+			if (!pp::any_of(mask)) { return v; }
+			pp::basic_simd<double, Abi> r = v;
+			for (int i = 0; i < static_cast<int>(pp::basic_simd<double, Abi>::size()); ++i)
+			{
+				if (mask[i]) { r[i] = kernel(x[i]); }
+			}
+			return r;
+		}
+	} // namespace inv_hyper_detail
+
+	// asinh(x) for vectors of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> asinh_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec			= pp::basic_simd<double, Abi>;
+		using U64			= pp::basic_simd<std::uint64_t, Abi>;
+		const U64 x_bits	= pp::simd_bit_cast<std::uint64_t>(x);
+		const U64 a_bits	= x_bits & U64(0x7fff'ffff'ffff'ffffULL);
+		const auto special	= a_bits >= U64(inv_hyper_detail::k_inf_bits);
+		const auto tiny		= a_bits < U64(inv_hyper_detail::k_tiny_bits);
+		const auto big		= a_bits >= U64(inv_hyper_detail::k_big_bits);
+		const auto mid		= (a_bits > U64(inv_hyper_detail::k_two_bits)) & ~big;
+		const auto near_one = ~(special | tiny | big | mid);
+
+		const DVec a = pp::simd_select(special | tiny, DVec(1.0), pp::simd_bit_cast<double>(a_bits));
+
+		// The log1p branch's v and u = 1 + v; the other lanes run it on a = 1.
+		const DVec as	= pp::simd_select(near_one, a, DVec(1.0));
+		const DVec t	= as * as;
+		const DVec v	= as + t / (DVec(1.0) + inv_hyper_detail::lane_sqrt(DVec(1.0) + t));
+		const DVec u	= DVec(1.0) + v;
+		const DVec corr = (v - (u - DVec(1.0))) / u;
+
+		const DVec am	= pp::simd_select(mid, a, DVec(3.0));
+		const DVec arg	= pp::simd_select(big, a, pp::simd_select(mid, DVec(2.0) * am + DVec(1.0) / (inv_hyper_detail::lane_sqrt(am * am + DVec(1.0)) + am), u));
+		const DVec lg	= log_simd_impl(arg);
+		DVec w			= pp::simd_select(big, lg + DVec(inv_hyper_detail::k_ln2), pp::simd_select(mid, lg, lg + corr));
+		w				= pp::simd_select(near_one & (u == DVec(1.0)), v, w);
+		w				= pp::simd_select(tiny, x, inv_hyper_detail::lane_with_sign(w, x_bits & U64(0x8000'0000'0000'0000ULL)));
+		return inv_hyper_detail::scalar_or(special, x, w, [](double s) { return asinh_double_impl(s); });
+	}
+
+	// acosh(x) for vectors of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> acosh_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec		 = pp::basic_simd<double, Abi>;
+		using U64		 = pp::basic_simd<std::uint64_t, Abi>;
+		const U64 x_bits = pp::simd_bit_cast<std::uint64_t>(x);
+		// NaN, infinite, below one and negative lanes: the sign bit puts every negative x above +inf.
+		const auto special	= (x_bits < U64(inv_hyper_detail::k_one_bits)) | (x_bits >= U64(inv_hyper_detail::k_inf_bits));
+		const auto big		= x_bits >= U64(inv_hyper_detail::k_big_bits);
+		const auto mid		= (x_bits > U64(inv_hyper_detail::k_two_bits)) & ~big;
+		const auto near_one	= ~(special | big | mid);
+
+		const DVec xs	= pp::simd_select(special, DVec(1.0), x);
+		const DVec t	= pp::simd_select(near_one, xs, DVec(1.0)) - DVec(1.0);
+		const DVec v	= t + inv_hyper_detail::lane_sqrt(DVec(2.0) * t + t * t);
+		const DVec u	= DVec(1.0) + v;
+		const DVec corr = (v - (u - DVec(1.0))) / u;
+
+		const DVec xm  = pp::simd_select(mid, xs, DVec(3.0));
+		const DVec arg = pp::simd_select(big, xs, pp::simd_select(mid, DVec(2.0) * xm - DVec(1.0) / (xm + inv_hyper_detail::lane_sqrt(xm * xm - DVec(1.0))), u));
+		const DVec lg  = log_simd_impl(arg);
+		DVec w		   = pp::simd_select(big, lg + DVec(inv_hyper_detail::k_ln2), pp::simd_select(mid, lg, lg + corr));
+		w			   = pp::simd_select(near_one & (u == DVec(1.0)), v, w);
+		return inv_hyper_detail::scalar_or(special, x, w, [](double s) { return acosh_double_impl(s); });
+	}
+
+	// atanh(x) for vectors of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> atanh_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec		   = pp::basic_simd<double, Abi>;
+		using U64		   = pp::basic_simd<std::uint64_t, Abi>;
+		const U64 x_bits   = pp::simd_bit_cast<std::uint64_t>(x);
+		const U64 a_bits   = x_bits & U64(0x7fff'ffff'ffff'ffffULL);
+		const auto special = a_bits >= U64(inv_hyper_detail::k_one_bits);
+		const auto tiny	   = a_bits < U64(inv_hyper_detail::k_tiny_bits);
+		const auto small   = a_bits < U64(inv_hyper_detail::k_half_bits);
+
+		const DVec a  = pp::simd_select(special | tiny, DVec(0.25), pp::simd_bit_cast<double>(a_bits));
+		const DVec t  = a + a;
+		const DVec v  = pp::simd_select(small, t + t * a / (DVec(1.0) - a), t / (DVec(1.0) - a));
+		DVec w		  = DVec(0.5) * inv_hyper_detail::lane_log1p_nonneg(v);
+		w			  = pp::simd_select(tiny, x, inv_hyper_detail::lane_with_sign(w, x_bits & U64(0x8000'0000'0000'0000ULL)));
+		return inv_hyper_detail::scalar_or(special, x, w, [](double s) { return atanh_double_impl(s); });
+	}
+
+	// asinh(x) for vectors of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> asinh_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{ return pp::static_simd_cast<float>(asinh_simd_impl(pp::static_simd_cast<double>(x))); }
+
+	// acosh(x) for vectors of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> acosh_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{ return pp::static_simd_cast<float>(acosh_simd_impl(pp::static_simd_cast<double>(x))); }
+
+	// atanh(x) for vectors of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> atanh_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{ return pp::static_simd_cast<float>(atanh_simd_impl(pp::static_simd_cast<double>(x))); }
+} // namespace ccm::internal::impl
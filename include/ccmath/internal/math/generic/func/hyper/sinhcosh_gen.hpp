@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/hyper/impl/hyper_impl.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
+{
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sinhcosh_gen(T num, T & sinh_out, T & cosh_out) noexcept
+	{ ccm::internal::impl::sinhcosh_impl(num, sinh_out, cosh_out); }
+} // namespace ccm::gen
@@ -26,4 +26,15 @@ namespace ccm::gen
 			return static_cast<T>(ccm::internal::impl::hypot_impl(static_cast<double>(x), static_cast<double>(y)));
 		}
 	}
+
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hypot_gen(T x, T y, T z) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::hypot_impl(x, y, z); }
+		else if constexpr (std::is_same_v<T, double>) { return ccm::internal::impl::hypot_impl(x, y, z); }
+		else
+		{
+			return static_cast<T>(ccm::internal::impl::hypot_impl(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z)));
+		}
+	}
 } // namespace ccm::gen
@@ -10,39 +10,102 @@
 
 #pragma once
 
+// Cube root from an integer estimate: dividing the high word of |x| by 3 and
+// adding a bias gives cbrt(x) to about 5 bits. The double kernel follows
+// FreeBSD's s_cbrt.c (Sun Microsystems, Bruce D. Evans): a polynomial step to
+// 23 bits, a rounding to 22 bits so the next square is exact, and one Newton
+// step, with an error below 0.667 ulp. The float kernel takes the same
+// estimate on the input widened to double and runs two Halley steps there,
+// which leaves the result correctly rounded for every float in round to
+// nearest. cbrt_simd_impl.hpp replays both operation for operation.
+
 #include "ccmath/internal/predef/unlikely.hpp"
-#include "ccmath/internal/support/fp/fp_bits.hpp"
-#include "ccmath/math/basic/fabs.hpp"
-#include "ccmath/math/compare/isinf.hpp"
-#include "ccmath/math/compare/isnan.hpp"
-#include "ccmath/math/expo/exp.hpp"
-#include "ccmath/math/expo/log.hpp"
-
-#include <limits>
+#include "ccmath/internal/support/bits.hpp"
+
+#include <cstdint>
 #include <type_traits>
 
 namespace ccm::internal::impl
 {
-	template <typename T>
-	constexpr T cbrt_impl(T x) noexcept
+	namespace cbrt_detail
 	{
-		using fp_bits_t = ccm::support::fp::FPBits<T>;
+		// (1023 - 1023/3 - 0.03306235651) * 2^20: the bias of the estimate's high word for normal inputs.
+		inline constexpr std::uint32_t k_bias_normal = 715094163U;
+		// As k_bias_normal, less 54/3 for the 2^54 scaling of a subnormal input.
+		inline constexpr std::uint32_t k_bias_subnormal = 696219795U;
 
-		fp_bits_t bits(x);
+		// p(r) ~= 1/cbrt(r) on the estimate's range of r = t^3 / x, to about 23 bits.
+		inline constexpr double k_poly[5] = { 1.87595182427177009643, -1.88497979543377169875, 1.621429720105354466140, -0.758397934778766047437,
+											  0.145996192886612446982 };
 
-		if (CCM_UNLIKELY(bits.is_nan())) { return x; }
+		// The estimate for a double with high word hx of |x| (or of |x| * 2^54 with the subnormal bias), with the sign of x.
+		constexpr double estimate(std::uint64_t x_bits, std::uint32_t hx, std::uint32_t bias) noexcept
+		{ return support::uint64_to_double((x_bits & 0x8000'0000'0000'0000ULL) | (static_cast<std::uint64_t>(hx / 3U + bias) << 32)); }
+	} // namespace cbrt_detail
 
-		if (CCM_UNLIKELY(bits.is_inf())) { return x; }
+	constexpr double cbrt_double_impl(double x) noexcept
+	{
+		const std::uint64_t x_bits = support::double_to_uint64(x);
+		const std::uint64_t x_abs  = x_bits & 0x7fff'ffff'ffff'ffffULL;
 
-		if (CCM_UNLIKELY(bits.is_zero())) { return x; }
+		// NaN, infinities and zeros are their own cube roots.
+		if (CCM_UNLIKELY(x_abs >= 0x7ff0'0000'0000'0000ULL || x_abs == 0)) { return x; }
 
-		const bool negative = bits.is_neg();
-		const T ax			= ccm::fabs(x);
+		double t = 0.0;
+		if (CCM_UNLIKELY(x_abs < 0x0010'0000'0000'0000ULL))
+		{
+			const auto hx = static_cast<std::uint32_t>((support::double_to_uint64(x * 0x1p54) & 0x7fff'ffff'ffff'ffffULL) >> 32);
+			t			  = cbrt_detail::estimate(x_bits, hx, cbrt_detail::k_bias_subnormal);
+		}
+		else
+		{
+			t = cbrt_detail::estimate(x_bits, static_cast<std::uint32_t>(x_abs >> 32), cbrt_detail::k_bias_normal);
+		}
 
-		T y			 = ccm::exp(ccm::log(ax) / static_cast<T>(3));
-		const T y_sq = y * y;
-		y			 = (static_cast<T>(2) * y + ax / y_sq) / static_cast<T>(3);
+		// t = t * p(t^3 / x), good to 23 bits.
+		double r = (t * t) * (t / x);
+		t		 = t * ((cbrt_detail::k_poly[0] + r * (cbrt_detail::k_poly[1] + r * cbrt_detail::k_poly[2])) +
+					((r * r) * r) * (cbrt_detail::k_poly[3] + r * cbrt_detail::k_poly[4]));
 
-		return negative ? -y : y;
+		// Round t away from zero to 22 bits so that t * t is exact.
+		t = support::uint64_to_double((support::double_to_uint64(t) + 0x8000'0000ULL) & 0xffff'ffff'c000'0000ULL);
+
+		// One Newton step to 53 bits.
+		const double s = t * t;
+		r			   = x / s;
+		const double w = t + t;
+		r			   = (r - t) / (w + r);
+		return t + t * r;
+	}
+
+	constexpr float cbrt_float_impl(float x) noexcept
+	{
+		const std::uint32_t x_abs = support::float_to_uint32(x) & 0x7fff'ffffU;
+
+		// NaN, infinities and zeros are their own cube roots.
+		if (CCM_UNLIKELY(x_abs >= 0x7f80'0000U || x_abs == 0)) { return x; }
+
+		// Every float, subnormals included, is a normal double.
+		const auto xd				= static_cast<double>(x);
+		const std::uint64_t xd_bits	= support::double_to_uint64(xd);
+		const auto hx				= static_cast<std::uint32_t>((xd_bits & 0x7fff'ffff'ffff'ffffULL) >> 32);
+		double t					= cbrt_detail::estimate(xd_bits, hx, cbrt_detail::k_bias_normal);
+
+		// Two Halley steps: about 5, 15, then 45 bits.
+		double r = t * t * t;
+		t		 = t * (xd + xd + r) / (xd + r + r);
+		r		 = t * t * t;
+		t		 = t * (xd + xd + r) / (xd + r + r);
+		return static_cast<float>(t);
+	}
+
+	template <typename T>
+	constexpr T cbrt_impl(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return cbrt_float_impl(x); }
+		else
+		{
+			return static_cast<T>(cbrt_double_impl(static_cast<double>(x)));
+		}
 	}
 } // namespace ccm::internal::impl
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized cbrt. Both kernels replay cbrt_impl.hpp operation for operation,
+// so every lane is bit identical to the scalar kernel. The integer estimate
+// divides by 3 as a multiply by 0xAAAAAAAB and a shift by 33, which is exact
+// for the 31-bit high words it sees. NaN, infinite and zero lanes are their
+// own result; they run the arithmetic on 1 instead so they raise nothing.
+
+#include "ccmath/internal/math/generic/func/power/impl/cbrt_impl.hpp"
+#include "ccmath/internal/math/runtime/pp/conversion.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	namespace cbrt_detail
+	{
+		// cbrt_detail::estimate on lanes of high words hx < 2^31, with bias added after the division.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> estimate(pp::basic_simd<std::uint64_t, Abi> const & x_bits, pp::basic_simd<std::uint64_t, Abi> const & hx,
+															   pp::basic_simd<std::uint64_t, Abi> const & bias) noexcept
+		{
+			using U64		 = pp::basic_simd<std::uint64_t, Abi>;
+			const U64 third	 = (hx * U64(0xAAAA'AAABULL)) >> U64(33);
+			const U64 sign	 = x_bits & U64(0x8000'0000'0000'0000ULL);
+			const U64 t_bits = sign | ((third + bias) << U64(32));
+			return pp::simd_bit_cast<double>(t_bits);
+		}
+	} // namespace cbrt_detail
+
+	// cbrt(x) for a vector of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> cbrt_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec = pp::basic_simd<double, Abi>;
+		using U64  = pp::basic_simd<std::uint64_t, Abi>;
+
+		const U64 x_abs		 = pp::simd_bit_cast<std::uint64_t>(x) & U64(0x7fff'ffff'ffff'ffffULL);
+		const auto special	 = (x_abs >= U64(0x7ff0'0000'0000'0000ULL)) | (x_abs == U64(0));
+		const DVec xs		 = pp::simd_select(special, DVec(1.0), x);
+		const U64 xs_bits	 = pp::simd_bit_cast<std::uint64_t>(xs);
+		const auto subnormal = (xs_bits & U64(0x7fff'ffff'ffff'ffffULL)) < U64(0x0010'0000'0000'0000ULL);
+
+		// Subnormal lanes take their high word from x * 2^54 and the matching bias.
+		U64 hx	 = (xs_bits & U64(0x7fff'ffff'ffff'ffffULL)) >> U64(32);
+		U64 bias = U64(cbrt_detail::k_bias_normal);
+		if (pp::any_of(subnormal))
+		{
+			const U64 scaled = (pp::simd_bit_cast<std::uint64_t>(xs * DVec(0x1p54)) & U64(0x7fff'ffff'ffff'ffffULL)) >> U64(32);
+			hx				 = pp::simd_select(subnormal, scaled, hx);
+			bias			 = pp::simd_select(subnormal, U64(cbrt_detail::k_bias_subnormal), bias);
+		}
+		DVec t = cbrt_detail::estimate(xs_bits, hx, bias);
+
+		DVec r = (t * t) * (t / xs);
+		t	   = t * ((DVec(cbrt_detail::k_poly[0]) + r * (DVec(cbrt_detail::k_poly[1]) + r * DVec(cbrt_detail::k_poly[2]))) +
+				  ((r * r) * r) * (DVec(cbrt_detail::k_poly[3]) + r * DVec(cbrt_detail::k_poly[4])));
+
+		t = pp::simd_bit_cast<double>((pp::simd_bit_cast<std::uint64_t>(t) + U64(0x8000'0000ULL)) & U64(0xffff'ffff'c000'0000ULL));
+
+		const DVec s = t * t;
+		r			 = xs / s;
+		const DVec w = t + t;
+		r			 = (r - t) / (w + r);
+		return pp::simd_select(special, x, t + t * r);
+	}
+
+	// cbrt(x) for a vector of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> cbrt_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{
+		using FVec = pp::basic_simd<float, Abi>;
+		using DVec = pp::basic_simd<double, Abi>;
+		using U32  = pp::basic_simd<std::uint32_t, Abi>;
+		using U64  = pp::basic_simd<std::uint64_t, Abi>;
+
+		const U32 x_abs		= pp::simd_bit_cast<std::uint32_t>(x) & U32(0x7fff'ffffU);
+		const auto special	= (x_abs >= U32(0x7f80'0000U)) | (x_abs == U32(0));
+		const DVec xd		= pp::static_simd_cast<double>(pp::simd_select(special, FVec(1.0F), x));
+		const U64 xd_bits	= pp::simd_bit_cast<std::uint64_t>(xd);
+		const U64 hx		= (xd_bits & U64(0x7fff'ffff'ffff'ffffULL)) >> U64(32);
+		DVec t				= cbrt_detail::estimate(xd_bits, hx, U64(cbrt_detail::k_bias_normal));
+
+		DVec r = t * t * t;
+		t	   = t * (xd + xd + r) / (xd + r + r);
+		r	   = t * t * t;
+		t	   = t * (xd + xd + r) / (xd + r + r);
+		return pp::simd_select(special, x, pp::static_simd_cast<float>(t));
+	}
+} // namespace ccm::internal::impl
@@ -10,40 +10,122 @@
 
 #pragma once
 
+// hypot as the square root of a sum of squares, scaled once. The float kernels
+// square the inputs in double, where the squares are exact and cannot overflow
+// or underflow, so no scaling is needed and the result is within 0.5 ulp plus
+// the final rounding. The double kernels multiply every input by the same
+// power of two, picked from the largest magnitude, so the squares neither
+// overflow nor lose bits that matter; the scaling is exact and undone on the
+// square root. The two and three argument kernels have no divisions, stay
+// within about 1.2 and 1.5 ulp, and hypot_simd_impl.hpp replays them operation
+// for operation.
+
 #include "ccmath/internal/predef/unlikely.hpp"
-#include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/math/basic/fabs.hpp"
 #include "ccmath/math/compare/isinf.hpp"
 #include "ccmath/math/compare/isnan.hpp"
 #include "ccmath/math/power/sqrt.hpp"
 
+#include <limits>
 #include <type_traits>
 
 namespace ccm::internal::impl
 {
-	template <typename T>
-	constexpr T hypot_impl(T x, T y) noexcept
+	namespace hypot_detail
 	{
-		using fp_bits_t = ccm::support::fp::FPBits<T>;
+		// Largest magnitudes above k_big are scaled down by k_down, those below k_small up by k_up.
+		inline constexpr double k_big	= 0x1p500;
+		inline constexpr double k_small = 0x1p-500;
+		inline constexpr double k_down	= 0x1p-600;
+		inline constexpr double k_up	= 0x1p600;
 
-		if (CCM_UNLIKELY(ccm::isinf(x) || ccm::isinf(y))) { return fp_bits_t::inf().get_val(); }
+		// The factor the inputs are multiplied by for largest magnitude m.
+		constexpr double scale_for(double m) noexcept
+		{
+			if (m > k_big) { return k_down; }
+			if (m < k_small) { return k_up; }
+			return 1.0;
+		}
 
-		if (CCM_UNLIKELY(ccm::isnan(x))) { return x + y; }
-		if (CCM_UNLIKELY(ccm::isnan(y))) { return x + y; }
+		// The factor the square root is multiplied by for largest magnitude m.
+		constexpr double unscale_for(double m) noexcept
+		{
+			if (m > k_big) { return k_up; }
+			if (m < k_small) { return k_down; }
+			return 1.0;
+		}
+	} // namespace hypot_detail
 
-		x = ccm::fabs(x);
-		y = ccm::fabs(y);
+	constexpr double hypot_double_impl(double x, double y) noexcept
+	{
+		// An infinity wins over a NaN.
+		if (CCM_UNLIKELY(ccm::isinf(x) || ccm::isinf(y))) { return std::numeric_limits<double>::infinity(); }
+		if (CCM_UNLIKELY(ccm::isnan(x) || ccm::isnan(y))) { return x + y; }
 
-		if (CCM_UNLIKELY(x == static_cast<T>(0) && y == static_cast<T>(0))) { return static_cast<T>(0); }
+		x				= ccm::fabs(x);
+		y				= ccm::fabs(y);
+		const double m	= x > y ? x : y;
+		const double s	= hypot_detail::scale_for(m);
+		const double xs = x * s;
+		const double ys = y * s;
+		return ccm::sqrt(xs * xs + ys * ys) * hypot_detail::unscale_for(m);
+	}
+
+	constexpr double hypot_double_impl(double x, double y, double z) noexcept
+	{
+		if (CCM_UNLIKELY(ccm::isinf(x) || ccm::isinf(y) || ccm::isinf(z))) { return std::numeric_limits<double>::infinity(); }
+		if (CCM_UNLIKELY(ccm::isnan(x) || ccm::isnan(y) || ccm::isnan(z))) { return (x + y) + z; }
+
+		x				= ccm::fabs(x);
+		y				= ccm::fabs(y);
+		z				= ccm::fabs(z);
+		const double mx = x > y ? x : y;
+		const double m	= mx > z ? mx : z;
+		const double s	= hypot_detail::scale_for(m);
+		const double xs = x * s;
+		const double ys = y * s;
+		const double zs = z * s;
+		return ccm::sqrt((xs * xs + ys * ys) + zs * zs) * hypot_detail::unscale_for(m);
+	}
+
+	constexpr float hypot_float_impl(float x, float y) noexcept
+	{
+		if (CCM_UNLIKELY(ccm::isinf(x) || ccm::isinf(y))) { return std::numeric_limits<float>::infinity(); }
+		if (CCM_UNLIKELY(ccm::isnan(x) || ccm::isnan(y))) { return x + y; }
 
-		if (y > x)
+		const auto xd = static_cast<double>(x);
+		const auto yd = static_cast<double>(y);
+		return static_cast<float>(ccm::sqrt(xd * xd + yd * yd));
+	}
+
+	constexpr float hypot_float_impl(float x, float y, float z) noexcept
+	{
+		if (CCM_UNLIKELY(ccm::isinf(x) || ccm::isinf(y) || ccm::isinf(z))) { return std::numeric_limits<float>::infinity(); }
+		if (CCM_UNLIKELY(ccm::isnan(x) || ccm::isnan(y) || ccm::isnan(z))) { return (x + y) + z; }
+
+		const auto xd = static_cast<double>(x);
+		const auto yd = static_cast<double>(y);
+		const auto zd = static_cast<double>(z);
+		return static_cast<float>(ccm::sqrt((xd * xd + yd * yd) + zd * zd));
+	}
+
+	template <typename T>
+	constexpr T hypot_impl(T x, T y) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return hypot_float_impl(x, y); }
+		else
 		{
-			const T tmp = x;
-			x			= y;
-			y			= tmp;
+			return static_cast<T>(hypot_double_impl(static_cast<double>(x), static_cast<double>(y)));
 		}
+	}
 
-		const T ratio = y / x;
-		return x * ccm::sqrt(static_cast<T>(1) + ratio * ratio);
+	template <typename T>
+	constexpr T hypot_impl(T x, T y, T z) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return hypot_float_impl(x, y, z); }
+		else
+		{
+			return static_cast<T>(hypot_double_impl(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z)));
+		}
 	}
 } // namespace ccm::internal::impl
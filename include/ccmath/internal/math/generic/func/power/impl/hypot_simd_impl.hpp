@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized hypot. The kernels replay hypot_impl.hpp operation for operation,
+// so every lane is bit identical to the scalar kernel; the scale factor is
+// picked per lane by selects instead of branches. Infinite and NaN lanes run
+// the arithmetic on zeros instead, and their NaN sum only adds the NaN inputs,
+// so they raise nothing the scalar kernel does not.
+
+#include "ccmath/internal/math/generic/func/power/impl/hypot_impl.hpp"
+#include "ccmath/internal/math/runtime/pp/conversion.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::internal::impl
+{
+	namespace hypot_detail
+	{
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> lane_sqrt(pp::basic_simd<T, Abi> const & x) noexcept
+		{ return pp::basic_simd<T, Abi>::from_member(pp::SimdTraits<T, Abi>::op_sqrt(x.get())); }
+
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> lane_abs(pp::basic_simd<T, Abi> const & x) noexcept
+		{ return pp::basic_simd<T, Abi>::from_member(pp::SimdTraits<T, Abi>::op_fabs(x.get())); }
+
+		// a > b ? a : b per lane, as the scalar kernels pick their largest magnitude.
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> lane_max(pp::basic_simd<T, Abi> const & a, pp::basic_simd<T, Abi> const & b) noexcept
+		{ return pp::simd_select(a > b, a, b); }
+
+		// Lane masks of the infinite and the NaN lanes of v.
+		template <typename T, typename Abi>
+		struct special_lanes
+		{
+			pp::basic_simd_mask<sizeof(T), Abi> inf;
+			pp::basic_simd_mask<sizeof(T), Abi> nan;
+		};
+
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE special_lanes<T, Abi> classify(pp::basic_simd<T, Abi> const & v) noexcept
+		{
+			using Bits			 = std::conditional_t<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>;
+			using UVec			 = pp::basic_simd<Bits, Abi>;
+			constexpr Bits k_abs = std::numeric_limits<Bits>::max() >> 1U;
+			constexpr Bits k_inf = sizeof(T) == sizeof(std::uint64_t) ? Bits(0x7ff0'0000'0000'0000ULL) : Bits(0x7f80'0000U);
+
+			const UVec v_abs = pp::simd_bit_cast<Bits>(v) & UVec(k_abs);
+			return { v_abs == UVec(k_inf), v_abs > UVec(k_inf) };
+		}
+
+		// The scalar kernels' special results: +inf where any input is infinite, else the sum of the NaN inputs.
+		template <typename T, typename Abi, typename... Vs>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> special_result(pp::basic_simd_mask<sizeof(T), Abi> const & any_inf, Vs const &... nan_operands) noexcept
+		{
+			using V = pp::basic_simd<T, Abi>;
+			return pp::simd_select(any_inf, V(std::numeric_limits<T>::infinity()), (... + nan_operands));
+		}
+
+		// Lanes of scale_for and unscale_for for largest magnitudes m.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE void scale_lanes(pp::basic_simd<double, Abi> const & m, pp::basic_simd<double, Abi> & s, pp::basic_simd<double, Abi> & u) noexcept
+		{
+			using DVec		= pp::basic_simd<double, Abi>;
+			const auto big	= m > DVec(k_big);
+			const auto tiny = m < DVec(k_small);
+			s				= pp::simd_select(big, DVec(k_down), pp::simd_select(tiny, DVec(k_up), DVec(1.0)));
+			u				= pp::simd_select(big, DVec(k_up), pp::simd_select(tiny, DVec(k_down), DVec(1.0)));
+		}
+	} // namespace hypot_detail
+
+	// hypot(x, y) for vectors of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> hypot_simd_impl(pp::basic_simd<double, Abi> const & x,
+																				 pp::basic_simd<double, Abi> const & y) noexcept
+	{
+		using DVec		   = pp::basic_simd<double, Abi>;
+		const auto x_cls   = hypot_detail::classify(x);
+		const auto y_cls   = hypot_detail::classify(y);
+		const auto any_inf = x_cls.inf | y_cls.inf;
+		const auto special = any_inf | x_cls.nan | y_cls.nan;
+
+		const DVec xa = pp::simd_select(special, DVec(0.0), hypot_detail::lane_abs(x));
+		const DVec ya = pp::simd_select(special, DVec(0.0), hypot_detail::lane_abs(y));
+		DVec s;
+		DVec u;
+		hypot_detail::scale_lanes(hypot_detail::lane_max(xa, ya), s, u);
+		const DVec xs	 = xa * s;
+		const DVec ys	 = ya * s;
+		const DVec plain = hypot_detail::lane_sqrt(xs * xs + ys * ys) * u;
+		if (!pp::any_of(special)) { return plain; }
+
+		const DVec nx = pp::simd_select(x_cls.nan, x, DVec(0.0));
+		const DVec ny = pp::simd_select(y_cls.nan, y, DVec(0.0));
+		return pp::simd_select(special, hypot_detail::special_result<double, Abi>(any_inf, nx, ny), plain);
+	}
+
+	// hypot(x, y, z) for vectors of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> hypot_simd_impl(pp::basic_simd<double, Abi> const & x, pp::basic_simd<double, Abi> const & y,
+																				 pp::basic_simd<double, Abi> const & z) noexcept
+	{
+		using DVec		   = pp::basic_simd<double, Abi>;
+		const auto x_cls   = hypot_detail::classify(x);
+		const auto y_cls   = hypot_detail::classify(y);
+		const auto z_cls   = hypot_detail::classify(z);
+		const auto any_inf = x_cls.inf | y_cls.inf | z_cls.inf;
+		const auto special = any_inf | x_cls.nan | y_cls.nan | z_cls.nan;
+
+		const DVec xa = pp::simd_select(special, DVec(0.0), hypot_detail::lane_abs(x));
+		const DVec ya = pp::simd_select(special, DVec(0.0), hypot_detail::lane_abs(y));
+		const DVec za = pp::simd_select(special, DVec(0.0), hypot_detail::lane_abs(z));
+		DVec s;
+		DVec u;
+		hypot_detail::scale_lanes(hypot_detail::lane_max(hypot_detail::lane_max(xa, ya), za), s, u);
+		const DVec xs	 = xa * s;
+		const DVec ys	 = ya * s;
+		const DVec zs	 = za * s;
+		const DVec plain = hypot_detail::lane_sqrt((xs * xs + ys * ys) + zs * zs) * u;
+		if (!pp::any_of(special)) { return plain; }
+
+		const DVec nx = pp::simd_select(x_cls.nan, x, DVec(0.0));
+		const DVec ny = pp::simd_select(y_cls.nan, y, DVec(0.0));
+		const DVec nz = pp::simd_select(z_cls.nan, z, DVec(0.0));
+		return pp::simd_select(special, hypot_detail::special_result<double, Abi>(any_inf, nx, ny, nz), plain);
+	}
+
+	// hypot(x, y) for vectors of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> hypot_simd_impl(pp::basic_simd<float, Abi> const & x, pp::basic_simd<float, Abi> const & y) noexcept
+	{
+		using FVec		   = pp::basic_simd<float, Abi>;
+		using DVec		   = pp::basic_simd<double, Abi>;
+		const auto x_cls   = hypot_detail::classify(x);
+		const auto y_cls   = hypot_detail::classify(y);
+		const auto any_inf = x_cls.inf | y_cls.inf;
+		const auto special = any_inf | x_cls.nan | y_cls.nan;
+
+		const DVec xd	 = pp::static_simd_cast<double>(pp::simd_select(special, FVec(0.0F), x));
+		const DVec yd	 = pp::static_simd_cast<double>(pp::simd_select(special, FVec(0.0F), y));
+		const FVec plain = pp::static_simd_cast<float>(hypot_detail::lane_sqrt(xd * xd + yd * yd));
+		if (!pp::any_of(special)) { return plain; }
+
+		const FVec nx = pp::simd_select(x_cls.nan, x, FVec(0.0F));
+		const FVec ny = pp::simd_select(y_cls.nan, y, FVec(0.0F));
+		return pp::simd_select(special, hypot_detail::special_result<float, Abi>(any_inf, nx, ny), plain);
+	}
+
+	// hypot(x, y, z) for vectors of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> hypot_simd_impl(pp::basic_simd<float, Abi> const & x, pp::basic_simd<float, Abi> const & y,
+																				pp::basic_simd<float, Abi> const & z) noexcept
+	{
+		using FVec		   = pp::basic_simd<float, Abi>;
+		using DVec		   = pp::basic_simd<double, Abi>;
+		const auto x_cls   = hypot_detail::classify(x);
+		const auto y_cls   = hypot_detail::classify(y);
+		const auto z_cls   = hypot_detail::classify(z);
+		const auto any_inf = x_cls.inf | y_cls.inf | z_cls.inf;
+		const auto special = any_inf | x_cls.nan | y_cls.nan | z_cls.nan;
+
+		const DVec xd	 = pp::static_simd_cast<double>(pp::simd_select(special, FVec(0.0F), x));
+		const DVec yd	 = pp::static_simd_cast<double>(pp::simd_select(special, FVec(0.0F), y));
+		const DVec zd	 = pp::static_simd_cast<double>(pp::simd_select(special, FVec(0.0F), z));
+		const FVec plain = pp::static_simd_cast<float>(hypot_detail::lane_sqrt((xd * xd + yd * yd) + zd * zd));
+		if (!pp::any_of(special)) { return plain; }
+
+		const FVec nx = pp::simd_select(x_cls.nan, x, FVec(0.0F));
+		const FVec ny = pp::simd_select(y_cls.nan, y, FVec(0.0F));
+		const FVec nz = pp::simd_select(z_cls.nan, z, FVec(0.0F));
+		return pp::simd_select(special, hypot_detail::special_result<float, Abi>(any_inf, nx, ny, nz), plain);
+	}
+} // namespace ccm::internal::impl
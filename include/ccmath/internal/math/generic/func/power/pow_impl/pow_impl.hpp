@@ -21,6 +21,7 @@
 #include "ccmath/internal/support/helpers/internal_ldexp.hpp"
 #include "ccmath/internal/support/is_constant_evaluated.hpp"
 #include "ccmath/internal/support/multiply_add.hpp"
+#include "ccmath/internal/support/path_stats.hpp"
 #include "ccmath/internal/support/poly_eval.hpp"
 #include "ccmath/internal/types/big_int.hpp"
 #include "ccmath/internal/types/double_double.hpp"
@@ -570,6 +571,7 @@ namespace ccm::gen::impl
 			FPBits_t base_bits(base);
 			int exponent_adjust = 0;
 
+			// A subnormal base is counted as pow_subnormal_base in place of the reconstruction path below.
 			if (base_bits.is_subnormal())
 			{
 				base *= 0x1.0p52;
@@ -673,6 +675,12 @@ namespace ccm::gen::impl
 			// and only the raised flag matters.
 			if (!clamped)
 			{
+				if (exponent_adjust != 0) { CCM_PATH_HIT(pow_subnormal_base); }
+				else if (scale == 1.0) { CCM_PATH_HIT(pow_double_double); }
+				else
+				{
+					CCM_PATH_HIT(pow_scaled_range);
+				}
 				const double dd = pow_double_double(idx_x, dx, static_cast<double>(e_x), y6, sign, scale);
 				if (scale != 1.0)
 				{
@@ -691,6 +699,11 @@ namespace ccm::gen::impl
 				return dd;
 			}
 
+			if (exponent_adjust != 0) { CCM_PATH_HIT(pow_subnormal_base); }
+			else
+			{
+				CCM_PATH_HIT(pow_clamped);
+			}
 			const double hm		= support::fp::nearest_integer(y6_log2_x.hi);
 			const double lo6_hi = y6_log2_x.hi - hm;
 			const double lo6	= lo6_hi + y6_log2_x.lo;
@@ -765,13 +778,22 @@ namespace ccm::gen::impl
 			if (base_bits.is_signaling_nan() || exp_bits.is_signaling_nan()) { support::fenv::raise_except_if_required(FE_INVALID); }
 #endif
 
-			if (exp_bits.is_zero()) { return 1.0; }								// pow(x, +/-0) = 1, including NaN x
-			if (base_bits.uintval() == FPBits_t(1.0).uintval()) { return 1.0; } // pow(1, y) = 1, including NaN y
+			// pow(x, +/-0) = 1, including NaN x, and pow(1, y) = 1, including NaN y.
+			if (exp_bits.is_zero() || base_bits.uintval() == FPBits_t(1.0).uintval())
+			{
+				CCM_PATH_HIT(pow_special_operand);
+				return 1.0;
+			}
 
-			if (base_bits.is_nan() || exp_bits.is_nan()) { return std::numeric_limits<double>::quiet_NaN(); }
+			if (base_bits.is_nan() || exp_bits.is_nan())
+			{
+				CCM_PATH_HIT(pow_special_operand);
+				return std::numeric_limits<double>::quiet_NaN();
+			}
 
 			if (base_bits.is_zero())
 			{
+				CCM_PATH_HIT(pow_special_operand);
 				const bool out_is_neg = base_bits.sign().is_neg() && is_odd_integer(exp);
 
 				if (exp < 0.0)
@@ -786,6 +808,7 @@ namespace ccm::gen::impl
 
 			if (base_bits.is_inf())
 			{
+				CCM_PATH_HIT(pow_special_operand);
 				// pow(+/-inf, y) is never a domain error. A negative infinite base only flips the
 				// result sign when the exponent is an odd integer, otherwise the magnitude rule for
 				// +inf applies (including non-integer exponents, e.g. pow(-inf, 0.5) = +inf).
@@ -796,6 +819,7 @@ namespace ccm::gen::impl
 
 			if (exp_bits.is_inf())
 			{
+				CCM_PATH_HIT(pow_special_operand);
 				const std::uint64_t base_abs = base_bits.abs().uintval();
 				const std::uint64_t one_bits = FPBits_t(1.0).uintval();
 
@@ -808,6 +832,7 @@ namespace ccm::gen::impl
 
 			if (base < 0.0 && !is_integer(exp))
 			{
+				CCM_PATH_HIT(pow_special_operand);
 				support::fenv::set_errno_if_required(EDOM);
 				support::fenv::raise_except_if_required(FE_INVALID);
 				return std::numeric_limits<double>::quiet_NaN();
@@ -848,7 +873,11 @@ namespace ccm::gen::impl
 						// the reciprocal, or a subnormal that the single reciprocal cannot grid-round
 						// without double rounding) fall through to the kernel.
 						const double r = support::helpers::internal_ldexp(pow_int_detail::reciprocal(sp.mantissa), static_cast<int>(-sp.exp2));
-						if (const FPBits_t r_bits(r); r_bits.is_finite() && !r_bits.is_zero() && !r_bits.is_subnormal()) { return r; }
+						if (const FPBits_t r_bits(r); r_bits.is_finite() && !r_bits.is_zero() && !r_bits.is_subnormal())
+						{
+							CCM_PATH_HIT(pow_integer_exponent);
+							return r;
+						}
 					}
 					else
 					{
@@ -862,6 +891,7 @@ namespace ccm::gen::impl
 								support::fenv::set_errno_if_required(ERANGE);
 								support::fenv::raise_except_if_required(FE_UNDERFLOW);
 							}
+							CCM_PATH_HIT(pow_integer_exponent);
 							return r;
 						}
 					}
@@ -883,8 +913,16 @@ namespace ccm::gen::impl
 				// is correctly rounded by an exact residual test (a bare double-double 1/sqrt sits a
 				// directed-mode ULP short for x just past a power of two). The double-double squaring
 				// below cannot resolve those two, so they are intercepted first.
-				if (exp == 0.5) { return ccm::gen::sqrt_gen<double>(base); }
-				if (exp == -0.5) { return pow_int_detail::cr_rsqrt(base, support::fenv::get_rounding_mode()); }
+				if (exp == 0.5)
+				{
+					CCM_PATH_HIT(pow_half_integer_exponent);
+					return ccm::gen::sqrt_gen<double>(base);
+				}
+				if (exp == -0.5)
+				{
+					CCM_PATH_HIT(pow_half_integer_exponent);
+					return pow_int_detail::cr_rsqrt(base, support::fenv::get_rounding_mode());
+				}
 
 				const auto m					   = static_cast<std::int64_t>(two_exp);
 				const std::uint64_t mag			   = m < 0 ? static_cast<std::uint64_t>(-(m + 1)) + 1U : static_cast<std::uint64_t>(m);
@@ -894,7 +932,11 @@ namespace ccm::gen::impl
 					// Negative half-integer: reciprocal of the odd power then an exact scale; a
 					// non-normal result falls through to the kernel.
 					const double r = support::helpers::internal_ldexp(pow_int_detail::reciprocal(sp.mantissa), static_cast<int>(-sp.exp2));
-					if (const FPBits_t r_bits(r); r_bits.is_finite() && !r_bits.is_zero() && !r_bits.is_subnormal()) { return r; }
+					if (const FPBits_t r_bits(r); r_bits.is_finite() && !r_bits.is_zero() && !r_bits.is_subnormal())
+					{
+						CCM_PATH_HIT(pow_half_integer_exponent);
+						return r;
+					}
 				}
 				else
 				{
@@ -906,6 +948,7 @@ namespace ccm::gen::impl
 							support::fenv::set_errno_if_required(ERANGE);
 							support::fenv::raise_except_if_required(FE_UNDERFLOW);
 						}
+						CCM_PATH_HIT(pow_half_integer_exponent);
 						return r;
 					}
 				}
@@ -20,7 +20,9 @@
 
 #include "ccmath/internal/math/generic/func/power/pow_impl/pow_impl.hpp"
 #include "ccmath/internal/math/generic/func/power/pow_impl/powf_simd_impl.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
 #include "ccmath/internal/support/common_math_constants.hpp"
+#include "ccmath/internal/support/path_stats.hpp"
 
 #include <cstddef>
 #include <cstdint>
@@ -128,7 +130,7 @@ namespace ccm::gen::impl
 
 	// x^y for a vector of double precision lanes.
 	template <typename Abi>
-	[[nodiscard]] inline pp::basic_simd<double, Abi> pow_simd(pp::basic_simd<double, Abi> x, pp::basic_simd<double, Abi> y) noexcept
+	[[nodiscard]] inline pp::basic_simd<double, Abi> pow_simd(pp::basic_simd<double, Abi> const & x, pp::basic_simd<double, Abi> const & y) noexcept
 	{
 		using DVec = pp::basic_simd<double, Abi>;
 		using U64  = pp::basic_simd<std::uint64_t, Abi>;
@@ -141,6 +143,7 @@ namespace ccm::gen::impl
 		// bit-identical vector replay is only possible on FMA targets. Fall back otherwise.
 		if constexpr (!ccm::builtin::target_cpu_has_fma)
 		{
+			CCM_PATH_HIT_N(pow_lane_scalar_fallback, N);
 			DVec out{};
 			for (int i = 0; i < N; ++i) { out[i] = ccm::gen::impl::pow_impl(x[i], y[i]); }
 			return out;
@@ -286,6 +289,8 @@ namespace ccm::gen::impl
 			// as the scalar reconstruction does.
 			DVec result = rr.hi + rr.lo;
 
+			CCM_PATH_HIT_N(pow_lane_vector, N - pp::reduce_count(needs_scalar));
+			CCM_PATH_HIT_N(pow_lane_scalar_fallback, pp::reduce_count(needs_scalar));
 			if (pp::any_of(needs_scalar))
 			{
 				for (int i = 0; i < N; ++i)
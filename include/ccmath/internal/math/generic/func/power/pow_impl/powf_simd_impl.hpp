@@ -57,7 +57,7 @@ namespace ccm::gen::impl
 
 	// x^y for a vector of single precision lanes.
 	template <typename Abi>
-	[[nodiscard]] inline pp::basic_simd<float, Abi> powf_simd(pp::basic_simd<float, Abi> x, pp::basic_simd<float, Abi> y) noexcept
+	[[nodiscard]] inline pp::basic_simd<float, Abi> powf_simd(pp::basic_simd<float, Abi> const & x, pp::basic_simd<float, Abi> const & y) noexcept
 	{
 		using FVec = pp::basic_simd<float, Abi>;
 		using DVec = pp::basic_simd<double, Abi>;
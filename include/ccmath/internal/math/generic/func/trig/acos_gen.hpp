@@ -10,7 +10,20 @@
 
 #pragma once
 
-namespace ccm
-{
+#include "ccmath/math/trig/impl/inv_trig_impl.hpp"
+
+#include <type_traits>
 
-} // namespace ccm
+namespace ccm::gen
+{
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T acos_gen(T num) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::acos_float(num); }
+		else if constexpr (std::is_same_v<T, double>) { return ccm::internal::impl::acos_double(num); }
+		else
+		{
+			return static_cast<T>(ccm::internal::impl::acos_double(static_cast<double>(num)));
+		}
+	}
+} // namespace ccm::gen
@@ -10,7 +10,20 @@
 
 #pragma once
 
-namespace ccm
-{
+#include "ccmath/math/trig/impl/inv_trig_impl.hpp"
+
+#include <type_traits>
 
-} // namespace ccm
+namespace ccm::gen
+{
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T atan2_gen(T y, T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::atan2_float(y, x); }
+		else if constexpr (std::is_same_v<T, double>) { return ccm::internal::impl::atan2_double(y, x); }
+		else
+		{
+			return static_cast<T>(ccm::internal::impl::atan2_double(static_cast<double>(y), static_cast<double>(x)));
+		}
+	}
+} // namespace ccm::gen
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/math/trig/impl/sincos_double_impl.hpp"
+#include "ccmath/math/trig/impl/sincos_float_impl.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
+{
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sincos_gen(T num, T & sin_out, T & cos_out) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { ccm::internal::sincos_float(num, sin_out, cos_out); }
+		else if constexpr (std::is_same_v<T, double>) { ccm::internal::sincos_double(num, sin_out, cos_out); }
+		else
+		{
+			double sin_dbl{};
+			double cos_dbl{};
+			ccm::internal::sincos_double(static_cast<double>(num), sin_dbl, cos_dbl);
+			sin_out = static_cast<T>(sin_dbl);
+			cos_out = static_cast<T>(cos_dbl);
+		}
+	}
+} // namespace ccm::gen
@@ -10,10 +10,9 @@
 
 #pragma once
 
-#include "ccmath/internal/math/generic/func/trig/cos_gen.hpp"
-#include "ccmath/internal/math/generic/func/trig/sin_gen.hpp"
+#include "ccmath/math/trig/impl/tan_double_impl.hpp"
+#include "ccmath/math/trig/impl/tan_float_impl.hpp"
 
-#include <limits>
 #include <type_traits>
 
 namespace ccm::gen
@@ -21,11 +20,11 @@ namespace ccm::gen
 	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
 	constexpr T tan_gen(T num) noexcept
 	{
-		const T s = sin_gen(num);
-		const T c = cos_gen(num);
-
-		if (c == static_cast<T>(0)) { return std::numeric_limits<T>::quiet_NaN(); }
-
-		return s / c;
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::tan_float(num); }
+		else if constexpr (std::is_same_v<T, double>) { return ccm::internal::tan_double(num); }
+		else
+		{
+			return static_cast<T>(ccm::internal::tan_double(static_cast<double>(num)));
+		}
 	}
 } // namespace ccm::gen
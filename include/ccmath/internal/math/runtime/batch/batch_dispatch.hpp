@@ -0,0 +1,543 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Shared driver for the ccm::batch entry points. The rounding mode is checked
+// once per call instead of once per element. Under round to nearest the input
+// is processed in native_simd blocks by a vector kernel followed by a scalar
+// tail; any other rounding mode, or a build without runtime SIMD, runs the
+// scalar kernel over the whole range. The vector kernels are bit identical to
+// the scalar kernels, so the result never depends on which path was taken.
+//
+// On x86 with GCC or Clang the drivers also carry an AVX2 copy of the block
+// loop, compiled with CCM_TARGET("avx2") and flattened so the kernels inline
+// into it as 256-bit code. It is taken when native_simd is narrower than 256
+// bits (the build did not assume AVX2) and the running CPU reports AVX2, so a
+// baseline x86-64 binary reaches AVX2 width on capable hosts. The AVX2 copy
+// does not enable FMA: contraction of a * b + c would differ from the scalar
+// kernels of the baseline build. Hosts with AVX-512F/DQ/BW/VL get a third copy
+// that stays at 256 bits but lets the compiler use the AVX-512VL and DQ forms
+// (compares into k-registers, 64-bit integer multiplies and conversions), and
+// whose tail also goes through the vector kernel: the last partial block is
+// read and written with k-register masked loads and stores, and the unread
+// lanes repeat the first element of the tail so they raise nothing the real
+// elements do not. Full 512-bit blocks were measured slower than this: the
+// kernels' table lookups scalarize at 8 and 16 lanes. Define
+// CCM_CONFIG_NO_RUNTIME_DISPATCH to keep the compile-time selection only.
+// Unoptimized builds keep it too: flatten only inlines when optimizing, and
+// without it the kernels would pass 256-bit vectors between functions
+// compiled for different instruction sets, which have different ABIs.
+
+#include "ccmath/internal/math/runtime/func/rt_dispatch.hpp"
+#include "ccmath/internal/math/runtime/pp/pp.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/internal/predef/attributes/target.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/cpu_features.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#if defined(CCMATH_HAS_SIMD) && defined(CCM_HAS_TARGET_ATTRIBUTE) && defined(__OPTIMIZE__) && !defined(CCM_CONFIG_NO_RUNTIME_DISPATCH)
+	#define CCMATH_HAS_RUNTIME_DISPATCH 1
+	// AVX-512F brings its own FMA instructions. A build that already assumes FMA fuses the same
+	// expressions in the AVX-512 copy; any other build needs CCM_NO_FP_CONTRACT to keep them apart.
+	#if defined(__FMA__)
+		#define CCMATH_HAS_RUNTIME_DISPATCH_AVX512 1
+		#define CCM_BATCH_AVX512_FP_CONTRACT
+	#elif defined(CCM_HAS_NO_FP_CONTRACT)
+		#define CCMATH_HAS_RUNTIME_DISPATCH_AVX512 1
+		#define CCM_BATCH_AVX512_FP_CONTRACT CCM_NO_FP_CONTRACT
+	#endif
+	#ifdef CCMATH_HAS_RUNTIME_DISPATCH_AVX512
+		#include <immintrin.h>
+	#endif
+#endif
+
+namespace ccm::rt::batch_impl
+{
+	template <typename T>
+	inline constexpr bool vector_eligible_v = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+	// Instruction set tiers the block loops can run at.
+	enum class isa_tier
+	{
+		baseline, // native_simd, as selected at compile time
+		avx2,	  // 256-bit vectors in a CCM_TARGET("avx2") copy of the loop
+		avx512,	  // 256-bit vectors and masked tails in a CCM_TARGET("avx512f,avx512dq,avx512bw,avx512vl") copy of the loop
+	};
+
+	/**
+	 * @brief Returns the tier the batch drivers run at for element type T on this host.
+	 * @note The CPU is queried once per process; the result is the same for every call.
+	 */
+	template <typename T>
+	[[nodiscard]] inline isa_tier selected_tier() noexcept
+	{
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH
+		if constexpr (vector_eligible_v<T>)
+		{
+			constexpr std::size_t native_bytes = pp::native_simd<T>::size() * sizeof(T);
+	#ifdef CCMATH_HAS_RUNTIME_DISPATCH_AVX512
+			if constexpr (native_bytes < 64)
+			{
+				const ccm::support::cpu_features & features = ccm::support::host_cpu_features();
+				if (features.avx512f && features.avx512dq && features.avx512bw && features.avx512vl) { return isa_tier::avx512; }
+			}
+	#endif
+			if constexpr (native_bytes < 32)
+			{
+				if (ccm::support::host_cpu_features().avx2) { return isa_tier::avx2; }
+			}
+		}
+#endif
+		return isa_tier::baseline;
+	}
+
+	// Element type of a contiguous range, as seen through std::data.
+	template <typename Range>
+	using range_element_t = std::remove_pointer_t<decltype(std::data(std::declval<Range &>()))>;
+
+	// Enables the range overloads for a readable input range and a writable output range of the
+	// same floating-point element type (std::vector, std::array, std::span, ...).
+	template <typename In, typename Out>
+	using enable_if_ranges_t =
+		std::enable_if_t<std::is_floating_point_v<std::remove_const_t<range_element_t<In const>>> &&
+							 std::is_same_v<std::remove_const_t<range_element_t<In const>>, range_element_t<std::remove_reference_t<Out>>>,
+						 bool>;
+
+	template <typename In, typename Out>
+	[[nodiscard]] constexpr std::size_t range_count(In const & in, Out const & out) noexcept
+	{
+		const auto in_size	= static_cast<std::size_t>(std::size(in));
+		const auto out_size = static_cast<std::size_t>(std::size(out));
+		return in_size < out_size ? in_size : out_size;
+	}
+
+	// Also serves the two-input overloads as range_count(in0, in1, out).
+	template <typename In, typename Out0, typename Out1>
+	[[nodiscard]] constexpr std::size_t range_count(In const & in, Out0 const & out0, Out1 const & out1) noexcept
+	{
+		const std::size_t first = range_count(in, out0);
+		const auto out1_size	= static_cast<std::size_t>(std::size(out1));
+		return first < out1_size ? first : out1_size;
+	}
+
+	// Serves the three-input overloads as range_count(in0, in1, in2, out).
+	template <typename In0, typename In1, typename In2, typename Out>
+	[[nodiscard]] constexpr std::size_t range_count(In0 const & in0, In1 const & in1, In2 const & in2, Out const & out) noexcept
+	{
+		const std::size_t first = range_count(in0, in1, in2);
+		const auto out_size		= static_cast<std::size_t>(std::size(out));
+		return first < out_size ? first : out_size;
+	}
+
+	template <typename T, typename ScalarFn>
+	inline void unary_scalar(T const * in, T * out, std::size_t count, ScalarFn scalar_fn) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) { out[i] = scalar_fn(in[i]); }
+	}
+
+	template <typename T, typename ScalarFn>
+	inline void binary_scalar(T const * in0, T const * in1, T * out, std::size_t count, ScalarFn scalar_fn) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) { out[i] = scalar_fn(in0[i], in1[i]); }
+	}
+
+	template <typename T, typename ScalarFn>
+	inline void ternary_scalar(T const * in0, T const * in1, T const * in2, T * out, std::size_t count, ScalarFn scalar_fn) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) { out[i] = scalar_fn(in0[i], in1[i], in2[i]); }
+	}
+
+	template <typename T, typename ScalarFn>
+	inline void unary_pair_scalar(T const * in, T * out0, T * out1, std::size_t count, ScalarFn scalar_fn) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const T x = in[i];
+			scalar_fn(x, out0[i], out1[i]);
+		}
+	}
+
+	// The block loops shared by every tier: whole V blocks through the vector kernel, then the
+	// remainder through the scalar kernel.
+	template <typename V, typename T, typename VectorOp, typename ScalarFn>
+	CCM_ALWAYS_INLINE void unary_blocks(T const * in, T * out, std::size_t count, VectorOp & vector_op, ScalarFn & scalar_fn) noexcept
+	{
+		constexpr auto width = static_cast<std::size_t>(V::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width)
+		{
+			const V x(in + i, pp::element_aligned);
+			vector_op(x).copy_to(out + i, pp::element_aligned);
+		}
+		unary_scalar(in + i, out + i, count - i, scalar_fn);
+	}
+
+	template <typename V, typename T, typename VectorOp, typename ScalarFn>
+	CCM_ALWAYS_INLINE void binary_blocks(T const * in0, T const * in1, T * out, std::size_t count, VectorOp & vector_op, ScalarFn & scalar_fn) noexcept
+	{
+		constexpr auto width = static_cast<std::size_t>(V::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width)
+		{
+			const V a(in0 + i, pp::element_aligned);
+			const V b(in1 + i, pp::element_aligned);
+			vector_op(a, b).copy_to(out + i, pp::element_aligned);
+		}
+		binary_scalar(in0 + i, in1 + i, out + i, count - i, scalar_fn);
+	}
+
+	template <typename V, typename T, typename VectorOp, typename ScalarFn>
+	CCM_ALWAYS_INLINE void ternary_blocks(T const * in0, T const * in1, T const * in2, T * out, std::size_t count, VectorOp & vector_op,
+										  ScalarFn & scalar_fn) noexcept
+	{
+		constexpr auto width = static_cast<std::size_t>(V::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width)
+		{
+			const V a(in0 + i, pp::element_aligned);
+			const V b(in1 + i, pp::element_aligned);
+			const V c(in2 + i, pp::element_aligned);
+			vector_op(a, b, c).copy_to(out + i, pp::element_aligned);
+		}
+		ternary_scalar(in0 + i, in1 + i, in2 + i, out + i, count - i, scalar_fn);
+	}
+
+	template <typename V, typename T, typename VectorOp, typename ScalarFn>
+	CCM_ALWAYS_INLINE void unary_pair_blocks(T const * in, T * out0, T * out1, std::size_t count, VectorOp & vector_op, ScalarFn & scalar_fn) noexcept
+	{
+		constexpr auto width = static_cast<std::size_t>(V::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width)
+		{
+			const V x(in + i, pp::element_aligned);
+			V r0;
+			V r1;
+			vector_op(x, r0, r1);
+			r0.copy_to(out0 + i, pp::element_aligned);
+			r1.copy_to(out1 + i, pp::element_aligned);
+		}
+		unary_pair_scalar(in + i, out0 + i, out1 + i, count - i, scalar_fn);
+	}
+
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH
+	template <typename T>
+	using avx2_simd = pp::simd<T, static_cast<int>(32 / sizeof(T))>;
+
+	// Only reached once selected_tier() has seen AVX2 on the running CPU.
+	template <typename T, typename VectorOp, typename ScalarFn>
+	CCM_TARGET("avx2") CCM_FLATTEN void unary_avx2(T const * in, T * out, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{ unary_blocks<avx2_simd<T>>(in, out, count, vector_op, scalar_fn); }
+
+	template <typename T, typename VectorOp, typename ScalarFn>
+	CCM_TARGET("avx2") CCM_FLATTEN void binary_avx2(T const * in0, T const * in1, T * out, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{ binary_blocks<avx2_simd<T>>(in0, in1, out, count, vector_op, scalar_fn); }
+
+	template <typename T, typename VectorOp, typename ScalarFn>
+	CCM_TARGET("avx2") CCM_FLATTEN void ternary_avx2(T const * in0, T const * in1, T const * in2, T * out, std::size_t count, VectorOp vector_op,
+													 ScalarFn scalar_fn) noexcept
+	{ ternary_blocks<avx2_simd<T>>(in0, in1, in2, out, count, vector_op, scalar_fn); }
+
+	template <typename T, typename VectorOp, typename ScalarFn>
+	CCM_TARGET("avx2") CCM_FLATTEN void unary_pair_avx2(T const * in, T * out0, T * out1, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{ unary_pair_blocks<avx2_simd<T>>(in, out0, out1, count, vector_op, scalar_fn); }
+#endif
+
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH_AVX512
+	// The AVX-512 copy keeps 256-bit blocks; see the note at the top of the file.
+	template <typename T>
+	using avx512_simd = pp::simd<T, static_cast<int>(32 / sizeof(T))>;
+
+	// Loads the count < size() elements at ptr into the low lanes; the other lanes repeat ptr[0].
+	template <typename T>
+	CCM_TARGET("avx512f,avx512dq,avx512bw,avx512vl") CCM_BATCH_AVX512_FP_CONTRACT CCM_ALWAYS_INLINE avx512_simd<T> load_tail_avx512(T const * ptr, std::size_t count) noexcept
+	{
+		const auto mask = static_cast<__mmask8>((1U << count) - 1U);
+		if constexpr (std::is_same_v<T, float>) { return avx512_simd<T>::from_member(_mm256_mask_loadu_ps(_mm256_set1_ps(ptr[0]), mask, ptr)); }
+		else
+		{
+			return avx512_simd<T>::from_member(_mm256_mask_loadu_pd(_mm256_set1_pd(ptr[0]), mask, ptr));
+		}
+	}
+
+	// Stores the low count < size() lanes of v to ptr without touching the memory past them.
+	template <typename T>
+	CCM_TARGET("avx512f,avx512dq,avx512bw,avx512vl") CCM_BATCH_AVX512_FP_CONTRACT CCM_ALWAYS_INLINE void store_tail_avx512(avx512_simd<T> const & v, T * ptr, std::size_t count) noexcept
+	{
+		const auto mask = static_cast<__mmask8>((1U << count) - 1U);
+		if constexpr (std::is_same_v<T, float>) { _mm256_mask_storeu_ps(ptr, mask, v.get()); }
+		else
+		{
+			_mm256_mask_storeu_pd(ptr, mask, v.get());
+		}
+	}
+
+	// Only reached once selected_tier() has seen AVX-512F/DQ/BW/VL on the running CPU. scalar_fn is unused:
+	// the tail runs through the vector kernel as a masked block.
+	template <typename T, typename VectorOp, typename ScalarFn>
+	CCM_TARGET("avx512f,avx512dq,avx512bw,avx512vl") CCM_BATCH_AVX512_FP_CONTRACT CCM_FLATTEN void unary_avx512(T const * in, T * out, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{
+		using V				 = avx512_simd<T>;
+		constexpr auto width = static_cast<std::size_t>(V::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width)
+		{
+			const V x(in + i, pp::element_aligned);
+			vector_op(x).copy_to(out + i, pp::element_aligned);
+		}
+		if (i < count) { store_tail_avx512<T>(vector_op(load_tail_avx512(in + i, count - i)), out + i, count - i); }
+		static_cast<void>(scalar_fn);
+	}
+
+	template <typename T, typename VectorOp, typename ScalarFn>
+	CCM_TARGET("avx512f,avx512dq,avx512bw,avx512vl") CCM_BATCH_AVX512_FP_CONTRACT CCM_FLATTEN void binary_avx512(T const * in0, T const * in1, T * out, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{
+		using V				 = avx512_simd<T>;
+		constexpr auto width = static_cast<std::size_t>(V::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width)
+		{
+			const V a(in0 + i, pp::element_aligned);
+			const V b(in1 + i, pp::element_aligned);
+			vector_op(a, b).copy_to(out + i, pp::element_aligned);
+		}
+		if (i < count)
+		{
+			const std::size_t rest = count - i;
+			store_tail_avx512<T>(vector_op(load_tail_avx512(in0 + i, rest), load_tail_avx512(in1 + i, rest)), out + i, rest);
+		}
+		static_cast<void>(scalar_fn);
+	}
+
+	template <typename T, typename VectorOp, typename ScalarFn>
+	CCM_TARGET("avx512f,avx512dq,avx512bw,avx512vl") CCM_BATCH_AVX512_FP_CONTRACT CCM_FLATTEN void ternary_avx512(T const * in0, T const * in1, T const * in2, T * out, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{
+		using V				 = avx512_simd<T>;
+		constexpr auto width = static_cast<std::size_t>(V::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width)
+		{
+			const V a(in0 + i, pp::element_aligned);
+			const V b(in1 + i, pp::element_aligned);
+			const V c(in2 + i, pp::element_aligned);
+			vector_op(a, b, c).copy_to(out + i, pp::element_aligned);
+		}
+		if (i < count)
+		{
+			const std::size_t rest = count - i;
+			const V a			   = load_tail_avx512(in0 + i, rest);
+			const V b			   = load_tail_avx512(in1 + i, rest);
+			const V c			   = load_tail_avx512(in2 + i, rest);
+			store_tail_avx512<T>(vector_op(a, b, c), out + i, rest);
+		}
+		static_cast<void>(scalar_fn);
+	}
+
+	template <typename T, typename VectorOp, typename ScalarFn>
+	CCM_TARGET("avx512f,avx512dq,avx512bw,avx512vl") CCM_BATCH_AVX512_FP_CONTRACT CCM_FLATTEN void unary_pair_avx512(T const * in, T * out0, T * out1, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{
+		using V				 = avx512_simd<T>;
+		constexpr auto width = static_cast<std::size_t>(V::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width)
+		{
+			const V x(in + i, pp::element_aligned);
+			V r0;
+			V r1;
+			vector_op(x, r0, r1);
+			r0.copy_to(out0 + i, pp::element_aligned);
+			r1.copy_to(out1 + i, pp::element_aligned);
+		}
+		if (i < count)
+		{
+			const std::size_t rest = count - i;
+			V r0;
+			V r1;
+			vector_op(load_tail_avx512(in + i, rest), r0, r1);
+			store_tail_avx512<T>(r0, out0 + i, rest);
+			store_tail_avx512<T>(r1, out1 + i, rest);
+		}
+		static_cast<void>(scalar_fn);
+	}
+#endif
+
+	/**
+	 * @brief Applies a unary kernel to count elements of in and writes the results to out.
+	 * @param in Input elements. May alias out exactly.
+	 * @param out Output elements. Must have room for count elements.
+	 * @param count Number of elements to process.
+	 * @param vector_op Callable taking and returning pp::native_simd<T>.
+	 * @param scalar_fn Callable taking and returning T, bit identical to vector_op per lane.
+	 */
+	template <typename T, typename VectorOp, typename ScalarFn>
+	inline void unary(T const * in, T * out, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		if constexpr (vector_eligible_v<T>)
+		{
+			using V				 = pp::native_simd<T>;
+			constexpr auto width = static_cast<std::size_t>(V::size());
+
+			if constexpr (width > 1)
+			{
+				if (CCM_UNLIKELY(!detail::simd_runtime_ok<T>())) { return unary_scalar(in, out, count, scalar_fn); }
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH
+				switch (selected_tier<T>())
+				{
+	#ifdef CCMATH_HAS_RUNTIME_DISPATCH_AVX512
+				case isa_tier::avx512: return unary_avx512(in, out, count, vector_op, scalar_fn);
+	#endif
+				case isa_tier::avx2: return unary_avx2(in, out, count, vector_op, scalar_fn);
+				case isa_tier::baseline: break;
+				}
+#endif
+				return unary_blocks<V>(in, out, count, vector_op, scalar_fn);
+			}
+		}
+#else
+		static_cast<void>(vector_op);
+#endif
+		unary_scalar(in, out, count, scalar_fn);
+	}
+
+	/**
+	 * @brief Applies a binary kernel to count element pairs of in0 and in1 and writes the results to out.
+	 * @param in0 First operands. May alias out exactly.
+	 * @param in1 Second operands. May alias out exactly.
+	 * @param out Output elements. Must have room for count elements.
+	 * @param count Number of elements to process.
+	 * @param vector_op Callable taking two pp::native_simd<T> and returning pp::native_simd<T>.
+	 * @param scalar_fn Callable taking two T and returning T, bit identical to vector_op per lane.
+	 */
+	template <typename T, typename VectorOp, typename ScalarFn>
+	inline void binary(T const * in0, T const * in1, T * out, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		if constexpr (vector_eligible_v<T>)
+		{
+			using V				 = pp::native_simd<T>;
+			constexpr auto width = static_cast<std::size_t>(V::size());
+
+			if constexpr (width > 1)
+			{
+				if (CCM_UNLIKELY(!detail::simd_runtime_ok<T>())) { return binary_scalar(in0, in1, out, count, scalar_fn); }
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH
+				switch (selected_tier<T>())
+				{
+	#ifdef CCMATH_HAS_RUNTIME_DISPATCH_AVX512
+				case isa_tier::avx512: return binary_avx512(in0, in1, out, count, vector_op, scalar_fn);
+	#endif
+				case isa_tier::avx2: return binary_avx2(in0, in1, out, count, vector_op, scalar_fn);
+				case isa_tier::baseline: break;
+				}
+#endif
+				return binary_blocks<V>(in0, in1, out, count, vector_op, scalar_fn);
+			}
+		}
+#else
+		static_cast<void>(vector_op);
+#endif
+		binary_scalar(in0, in1, out, count, scalar_fn);
+	}
+
+	/**
+	 * @brief Applies a ternary kernel to count element triples of in0, in1 and in2 and writes the results to out.
+	 * @param in0 First operands. May alias out exactly.
+	 * @param in1 Second operands. May alias out exactly.
+	 * @param in2 Third operands. May alias out exactly.
+	 * @param out Output elements. Must have room for count elements.
+	 * @param count Number of elements to process.
+	 * @param vector_op Callable taking three pp::native_simd<T> and returning pp::native_simd<T>.
+	 * @param scalar_fn Callable taking three T and returning T, bit identical to vector_op per lane.
+	 */
+	template <typename T, typename VectorOp, typename ScalarFn>
+	inline void ternary(T const * in0, T const * in1, T const * in2, T * out, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		if constexpr (vector_eligible_v<T>)
+		{
+			using V				 = pp::native_simd<T>;
+			constexpr auto width = static_cast<std::size_t>(V::size());
+
+			if constexpr (width > 1)
+			{
+				if (CCM_UNLIKELY(!detail::simd_runtime_ok<T>())) { return ternary_scalar(in0, in1, in2, out, count, scalar_fn); }
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH
+				switch (selected_tier<T>())
+				{
+	#ifdef CCMATH_HAS_RUNTIME_DISPATCH_AVX512
+				case isa_tier::avx512: return ternary_avx512(in0, in1, in2, out, count, vector_op, scalar_fn);
+	#endif
+				case isa_tier::avx2: return ternary_avx2(in0, in1, in2, out, count, vector_op, scalar_fn);
+				case isa_tier::baseline: break;
+				}
+#endif
+				return ternary_blocks<V>(in0, in1, in2, out, count, vector_op, scalar_fn);
+			}
+		}
+#else
+		static_cast<void>(vector_op);
+#endif
+		ternary_scalar(in0, in1, in2, out, count, scalar_fn);
+	}
+
+	/**
+	 * @brief Applies a kernel with two results to count elements of in, writing them to out0 and out1.
+	 * @param in Input elements. May alias either output exactly.
+	 * @param out0 First outputs. Must have room for count elements.
+	 * @param out1 Second outputs. Must have room for count elements.
+	 * @param count Number of elements to process.
+	 * @param vector_op Callable taking a pp::native_simd<T> and two pp::native_simd<T> references to fill.
+	 * @param scalar_fn Callable taking T and two T references to fill, bit identical to vector_op per lane.
+	 */
+	template <typename T, typename VectorOp, typename ScalarFn>
+	inline void unary_pair(T const * in, T * out0, T * out1, std::size_t count, VectorOp vector_op, ScalarFn scalar_fn) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		if constexpr (vector_eligible_v<T>)
+		{
+			using V				 = pp::native_simd<T>;
+			constexpr auto width = static_cast<std::size_t>(V::size());
+
+			if constexpr (width > 1)
+			{
+				if (CCM_UNLIKELY(!detail::simd_runtime_ok<T>())) { return unary_pair_scalar(in, out0, out1, count, scalar_fn); }
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH
+				switch (selected_tier<T>())
+				{
+	#ifdef CCMATH_HAS_RUNTIME_DISPATCH_AVX512
+				case isa_tier::avx512: return unary_pair_avx512(in, out0, out1, count, vector_op, scalar_fn);
+	#endif
+				case isa_tier::avx2: return unary_pair_avx2(in, out0, out1, count, vector_op, scalar_fn);
+				case isa_tier::baseline: break;
+				}
+#endif
+				return unary_pair_blocks<V>(in, out0, out1, count, vector_op, scalar_fn);
+			}
+		}
+#else
+		static_cast<void>(vector_op);
+#endif
+		unary_pair_scalar(in, out0, out1, count, scalar_fn);
+	}
+} // namespace ccm::rt::batch_impl
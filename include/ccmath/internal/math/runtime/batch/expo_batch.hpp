@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/expo/exp2_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/exp_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/expm1_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log10_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log1p_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log2_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log_gen.hpp"
+#include "ccmath/internal/math/runtime/batch/batch_dispatch.hpp"
+#include "ccmath/math/expo/impl/exp2_simd_impl.hpp"
+#include "ccmath/math/expo/impl/exp_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log10_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log2_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log_domain_impl.hpp"
+#include "ccmath/math/expo/impl/log_simd_impl.hpp"
+
+#include <cstddef>
+
+namespace ccm::rt::batch_impl
+{
+	template <typename T>
+	inline void exp_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::exp_simd_impl(x); }, [](T x) { return gen::exp_gen(x); });
+	}
+
+	template <typename T>
+	inline void exp2_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::exp2_simd_impl(x); }, [](T x) { return gen::exp2_gen(x); });
+	}
+
+	template <typename T>
+	inline void expm1_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary_scalar(in, out, count, [](T x) { return gen::expm1_gen(x); });
+	}
+
+	template <typename T>
+	inline void log_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		constexpr auto kernel = [](T v) { return gen::log_gen(v); };
+		unary(
+			in,
+			out,
+			count,
+			[=](auto const & x) { return ccm::internal::impl::log_domain_or(x, [](auto const & v) { return ccm::internal::impl::log_simd_impl(v); }, kernel); },
+			[=](T x) { return ccm::internal::impl::log_domain_or(x, kernel); });
+	}
+
+	template <typename T>
+	inline void log2_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		constexpr auto kernel = [](T v) { return gen::log2_gen(v); };
+		unary(
+			in,
+			out,
+			count,
+			[=](auto const & x) { return ccm::internal::impl::log_domain_or(x, [](auto const & v) { return ccm::internal::impl::log2_simd_impl(v); }, kernel); },
+			[=](T x) { return ccm::internal::impl::log_domain_or(x, kernel); });
+	}
+
+	template <typename T>
+	inline void log10_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		constexpr auto kernel = [](T v) { return gen::log10_gen(v); };
+		unary(
+			in,
+			out,
+			count,
+			[=](auto const & x) { return ccm::internal::impl::log_domain_or(x, [](auto const & v) { return ccm::internal::impl::log10_simd_impl(v); }, kernel); },
+			[=](T x) { return ccm::internal::impl::log_domain_or(x, kernel); });
+	}
+
+	template <typename T>
+	inline void log1p_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary_scalar(in, out, count, [](T x) { return gen::log1p_gen(x); });
+	}
+} // namespace ccm::rt::batch_impl
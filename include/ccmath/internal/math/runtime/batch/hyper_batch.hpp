@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/hyper/acosh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/asinh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/atanh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/cosh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/impl/hyper_simd_impl.hpp"
+#include "ccmath/internal/math/generic/func/hyper/impl/inv_hyper_simd_impl.hpp"
+#include "ccmath/internal/math/generic/func/hyper/sinh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/sinhcosh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/tanh_gen.hpp"
+#include "ccmath/internal/math/runtime/batch/batch_dispatch.hpp"
+
+#include <cstddef>
+
+namespace ccm::rt::batch_impl
+{
+	template <typename T>
+	inline void sinh_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::sinh_simd_impl(x); }, [](T x) { return gen::sinh_gen(x); });
+	}
+
+	template <typename T>
+	inline void cosh_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::cosh_simd_impl(x); }, [](T x) { return gen::cosh_gen(x); });
+	}
+
+	template <typename T>
+	inline void tanh_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::tanh_simd_impl(x); }, [](T x) { return gen::tanh_gen(x); });
+	}
+
+	template <typename T>
+	inline void sinhcosh_batch(T const * in, T * sinh_out, T * cosh_out, std::size_t count) noexcept
+	{
+		unary_pair(
+			in,
+			sinh_out,
+			cosh_out,
+			count,
+			[](auto const & x, auto & s, auto & c) { ccm::internal::impl::sinhcosh_simd_impl(x, s, c); },
+			[](T x, T & s, T & c) { gen::sinhcosh_gen(x, s, c); });
+	}
+
+	template <typename T>
+	inline void asinh_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::asinh_simd_impl(x); }, [](T x) { return gen::asinh_gen(x); });
+	}
+
+	template <typename T>
+	inline void acosh_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::acosh_simd_impl(x); }, [](T x) { return gen::acosh_gen(x); });
+	}
+
+	template <typename T>
+	inline void atanh_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::atanh_simd_impl(x); }, [](T x) { return gen::atanh_gen(x); });
+	}
+} // namespace ccm::rt::batch_impl
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/cbrt_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/hypot_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/impl/cbrt_simd_impl.hpp"
+#include "ccmath/internal/math/generic/func/power/impl/hypot_simd_impl.hpp"
+#include "ccmath/internal/math/runtime/batch/batch_dispatch.hpp"
+
+#include <cstddef>
+
+namespace ccm::rt::batch_impl
+{
+	template <typename T>
+	inline void cbrt_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::cbrt_simd_impl(x); }, [](T x) { return gen::cbrt_gen(x); });
+	}
+
+	template <typename T>
+	inline void hypot_batch(T const * x, T const * y, T * out, std::size_t count) noexcept
+	{
+		binary(
+			x,
+			y,
+			out,
+			count,
+			[](auto const & xv, auto const & yv) { return ccm::internal::impl::hypot_simd_impl(xv, yv); },
+			[](T xv, T yv) { return gen::hypot_gen(xv, yv); });
+	}
+
+	template <typename T>
+	inline void hypot_batch(T const * x, T const * y, T const * z, T * out, std::size_t count) noexcept
+	{
+		ternary(
+			x,
+			y,
+			z,
+			out,
+			count,
+			[](auto const & xv, auto const & yv, auto const & zv) { return ccm::internal::impl::hypot_simd_impl(xv, yv, zv); },
+			[](T xv, T yv, T zv) { return gen::hypot_gen(xv, yv, zv); });
+	}
+} // namespace ccm::rt::batch_impl
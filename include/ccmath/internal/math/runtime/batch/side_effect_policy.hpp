@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Side-effect policies accepted as the last argument of the ccm::batch entry points. Without a
+// policy a batch call reports errno and floating-point exceptions exactly as the scalar functions
+// would. With one, the kernels' errno writes and exception raises are skipped for the whole call
+// and the thread's exception flags are restored once it returns, so the call leaves no trace in
+// errno or in the floating-point environment. The policy is applied at run time: it saves and
+// restores the exception flags once per call, and every element that would report still checks
+// the thread's side-effect mode before skipping the report.
+
+#include "ccmath/internal/support/fenv/fenv_support.hpp"
+
+#include <cfenv>
+#include <type_traits>
+
+namespace ccm::batch
+{
+	/// Policy tag: the call writes no errno and leaves the floating-point exception flags as it found them.
+	struct no_side_effects_t
+	{
+		explicit no_side_effects_t() = default;
+	};
+	inline constexpr no_side_effects_t no_side_effects{};
+
+	/// Policy tag: as no_side_effects, and the call returns the exceptions it raised as one FE_* mask.
+	struct collect_exceptions_t
+	{
+		explicit collect_exceptions_t() = default;
+	};
+	inline constexpr collect_exceptions_t collect_exceptions{};
+} // namespace ccm::batch
+
+namespace ccm::rt::batch_impl
+{
+	template <typename Policy>
+	inline constexpr bool is_side_effect_policy_v = std::is_same_v<Policy, batch::no_side_effects_t> || std::is_same_v<Policy, batch::collect_exceptions_t>;
+
+	template <typename Policy>
+	using enable_if_policy_t = std::enable_if_t<is_side_effect_policy_v<Policy>, bool>;
+
+	/**
+	 * @brief Runs call without errno writes or exception raises, then restores the exception flags.
+	 */
+	template <typename Call>
+	inline void with_policy(batch::no_side_effects_t /* policy */, Call call) noexcept
+	{
+		std::fexcept_t saved{};
+		std::fegetexceptflag(&saved, FE_ALL_EXCEPT);
+		{
+			const support::fenv::internal::side_effect_scope scope(support::fenv::internal::side_effect_mode::eDiscard);
+			call();
+		}
+		std::fesetexceptflag(&saved, FE_ALL_EXCEPT);
+	}
+
+	/**
+	 * @brief Runs call without errno writes or exception raises, then restores the exception flags.
+	 * @return The FE_* exceptions the call raised, both those the kernels raise explicitly and those
+	 * set by the arithmetic itself. Which flags the arithmetic sets is up to the hardware; FE_INEXACT
+	 * in particular is raised by almost every call.
+	 */
+	template <typename Call>
+	[[nodiscard]] inline int with_policy(batch::collect_exceptions_t /* policy */, Call call) noexcept
+	{
+		std::fexcept_t saved{};
+		std::fegetexceptflag(&saved, FE_ALL_EXCEPT);
+		std::feclearexcept(FE_ALL_EXCEPT);
+		int raised = 0;
+		{
+			const support::fenv::internal::side_effect_scope scope(support::fenv::internal::side_effect_mode::eCollect);
+			call();
+			raised = support::fenv::internal::collected_excepts;
+		}
+		raised |= std::fetestexcept(FE_ALL_EXCEPT);
+		std::fesetexceptflag(&saved, FE_ALL_EXCEPT);
+		return raised;
+	}
+} // namespace ccm::rt::batch_impl
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/trig/acos_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/asin_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/atan2_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/atan_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/cos_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/sin_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/tan_gen.hpp"
+#include "ccmath/internal/math/runtime/batch/batch_dispatch.hpp"
+#include "ccmath/math/trig/impl/inv_trig_simd_impl.hpp"
+#include "ccmath/math/trig/impl/sincos_simd_impl.hpp"
+#include "ccmath/math/trig/impl/tan_simd_impl.hpp"
+
+#include <cstddef>
+
+namespace ccm::rt::batch_impl
+{
+	template <typename T>
+	inline void sin_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::sin_simd_impl(x); }, [](T x) { return gen::sin_gen(x); });
+	}
+
+	template <typename T>
+	inline void cos_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::cos_simd_impl(x); }, [](T x) { return gen::cos_gen(x); });
+	}
+
+	template <typename T>
+	inline void tan_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::tan_simd_impl(x); }, [](T x) { return gen::tan_gen(x); });
+	}
+
+	template <typename T>
+	inline void sincos_batch(T const * in, T * sin_out, T * cos_out, std::size_t count) noexcept
+	{
+		unary_pair(
+			in,
+			sin_out,
+			cos_out,
+			count,
+			[](auto const & x, auto & s, auto & c) { ccm::internal::impl::sincos_simd_impl(x, s, c); },
+			[](T x, T & s, T & c) { gen::sincos_gen(x, s, c); });
+	}
+
+	template <typename T>
+	inline void asin_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::asin_simd_impl(x); }, [](T x) { return gen::asin_gen(x); });
+	}
+
+	template <typename T>
+	inline void acos_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::acos_simd_impl(x); }, [](T x) { return gen::acos_gen(x); });
+	}
+
+	template <typename T>
+	inline void atan_batch(T const * in, T * out, std::size_t count) noexcept
+	{
+		unary(
+			in, out, count, [](auto const & x) { return ccm::internal::impl::atan_simd_impl(x); }, [](T x) { return gen::atan_gen(x); });
+	}
+
+	template <typename T>
+	inline void atan2_batch(T const * y, T const * x, T * out, std::size_t count) noexcept
+	{
+		binary(
+			y,
+			x,
+			out,
+			count,
+			[](auto const & yv, auto const & xv) { return ccm::internal::impl::atan2_simd_impl(yv, xv); },
+			[](T yv, T xv) { return gen::atan2_gen(yv, xv); });
+	}
+} // namespace ccm::rt::batch_impl
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/builtins/hyper/cosh.hpp"
+#include "ccmath/internal/math/generic/builtins/hyper/sinh.hpp"
+#include "ccmath/internal/math/generic/func/hyper/sinhcosh_gen.hpp"
+#include "ccmath/internal/math/runtime/func/hyper/cosh_rt.hpp"
+#include "ccmath/internal/math/runtime/func/hyper/sinh_rt.hpp"
+
+#include <type_traits>
+
+namespace ccm::rt
+{
+	// Each output matches sinh_rt and cosh_rt. When those resolve to the generic kernel the fused
+	// kernel computes both from one exp; when they resolve to libm the two calls are kept.
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void sinhcosh_rt(T num, T & sinh_out, T & cosh_out) noexcept
+	{
+		if constexpr (ccm::builtin::has_runtime_sinh<T> || ccm::builtin::has_runtime_cosh<T>)
+		{
+			sinh_out = ccm::rt::sinh_rt(num);
+			cosh_out = ccm::rt::cosh_rt(num);
+		}
+		else
+		{
+			gen::sinhcosh_gen(num, sinh_out, cosh_out);
+		}
+	}
+} // namespace ccm::rt
@@ -28,4 +28,19 @@ namespace ccm::rt
 			return simd_impl::binary_via_scalar_abi(x, y, scalar);
 		}
 	}
+
+	// There is no three argument builtin. float and double run the fused generic kernel; a long double
+	// builtin is chained instead, as the generic kernel would drop to double precision.
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	[[nodiscard]] inline T hypot_rt(T x, T y, T z) noexcept
+	{
+		if constexpr (!std::is_same_v<T, float> && !std::is_same_v<T, double> && ccm::builtin::has_runtime_hypot<T>)
+		{
+			return ccm::builtin::hypot_rt(ccm::builtin::hypot_rt(x, y), z);
+		}
+		else
+		{
+			return gen::hypot_gen(x, y, z);
+		}
+	}
 } // namespace ccm::rt
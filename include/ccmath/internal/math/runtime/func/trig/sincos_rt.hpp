@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/builtins/trig/cos.hpp"
+#include "ccmath/internal/math/generic/builtins/trig/sin.hpp"
+#include "ccmath/internal/math/generic/builtins/trig/sincos.hpp"
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+#include "ccmath/internal/math/runtime/func/trig/cos_rt.hpp"
+#include "ccmath/internal/math/runtime/func/trig/sin_rt.hpp"
+
+#include <type_traits>
+
+namespace ccm::rt
+{
+	// Each output matches sin_rt and cos_rt, and both come from one range reduction. When those
+	// resolve to libm the C library's sincos is called, which shares its reduction and its results
+	// with sin and cos; when they resolve to the generic kernel the fused kernel is used. Only the
+	// MSVC and SVML paths keep two calls.
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void sincos_rt(T num, T & sin_out, T & cos_out) noexcept
+	{
+#if (defined(_MSC_VER) && !defined(__clang__)) || (defined(CCMATH_HAS_SIMD) && defined(CCMATH_HAS_SIMD_SVML))
+		sin_out = ccm::rt::sin_rt(num);
+		cos_out = ccm::rt::cos_rt(num);
+#else
+		if constexpr (ccm::builtin::has_runtime_sin<T> && ccm::builtin::has_runtime_cos<T> && ccm::builtin::has_runtime_sincos<T>)
+		{
+			ccm::builtin::sincos_rt(num, sin_out, cos_out);
+		}
+		else if constexpr (ccm::builtin::has_runtime_sin<T> || ccm::builtin::has_runtime_cos<T>)
+		{
+			sin_out = ccm::rt::sin_rt(num);
+			cos_out = ccm::rt::cos_rt(num);
+		}
+		else
+		{
+			gen::sincos_gen(num, sin_out, cos_out);
+		}
+#endif
+	}
+} // namespace ccm::rt
@@ -10,21 +10,46 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/expo/log10_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log2_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/acosh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/asinh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/atanh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/cosh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/impl/hyper_simd_impl.hpp"
+#include "ccmath/internal/math/generic/func/hyper/impl/inv_hyper_simd_impl.hpp"
+#include "ccmath/internal/math/generic/func/hyper/sinh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/tanh_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/cbrt_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/hypot_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/impl/cbrt_simd_impl.hpp"
+#include "ccmath/internal/math/generic/func/power/impl/hypot_simd_impl.hpp"
 #include "ccmath/internal/math/runtime/pp/declaration.hpp"
 #include "ccmath/internal/math/runtime/pp/scalar.hpp"
 #include "ccmath/internal/math/runtime/pp/simd.hpp"
 #include "ccmath/internal/math/runtime/pp/utility.hpp"
 #include "ccmath/internal/math/runtime/pp/vec_ext.hpp"
 #include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/math/expo/impl/exp2_simd_impl.hpp"
+#include "ccmath/math/expo/impl/exp_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log10_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log2_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log_domain_impl.hpp"
+#include "ccmath/math/expo/impl/log_simd_impl.hpp"
+#include "ccmath/math/trig/impl/inv_trig_simd_impl.hpp"
+#include "ccmath/math/trig/impl/sincos_simd_impl.hpp"
+#include "ccmath/math/trig/impl/tan_simd_impl.hpp"
 
 #include <type_traits>
 
 // Elementwise math overloads for basic_simd. The hardware-mapped operations
 // (sqrt, floor, ceil, trunc, round, fabs, fma, min, max) route through the
-// backend op_* primitives (packed instructions on Clang, per-lane on GCC). The
-// transcendentals (exp, log, pow) are a per-lane scalar baseline for now: they
-// give the correct result but are not yet vectorized (a future pass can route
-// them through a vector implementation or SVML).
+// backend op_* primitives (packed instructions on Clang, per-lane on GCC). For
+// float and double, exp, exp2, log, log2, log10, sin, cos, tan, asin, acos,
+// atan, atan2, sinh, cosh, tanh, asinh, acosh, atanh, cbrt and the two and
+// three argument hypot run ccmath's lane-parallel kernels, which are bit
+// identical to the scalar generic kernels. pow is a per-lane scalar baseline for now.
 
 namespace ccm::pp
 {
@@ -44,6 +69,13 @@ namespace ccm::pp
 			for (SimdSizeType i = 0; i < a.size(); ++i) { r[i] = f(a[i], b[i]); }
 			return r;
 		}
+		template <typename T, typename Abi, typename F>
+		CCM_ALWAYS_INLINE basic_simd<T, Abi> map3(basic_simd<T, Abi> const & a, basic_simd<T, Abi> const & b, basic_simd<T, Abi> const & c, F f)
+		{
+			basic_simd<T, Abi> r;
+			for (SimdSizeType i = 0; i < a.size(); ++i) { r[i] = f(a[i], b[i], c[i]); }
+			return r;
+		}
 	} // namespace detail
 
 #define CCM_PP_MATH1(NAME, OP)                                                                                                                                 \
@@ -79,16 +111,216 @@ namespace ccm::pp
 		return detail::map1(v, [](T x) { return x < T(0) ? static_cast<T>(-x) : x; });
 	}
 
-	// Per-lane transcendental baseline.
+	// Lane-parallel exp and exp2 for float and double; other element types use the per-lane baseline.
 	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
 	CCM_ALWAYS_INLINE basic_simd<T, Abi> exp(basic_simd<T, Abi> const & v)
 	{
-		return detail::map1(v, [](T x) { return detail::s_exp<T>(x); });
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::exp_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_exp<T>(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> exp2(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::exp2_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_exp2<T>(x); });
+		}
 	}
+
+	// Lane-parallel log, log2 and log10 for float and double, with the domain handling of ccm::log
+	// (zero, negative, infinite and NaN lanes) resolved per lane. Other element types use the
+	// per-lane baseline.
 	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
 	CCM_ALWAYS_INLINE basic_simd<T, Abi> log(basic_simd<T, Abi> const & v)
 	{
-		return detail::map1(v, [](T x) { return detail::s_log<T>(x); });
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+		{
+			return ccm::internal::impl::log_domain_or(
+				v, [](auto const & x) { return ccm::internal::impl::log_simd_impl(x); }, [](T x) { return ccm::gen::log_gen(x); });
+		}
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_log<T>(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> log2(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+		{
+			return ccm::internal::impl::log_domain_or(
+				v, [](auto const & x) { return ccm::internal::impl::log2_simd_impl(x); }, [](T x) { return ccm::gen::log2_gen(x); });
+		}
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_log2<T>(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> log10(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+		{
+			return ccm::internal::impl::log_domain_or(
+				v, [](auto const & x) { return ccm::internal::impl::log10_simd_impl(x); }, [](T x) { return ccm::gen::log10_gen(x); });
+		}
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_log10<T>(x); });
+		}
+	}
+	// Lane-parallel sin, cos and tan for float and double; other element types use the per-lane baseline.
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> sin(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::sin_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_sin<T>(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> cos(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::cos_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_cos<T>(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> tan(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::tan_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_tan<T>(x); });
+		}
+	}
+	// Lane-parallel asin, acos, atan and atan2 for float and double; other element types use the
+	// per-lane baseline.
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> asin(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::asin_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_asin<T>(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> acos(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::acos_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_acos<T>(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> atan(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::atan_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return detail::s_atan<T>(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> atan2(basic_simd<T, Abi> const & y, basic_simd<T, Abi> const & x)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::atan2_simd_impl(y, x); }
+		else
+		{
+			return detail::map2(y, x, [](T a, T b) { return detail::s_atan2<T>(a, b); });
+		}
+	}
+	// Lane-parallel sinh, cosh and tanh for float and double; other element types use the per-lane baseline.
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> sinh(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::sinh_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return ccm::gen::sinh_gen(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> cosh(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::cosh_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return ccm::gen::cosh_gen(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> tanh(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::tanh_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return ccm::gen::tanh_gen(x); });
+		}
+	}
+	// Lane-parallel asinh, acosh and atanh for float and double; other element types use the per-lane baseline.
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> asinh(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::asinh_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return ccm::gen::asinh_gen(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> acosh(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::acosh_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return ccm::gen::acosh_gen(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> atanh(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::atanh_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return ccm::gen::atanh_gen(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> cbrt(basic_simd<T, Abi> const & v)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::cbrt_simd_impl(v); }
+		else
+		{
+			return detail::map1(v, [](T x) { return ccm::gen::cbrt_gen(x); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> hypot(basic_simd<T, Abi> const & x, basic_simd<T, Abi> const & y)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::hypot_simd_impl(x, y); }
+		else
+		{
+			return detail::map2(x, y, [](T a, T b) { return ccm::gen::hypot_gen(a, b); });
+		}
+	}
+	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+	CCM_ALWAYS_INLINE basic_simd<T, Abi> hypot(basic_simd<T, Abi> const & x, basic_simd<T, Abi> const & y, basic_simd<T, Abi> const & z)
+	{
+		if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) { return ccm::internal::impl::hypot_simd_impl(x, y, z); }
+		else
+		{
+			return detail::map3(x, y, z, [](T a, T b, T c) { return ccm::gen::hypot_gen(a, b, c); });
+		}
 	}
 	template <typename T, typename Abi, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
 	CCM_ALWAYS_INLINE basic_simd<T, Abi> pow(basic_simd<T, Abi> const & a, basic_simd<T, Abi> const & b)
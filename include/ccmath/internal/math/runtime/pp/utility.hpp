@@ -73,7 +73,16 @@ namespace ccm::pp
 		CCM_PP_S_UNARY(s_round, __builtin_roundf, __builtin_round)
 		CCM_PP_S_UNARY(s_fabs, __builtin_fabsf, __builtin_fabs)
 		CCM_PP_S_UNARY(s_exp, __builtin_expf, __builtin_exp)
+		CCM_PP_S_UNARY(s_exp2, __builtin_exp2f, __builtin_exp2)
 		CCM_PP_S_UNARY(s_log, __builtin_logf, __builtin_log)
+		CCM_PP_S_UNARY(s_log2, __builtin_log2f, __builtin_log2)
+		CCM_PP_S_UNARY(s_log10, __builtin_log10f, __builtin_log10)
+		CCM_PP_S_UNARY(s_sin, __builtin_sinf, __builtin_sin)
+		CCM_PP_S_UNARY(s_cos, __builtin_cosf, __builtin_cos)
+		CCM_PP_S_UNARY(s_tan, __builtin_tanf, __builtin_tan)
+		CCM_PP_S_UNARY(s_asin, __builtin_asinf, __builtin_asin)
+		CCM_PP_S_UNARY(s_acos, __builtin_acosf, __builtin_acos)
+		CCM_PP_S_UNARY(s_atan, __builtin_atanf, __builtin_atan)
 	#undef CCM_PP_S_UNARY
 
 		template <typename T>
@@ -94,6 +103,15 @@ namespace ccm::pp
 				return __builtin_pow(a, b);
 			}
 		}
+		template <typename T>
+		CCM_ALWAYS_INLINE T s_atan2(T a, T b)
+		{
+			if constexpr (std::is_same<T, float>::value) { return __builtin_atan2f(a, b); }
+			else
+			{
+				return __builtin_atan2(a, b);
+			}
+		}
 #elif defined(_MSC_VER)
 	#define CCM_PP_S_UNARY(NAME, CF, CD)                                                                                                                       \
 		template <typename T>                                                                                                                                  \
@@ -112,7 +130,16 @@ namespace ccm::pp
 		CCM_PP_S_UNARY(s_round, roundf, round)
 		CCM_PP_S_UNARY(s_fabs, fabsf, fabs)
 		CCM_PP_S_UNARY(s_exp, expf, exp)
+		CCM_PP_S_UNARY(s_exp2, exp2f, exp2)
 		CCM_PP_S_UNARY(s_log, logf, log)
+		CCM_PP_S_UNARY(s_log2, log2f, log2)
+		CCM_PP_S_UNARY(s_log10, log10f, log10)
+		CCM_PP_S_UNARY(s_sin, sinf, sin)
+		CCM_PP_S_UNARY(s_cos, cosf, cos)
+		CCM_PP_S_UNARY(s_tan, tanf, tan)
+		CCM_PP_S_UNARY(s_asin, asinf, asin)
+		CCM_PP_S_UNARY(s_acos, acosf, acos)
+		CCM_PP_S_UNARY(s_atan, atanf, atan)
 	#undef CCM_PP_S_UNARY
 
 		template <typename T>
@@ -133,6 +160,15 @@ namespace ccm::pp
 				return ::pow(a, b);
 			}
 		}
+		template <typename T>
+		CCM_ALWAYS_INLINE T s_atan2(T a, T b)
+		{
+			if constexpr (std::is_same<T, float>::value) { return ::atan2f(a, b); }
+			else
+			{
+				return ::atan2(a, b);
+			}
+		}
 #else
 		extern "C"
 		{
@@ -150,8 +186,28 @@ namespace ccm::pp
 			double fabs(double);
 			float expf(float);
 			double exp(double);
+			float exp2f(float);
+			double exp2(double);
 			float logf(float);
 			double log(double);
+			float log2f(float);
+			double log2(double);
+			float log10f(float);
+			double log10(double);
+			float sinf(float);
+			double sin(double);
+			float cosf(float);
+			double cos(double);
+			float tanf(float);
+			double tan(double);
+			float asinf(float);
+			double asin(double);
+			float acosf(float);
+			double acos(double);
+			float atanf(float);
+			double atan(double);
+			float atan2f(float, float);
+			double atan2(double, double);
 			float fmaf(float, float, float);
 			double fma(double, double, double);
 			float powf(float, float);
@@ -174,7 +230,16 @@ namespace ccm::pp
 		CCM_PP_S_UNARY(s_round, roundf, round)
 		CCM_PP_S_UNARY(s_fabs, fabsf, fabs)
 		CCM_PP_S_UNARY(s_exp, expf, exp)
+		CCM_PP_S_UNARY(s_exp2, exp2f, exp2)
 		CCM_PP_S_UNARY(s_log, logf, log)
+		CCM_PP_S_UNARY(s_log2, log2f, log2)
+		CCM_PP_S_UNARY(s_log10, log10f, log10)
+		CCM_PP_S_UNARY(s_sin, sinf, sin)
+		CCM_PP_S_UNARY(s_cos, cosf, cos)
+		CCM_PP_S_UNARY(s_tan, tanf, tan)
+		CCM_PP_S_UNARY(s_asin, asinf, asin)
+		CCM_PP_S_UNARY(s_acos, acosf, acos)
+		CCM_PP_S_UNARY(s_atan, atanf, atan)
 	#undef CCM_PP_S_UNARY
 
 		template <typename T>
@@ -195,6 +260,15 @@ namespace ccm::pp
 				return pow(a, b);
 			}
 		}
+		template <typename T>
+		CCM_ALWAYS_INLINE T s_atan2(T a, T b)
+		{
+			if constexpr (std::is_same<T, float>::value) { return atan2f(a, b); }
+			else
+			{
+				return atan2(a, b);
+			}
+		}
 #endif
 	} // namespace detail
 } // namespace ccm::pp
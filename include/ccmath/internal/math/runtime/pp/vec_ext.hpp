@@ -61,6 +61,9 @@ namespace ccm::pp
 	// Wide GNU vector types use the AVX ABI on x86 when N*sizeof(T) > 16. TUs built
 	// without -mavx still need VecAbi<N> to compile. Use CCM_DISABLE_GCC_WARNING /
 	// CCM_RESTORE_GCC_WARNING from gcc_compiler_suppression.hpp (stacked push/pop).
+	// The pragma does not reach GCC's note about passing such vectors by value, which
+	// is reported in every TU that instantiates the function, so vector and mask
+	// arguments are taken by const reference here and in the kernels built on pp.
 	#if !defined(__AVX__)
 	CCM_DISABLE_GCC_WARNING(-Wpsabi)
 	#endif
@@ -104,21 +107,21 @@ namespace ccm::pp
 		}
 		CCM_ALWAYS_INLINE static void store(SimdMember const & m, T * p) { std::memcpy(p, &m, sizeof(m)); }
 
-		CCM_ALWAYS_INLINE static SimdMember add(SimdMember a, SimdMember b) { return a + b; }
-		CCM_ALWAYS_INLINE static SimdMember sub(SimdMember a, SimdMember b) { return a - b; }
-		CCM_ALWAYS_INLINE static SimdMember mul(SimdMember a, SimdMember b) { return a * b; }
-		CCM_ALWAYS_INLINE static SimdMember div(SimdMember a, SimdMember b) { return a / b; }
-		CCM_ALWAYS_INLINE static SimdMember negate(SimdMember a) { return -a; }
+		CCM_ALWAYS_INLINE static SimdMember add(SimdMember const & a, SimdMember const & b) { return a + b; }
+		CCM_ALWAYS_INLINE static SimdMember sub(SimdMember const & a, SimdMember const & b) { return a - b; }
+		CCM_ALWAYS_INLINE static SimdMember mul(SimdMember const & a, SimdMember const & b) { return a * b; }
+		CCM_ALWAYS_INLINE static SimdMember div(SimdMember const & a, SimdMember const & b) { return a / b; }
+		CCM_ALWAYS_INLINE static SimdMember negate(SimdMember const & a) { return -a; }
 
 		// A same-size vector comparison yields a vector of the matching signed
 		// integer with all-ones / zero lanes; the cast reinterprets it as our
 		// canonical MaskMember type.
-		CCM_ALWAYS_INLINE static MaskMember eq(SimdMember a, SimdMember b) { return reinterpret_mask(a == b); }
-		CCM_ALWAYS_INLINE static MaskMember ne(SimdMember a, SimdMember b) { return reinterpret_mask(a != b); }
-		CCM_ALWAYS_INLINE static MaskMember lt(SimdMember a, SimdMember b) { return reinterpret_mask(a < b); }
-		CCM_ALWAYS_INLINE static MaskMember le(SimdMember a, SimdMember b) { return reinterpret_mask(a <= b); }
-		CCM_ALWAYS_INLINE static MaskMember gt(SimdMember a, SimdMember b) { return reinterpret_mask(a > b); }
-		CCM_ALWAYS_INLINE static MaskMember ge(SimdMember a, SimdMember b) { return reinterpret_mask(a >= b); }
+		CCM_ALWAYS_INLINE static MaskMember eq(SimdMember const & a, SimdMember const & b) { return reinterpret_mask(a == b); }
+		CCM_ALWAYS_INLINE static MaskMember ne(SimdMember const & a, SimdMember const & b) { return reinterpret_mask(a != b); }
+		CCM_ALWAYS_INLINE static MaskMember lt(SimdMember const & a, SimdMember const & b) { return reinterpret_mask(a < b); }
+		CCM_ALWAYS_INLINE static MaskMember le(SimdMember const & a, SimdMember const & b) { return reinterpret_mask(a <= b); }
+		CCM_ALWAYS_INLINE static MaskMember gt(SimdMember const & a, SimdMember const & b) { return reinterpret_mask(a > b); }
+		CCM_ALWAYS_INLINE static MaskMember ge(SimdMember const & a, SimdMember const & b) { return reinterpret_mask(a >= b); }
 
 		CCM_ALWAYS_INLINE static MaskMember mbroadcast(bool b)
 		{
@@ -129,14 +132,14 @@ namespace ccm::pp
 		}
 		CCM_ALWAYS_INLINE static bool mget(MaskMember const & m, detail::SimdSizeType i) { return m[i] != 0; }
 		CCM_ALWAYS_INLINE static void mset(MaskMember & m, detail::SimdSizeType i, bool b) { m[i] = b ? static_cast<MaskInt>(-1) : MaskInt{ 0 }; }
-		CCM_ALWAYS_INLINE static MaskMember mand(MaskMember a, MaskMember b) { return a & b; }
-		CCM_ALWAYS_INLINE static MaskMember mor(MaskMember a, MaskMember b) { return a | b; }
-		CCM_ALWAYS_INLINE static MaskMember mxor(MaskMember a, MaskMember b) { return a ^ b; }
-		CCM_ALWAYS_INLINE static MaskMember mnot(MaskMember a) { return ~a; }
+		CCM_ALWAYS_INLINE static MaskMember mand(MaskMember const & a, MaskMember const & b) { return a & b; }
+		CCM_ALWAYS_INLINE static MaskMember mor(MaskMember const & a, MaskMember const & b) { return a | b; }
+		CCM_ALWAYS_INLINE static MaskMember mxor(MaskMember const & a, MaskMember const & b) { return a ^ b; }
+		CCM_ALWAYS_INLINE static MaskMember mnot(MaskMember const & a) { return ~a; }
 
 		// All lanes are 0 or -1, so a horizontal AND/OR collapses to a movemask test
 		// rather than a per-lane scalar chain.
-		CCM_ALWAYS_INLINE static bool all_of(MaskMember m)
+		CCM_ALWAYS_INLINE static bool all_of(MaskMember const & m)
 		{
 	#if defined(__has_builtin) && __has_builtin(__builtin_reduce_and)
 			return __builtin_reduce_and(m) != 0;
@@ -146,7 +149,7 @@ namespace ccm::pp
 			return r;
 	#endif
 		}
-		CCM_ALWAYS_INLINE static bool any_of(MaskMember m)
+		CCM_ALWAYS_INLINE static bool any_of(MaskMember const & m)
 		{
 	#if defined(__has_builtin) && __has_builtin(__builtin_reduce_or)
 			return __builtin_reduce_or(m) != 0;
@@ -156,7 +159,7 @@ namespace ccm::pp
 			return r;
 	#endif
 		}
-		CCM_ALWAYS_INLINE static detail::SimdSizeType popcount(MaskMember m)
+		CCM_ALWAYS_INLINE static detail::SimdSizeType popcount(MaskMember const & m)
 		{
 			detail::SimdSizeType r = 0;
 			detail::unroll<N>([&](auto i) { r += (m[i] != 0) ? 1 : 0; });
@@ -166,7 +169,7 @@ namespace ccm::pp
 		// Branchless blend: pick a where the mask lane is set, else b. Reinterpret
 		// to integer lanes so it lowers to a vector and/andnot/or (or a hardware
 		// blend on SSE4.1+/AVX) instead of a scalar loop.
-		CCM_ALWAYS_INLINE static SimdMember select(MaskMember m, SimdMember a, SimdMember b)
+		CCM_ALWAYS_INLINE static SimdMember select(MaskMember const & m, SimdMember const & a, SimdMember const & b)
 		{
 			MaskMember const ai = reinterpret_cast<MaskMember>(a);
 			MaskMember const bi = reinterpret_cast<MaskMember>(b);
@@ -175,17 +178,17 @@ namespace ccm::pp
 		}
 
 		// Integer-only operations (instantiated only when used, i.e. for integral T).
-		CCM_ALWAYS_INLINE static SimdMember mod(SimdMember a, SimdMember b) { return a % b; }
-		CCM_ALWAYS_INLINE static SimdMember band(SimdMember a, SimdMember b) { return a & b; }
-		CCM_ALWAYS_INLINE static SimdMember bor(SimdMember a, SimdMember b) { return a | b; }
-		CCM_ALWAYS_INLINE static SimdMember bxor(SimdMember a, SimdMember b) { return a ^ b; }
-		CCM_ALWAYS_INLINE static SimdMember bnot(SimdMember a) { return ~a; }
-		CCM_ALWAYS_INLINE static SimdMember shl(SimdMember a, SimdMember b) { return a << b; }
-		CCM_ALWAYS_INLINE static SimdMember shr(SimdMember a, SimdMember b) { return a >> b; }
+		CCM_ALWAYS_INLINE static SimdMember mod(SimdMember const & a, SimdMember const & b) { return a % b; }
+		CCM_ALWAYS_INLINE static SimdMember band(SimdMember const & a, SimdMember const & b) { return a & b; }
+		CCM_ALWAYS_INLINE static SimdMember bor(SimdMember const & a, SimdMember const & b) { return a | b; }
+		CCM_ALWAYS_INLINE static SimdMember bxor(SimdMember const & a, SimdMember const & b) { return a ^ b; }
+		CCM_ALWAYS_INLINE static SimdMember bnot(SimdMember const & a) { return ~a; }
+		CCM_ALWAYS_INLINE static SimdMember shl(SimdMember const & a, SimdMember const & b) { return a << b; }
+		CCM_ALWAYS_INLINE static SimdMember shr(SimdMember const & a, SimdMember const & b) { return a >> b; }
 
 		// Lane-type conversion (value) and bit reinterpret (same total size).
 		template <typename U>
-		CCM_ALWAYS_INLINE static detail::vec_builtin_t<U, N> convert(SimdMember v)
+		CCM_ALWAYS_INLINE static detail::vec_builtin_t<U, N> convert(SimdMember const & v)
 		{
 	#if defined(__has_builtin) && __has_builtin(__builtin_convertvector)
 			return __builtin_convertvector(v, detail::vec_builtin_t<U, N>);
@@ -196,12 +199,12 @@ namespace ccm::pp
 	#endif
 		}
 		template <typename U>
-		CCM_ALWAYS_INLINE static detail::vec_builtin_t<U, N> bitcast(SimdMember v)
+		CCM_ALWAYS_INLINE static detail::vec_builtin_t<U, N> bitcast(SimdMember const & v)
 		{ return reinterpret_cast<detail::vec_builtin_t<U, N>>(v); }
 
 		// Math primitives. Clang lowers these to packed instructions; GCC takes the
 		// per-lane fallback.
-		CCM_ALWAYS_INLINE static SimdMember op_sqrt(SimdMember v)
+		CCM_ALWAYS_INLINE static SimdMember op_sqrt(SimdMember const & v)
 		{
 	#if CCM_PP_HAS_EW(sqrt)
 			return __builtin_elementwise_sqrt(v);
@@ -211,7 +214,7 @@ namespace ccm::pp
 			return r;
 	#endif
 		}
-		CCM_ALWAYS_INLINE static SimdMember op_floor(SimdMember v)
+		CCM_ALWAYS_INLINE static SimdMember op_floor(SimdMember const & v)
 		{
 	#if CCM_PP_HAS_EW(floor)
 			return __builtin_elementwise_floor(v);
@@ -221,7 +224,7 @@ namespace ccm::pp
 			return r;
 	#endif
 		}
-		CCM_ALWAYS_INLINE static SimdMember op_ceil(SimdMember v)
+		CCM_ALWAYS_INLINE static SimdMember op_ceil(SimdMember const & v)
 		{
 	#if CCM_PP_HAS_EW(ceil)
 			return __builtin_elementwise_ceil(v);
@@ -231,7 +234,7 @@ namespace ccm::pp
 			return r;
 	#endif
 		}
-		CCM_ALWAYS_INLINE static SimdMember op_trunc(SimdMember v)
+		CCM_ALWAYS_INLINE static SimdMember op_trunc(SimdMember const & v)
 		{
 	#if CCM_PP_HAS_EW(trunc)
 			return __builtin_elementwise_trunc(v);
@@ -241,7 +244,7 @@ namespace ccm::pp
 			return r;
 	#endif
 		}
-		CCM_ALWAYS_INLINE static SimdMember op_round(SimdMember v)
+		CCM_ALWAYS_INLINE static SimdMember op_round(SimdMember const & v)
 		{
 	#if CCM_PP_HAS_EW(round)
 			return __builtin_elementwise_round(v);
@@ -251,7 +254,7 @@ namespace ccm::pp
 			return r;
 	#endif
 		}
-		CCM_ALWAYS_INLINE static SimdMember op_fabs(SimdMember v)
+		CCM_ALWAYS_INLINE static SimdMember op_fabs(SimdMember const & v)
 		{
 	#if CCM_PP_HAS_EW(abs)
 			return __builtin_elementwise_abs(v);
@@ -261,7 +264,7 @@ namespace ccm::pp
 			return r;
 	#endif
 		}
-		CCM_ALWAYS_INLINE static SimdMember op_fma(SimdMember a, SimdMember b, SimdMember c)
+		CCM_ALWAYS_INLINE static SimdMember op_fma(SimdMember const & a, SimdMember const & b, SimdMember const & c)
 		{
 	#if CCM_PP_HAS_EW(fma)
 			return __builtin_elementwise_fma(a, b, c);
@@ -271,11 +274,11 @@ namespace ccm::pp
 			return r;
 	#endif
 		}
-		CCM_ALWAYS_INLINE static SimdMember op_min(SimdMember a, SimdMember b) { return select(lt(a, b), a, b); }
-		CCM_ALWAYS_INLINE static SimdMember op_max(SimdMember a, SimdMember b) { return select(lt(b, a), a, b); }
+		CCM_ALWAYS_INLINE static SimdMember op_min(SimdMember const & a, SimdMember const & b) { return select(lt(a, b), a, b); }
+		CCM_ALWAYS_INLINE static SimdMember op_max(SimdMember const & a, SimdMember const & b) { return select(lt(b, a), a, b); }
 
 		// Horizontal reductions.
-		CCM_ALWAYS_INLINE static T hadd(SimdMember v)
+		CCM_ALWAYS_INLINE static T hadd(SimdMember const & v)
 		{
 			// __builtin_reduce_add is integer-only (float add is not associative);
 			// floats use the per-lane fold.
@@ -289,7 +292,7 @@ namespace ccm::pp
 				return s;
 			}
 		}
-		CCM_ALWAYS_INLINE static T hmin(SimdMember v)
+		CCM_ALWAYS_INLINE static T hmin(SimdMember const & v)
 		{
 	#if CCM_PP_HAS_RED(min)
 			return __builtin_reduce_min(v);
@@ -299,7 +302,7 @@ namespace ccm::pp
 			return s;
 	#endif
 		}
-		CCM_ALWAYS_INLINE static T hmax(SimdMember v)
+		CCM_ALWAYS_INLINE static T hmax(SimdMember const & v)
 		{
 	#if CCM_PP_HAS_RED(max)
 			return __builtin_reduce_max(v);
@@ -313,7 +316,7 @@ namespace ccm::pp
 	private:
 		// Reinterpret an arbitrary same-size integer comparison vector as MaskMember.
 		template <typename Cmp>
-		CCM_ALWAYS_INLINE static MaskMember reinterpret_mask(Cmp c)
+		CCM_ALWAYS_INLINE static MaskMember reinterpret_mask(Cmp const & c)
 		{ return reinterpret_cast<MaskMember>(c); }
 	};
 #else // CCM_PP_HAS_VECTOR_EXT == 0 : portable array fallback
@@ -345,7 +348,7 @@ namespace ccm::pp
 		CCM_ALWAYS_INLINE static void store(SimdMember const & m, T * p) { std::memcpy(p, m.data(), sizeof(m)); }
 
 	#define CCM_PP_ARRAY_BINOP(NAME, OP)                                                                                                                       \
-		CCM_ALWAYS_INLINE static SimdMember NAME(SimdMember a, SimdMember b)                                                                                   \
+		CCM_ALWAYS_INLINE static SimdMember NAME(SimdMember const & a, SimdMember const & b)                                                                                   \
 		{                                                                                                                                                      \
 			SimdMember r;                                                                                                                                      \
 			detail::unroll<N>([&](auto i) { r[i] = a[i] OP b[i]; });                                                                                           \
@@ -356,7 +359,7 @@ namespace ccm::pp
 		CCM_PP_ARRAY_BINOP(mul, *)
 		CCM_PP_ARRAY_BINOP(div, /)
 	#undef CCM_PP_ARRAY_BINOP
-		CCM_ALWAYS_INLINE static SimdMember negate(SimdMember a)
+		CCM_ALWAYS_INLINE static SimdMember negate(SimdMember const & a)
 		{
 			SimdMember r;
 			detail::unroll<N>([&](auto i) { r[i] = -a[i]; });
@@ -364,7 +367,7 @@ namespace ccm::pp
 		}
 
 	#define CCM_PP_ARRAY_CMP(NAME, OP)                                                                                                                         \
-		CCM_ALWAYS_INLINE static MaskMember NAME(SimdMember a, SimdMember b)                                                                                   \
+		CCM_ALWAYS_INLINE static MaskMember NAME(SimdMember const & a, SimdMember const & b)                                                                                   \
 		{                                                                                                                                                      \
 			MaskMember r;                                                                                                                                      \
 			detail::unroll<N>([&](auto i) { r[i] = (a[i] OP b[i]) ? static_cast<MaskInt>(-1) : MaskInt{ 0 }; });                                               \
@@ -387,51 +390,51 @@ namespace ccm::pp
 		}
 		CCM_ALWAYS_INLINE static bool mget(MaskMember const & m, detail::SimdSizeType i) { return m[i] != 0; }
 		CCM_ALWAYS_INLINE static void mset(MaskMember & m, detail::SimdSizeType i, bool b) { m[i] = b ? static_cast<MaskInt>(-1) : MaskInt{ 0 }; }
-		CCM_ALWAYS_INLINE static MaskMember mand(MaskMember a, MaskMember b)
+		CCM_ALWAYS_INLINE static MaskMember mand(MaskMember const & a, MaskMember const & b)
 		{
 			MaskMember r;
 			detail::unroll<N>([&](auto i) { r[i] = a[i] & b[i]; });
 			return r;
 		}
-		CCM_ALWAYS_INLINE static MaskMember mor(MaskMember a, MaskMember b)
+		CCM_ALWAYS_INLINE static MaskMember mor(MaskMember const & a, MaskMember const & b)
 		{
 			MaskMember r;
 			detail::unroll<N>([&](auto i) { r[i] = a[i] | b[i]; });
 			return r;
 		}
-		CCM_ALWAYS_INLINE static MaskMember mxor(MaskMember a, MaskMember b)
+		CCM_ALWAYS_INLINE static MaskMember mxor(MaskMember const & a, MaskMember const & b)
 		{
 			MaskMember r;
 			detail::unroll<N>([&](auto i) { r[i] = a[i] ^ b[i]; });
 			return r;
 		}
-		CCM_ALWAYS_INLINE static MaskMember mnot(MaskMember a)
+		CCM_ALWAYS_INLINE static MaskMember mnot(MaskMember const & a)
 		{
 			MaskMember r;
 			detail::unroll<N>([&](auto i) { r[i] = static_cast<MaskInt>(~a[i]); });
 			return r;
 		}
 
-		CCM_ALWAYS_INLINE static bool all_of(MaskMember m)
+		CCM_ALWAYS_INLINE static bool all_of(MaskMember const & m)
 		{
 			bool r = true;
 			detail::unroll<N>([&](auto i) { r = r && (m[i] != 0); });
 			return r;
 		}
-		CCM_ALWAYS_INLINE static bool any_of(MaskMember m)
+		CCM_ALWAYS_INLINE static bool any_of(MaskMember const & m)
 		{
 			bool r = false;
 			detail::unroll<N>([&](auto i) { r = r || (m[i] != 0); });
 			return r;
 		}
-		CCM_ALWAYS_INLINE static detail::SimdSizeType popcount(MaskMember m)
+		CCM_ALWAYS_INLINE static detail::SimdSizeType popcount(MaskMember const & m)
 		{
 			detail::SimdSizeType r = 0;
 			detail::unroll<N>([&](auto i) { r += (m[i] != 0) ? 1 : 0; });
 			return r;
 		}
 
-		CCM_ALWAYS_INLINE static SimdMember select(MaskMember m, SimdMember a, SimdMember b)
+		CCM_ALWAYS_INLINE static SimdMember select(MaskMember const & m, SimdMember const & a, SimdMember const & b)
 		{
 			SimdMember r;
 			detail::unroll<N>([&](auto i) { r[i] = (m[i] != 0) ? a[i] : b[i]; });
@@ -439,7 +442,7 @@ namespace ccm::pp
 		}
 
 	#define CCM_PP_ARRAY_BINOP(NAME, OP)                                                                                                                       \
-		CCM_ALWAYS_INLINE static SimdMember NAME(SimdMember a, SimdMember b)                                                                                   \
+		CCM_ALWAYS_INLINE static SimdMember NAME(SimdMember const & a, SimdMember const & b)                                                                                   \
 		{                                                                                                                                                      \
 			SimdMember r;                                                                                                                                      \
 			detail::unroll<N>([&](auto i) { r[i] = static_cast<T>(a[i] OP b[i]); });                                                                           \
@@ -452,7 +455,7 @@ namespace ccm::pp
 		CCM_PP_ARRAY_BINOP(shl, <<)
 		CCM_PP_ARRAY_BINOP(shr, >>)
 	#undef CCM_PP_ARRAY_BINOP
-		CCM_ALWAYS_INLINE static SimdMember bnot(SimdMember a)
+		CCM_ALWAYS_INLINE static SimdMember bnot(SimdMember const & a)
 		{
 			SimdMember r;
 			detail::unroll<N>([&](auto i) { r[i] = static_cast<T>(~a[i]); });
@@ -460,14 +463,14 @@ namespace ccm::pp
 		}
 
 		template <typename U>
-		CCM_ALWAYS_INLINE static std::array<U, static_cast<std::size_t>(N)> convert(SimdMember v)
+		CCM_ALWAYS_INLINE static std::array<U, static_cast<std::size_t>(N)> convert(SimdMember const & v)
 		{
 			std::array<U, static_cast<std::size_t>(N)> r;
 			detail::unroll<N>([&](auto i) { r[i] = static_cast<U>(v[i]); });
 			return r;
 		}
 		template <typename U>
-		CCM_ALWAYS_INLINE static std::array<U, static_cast<std::size_t>(N)> bitcast(SimdMember v)
+		CCM_ALWAYS_INLINE static std::array<U, static_cast<std::size_t>(N)> bitcast(SimdMember const & v)
 		{
 			std::array<U, static_cast<std::size_t>(N)> r;
 			std::memcpy(r.data(), v.data(), sizeof(r));
@@ -475,7 +478,7 @@ namespace ccm::pp
 		}
 
 	#define CCM_PP_ARRAY_MATH1(NAME, SFN)                                                                                                                      \
-		CCM_ALWAYS_INLINE static SimdMember NAME(SimdMember v)                                                                                                 \
+		CCM_ALWAYS_INLINE static SimdMember NAME(SimdMember const & v)                                                                                                 \
 		{                                                                                                                                                      \
 			SimdMember r;                                                                                                                                      \
 			detail::unroll<N>([&](auto i) { r[i] = detail::SFN<T>(v[i]); });                                                                                   \
@@ -488,38 +491,38 @@ namespace ccm::pp
 		CCM_PP_ARRAY_MATH1(op_round, s_round)
 		CCM_PP_ARRAY_MATH1(op_fabs, s_fabs)
 	#undef CCM_PP_ARRAY_MATH1
-		CCM_ALWAYS_INLINE static SimdMember op_fma(SimdMember a, SimdMember b, SimdMember c)
+		CCM_ALWAYS_INLINE static SimdMember op_fma(SimdMember const & a, SimdMember const & b, SimdMember const & c)
 		{
 			SimdMember r;
 			detail::unroll<N>([&](auto i) { r[i] = detail::s_fma<T>(a[i], b[i], c[i]); });
 			return r;
 		}
-		CCM_ALWAYS_INLINE static SimdMember op_min(SimdMember a, SimdMember b)
+		CCM_ALWAYS_INLINE static SimdMember op_min(SimdMember const & a, SimdMember const & b)
 		{
 			SimdMember r;
 			detail::unroll<N>([&](auto i) { r[i] = a[i] < b[i] ? a[i] : b[i]; });
 			return r;
 		}
-		CCM_ALWAYS_INLINE static SimdMember op_max(SimdMember a, SimdMember b)
+		CCM_ALWAYS_INLINE static SimdMember op_max(SimdMember const & a, SimdMember const & b)
 		{
 			SimdMember r;
 			detail::unroll<N>([&](auto i) { r[i] = a[i] < b[i] ? b[i] : a[i]; });
 			return r;
 		}
 
-		CCM_ALWAYS_INLINE static T hadd(SimdMember v)
+		CCM_ALWAYS_INLINE static T hadd(SimdMember const & v)
 		{
 			T s = T(0);
 			detail::unroll<N>([&](auto i) { s = static_cast<T>(s + v[i]); });
 			return s;
 		}
-		CCM_ALWAYS_INLINE static T hmin(SimdMember v)
+		CCM_ALWAYS_INLINE static T hmin(SimdMember const & v)
 		{
 			T s = v[0];
 			detail::unroll<N>([&](auto i) { s = v[i] < s ? v[i] : s; });
 			return s;
 		}
-		CCM_ALWAYS_INLINE static T hmax(SimdMember v)
+		CCM_ALWAYS_INLINE static T hmax(SimdMember const & v)
 		{
 			T s = v[0];
 			detail::unroll<N>([&](auto i) { s = s < v[i] ? v[i] : s; });
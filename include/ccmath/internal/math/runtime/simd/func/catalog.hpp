@@ -34,6 +34,11 @@
 		#include "ccmath/internal/math/runtime/simd/func/impl/avx2/sqrt.hpp"
 	#endif
 
+	#ifdef CCMATH_HAS_SIMD_AVX512F
+		#include "ccmath/internal/math/runtime/simd/func/impl/avx512/pow.hpp"
+		#include "ccmath/internal/math/runtime/simd/func/impl/avx512/sqrt.hpp"
+	#endif
+
 	#ifdef CCMATH_HAS_SIMD_NEON
 		#include "ccmath/internal/math/runtime/simd/func/impl/neon/pow.hpp"
 		#include "ccmath/internal/math/runtime/simd/func/impl/neon/sqrt.hpp"
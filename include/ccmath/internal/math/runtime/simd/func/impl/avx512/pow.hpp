@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX512F
+
+		#ifdef CCMATH_HAS_SIMD_SVML
+			#include <immintrin.h>
+		#else
+			#include "ccmath/internal/math/generic/func/power/pow_gen.hpp"
+		#endif
+
+namespace ccm::intrin
+{
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> pow(simd<float, abi::avx512> const & a, simd<float, abi::avx512> const & b)
+	{
+		#ifdef CCMATH_HAS_SIMD_SVML
+		return simd<float, abi::avx512>(_mm512_pow_ps(a.get(), b.get()));
+		#else
+		return simd<float, abi::avx512>(gen::pow_gen(a.convert(), b.convert()));
+		#endif
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> pow(simd<double, abi::avx512> const & a, simd<double, abi::avx512> const & b)
+	{
+		#ifdef CCMATH_HAS_SIMD_SVML
+		return simd<double, abi::avx512>(_mm512_pow_pd(a.get(), b.get()));
+		#else
+		return simd<double, abi::avx512>(gen::pow_gen(a.convert(), b.convert()));
+		#endif
+	}
+
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX512F
+#endif	   // CCMATH_HAS_SIMD
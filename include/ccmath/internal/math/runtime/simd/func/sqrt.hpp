@@ -28,6 +28,10 @@
 		#include "impl/avx2/sqrt.hpp"
 	#endif
 
+	#ifdef CCMATH_HAS_SIMD_AVX512F
+		#include "impl/avx512/sqrt.hpp"
+	#endif
+
 	#ifdef CCMATH_HAS_SIMD_NEON
 		#include "impl/neon/sqrt.hpp"
 	#endif
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/runtime/simd/common.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX512F
+		#include <immintrin.h>
+
+namespace ccm::intrin
+{
+	namespace abi
+	{
+
+		struct avx512
+		{
+		};
+
+	} // namespace abi
+
+	// Unlike the other backends, the AVX-512 masks live in k registers, one bit per lane, rather
+	// than as all-ones/all-zeros vector lanes.
+	template <>
+	struct simd_mask<float, abi::avx512>
+	{
+		using value_type			  = bool;
+		using simd_type				  = simd<float, abi::avx512>;
+		using abi_type				  = abi::avx512;
+		CCM_ALWAYS_INLINE simd_mask() = default;
+		CCM_ALWAYS_INLINE simd_mask(bool value) : m_value(value ? __mmask16(0xFFFF) : __mmask16(0)) {} // NOLINT
+		static constexpr int size() { return 16; }
+		CCM_ALWAYS_INLINE constexpr simd_mask(__mmask16 const &value_in) : m_value(value_in) {} // NOLINT
+		[[nodiscard]] constexpr __mmask16 get() const { return m_value; }
+		CCM_ALWAYS_INLINE simd_mask operator||(simd_mask const &other) const { return { static_cast<__mmask16>(m_value | other.m_value) }; }
+		CCM_ALWAYS_INLINE simd_mask operator&&(simd_mask const &other) const { return { static_cast<__mmask16>(m_value & other.m_value) }; }
+		CCM_ALWAYS_INLINE simd_mask operator!() const { return { static_cast<__mmask16>(~m_value) }; }
+
+		// The first count lanes set, for loading and storing the tail of an array.
+		[[nodiscard]] CCM_ALWAYS_INLINE static simd_mask first_n(int count)
+		{ return { count >= 16 ? __mmask16(0xFFFF) : static_cast<__mmask16>((1U << count) - 1U) }; }
+
+	private:
+		__mmask16 m_value;
+	};
+
+	CCM_ALWAYS_INLINE bool all_of(simd_mask<float, abi::avx512> const &a)
+	{ return a.get() == __mmask16(0xFFFF); }
+
+	CCM_ALWAYS_INLINE bool any_of(simd_mask<float, abi::avx512> const &a)
+	{ return a.get() != __mmask16(0); }
+
+	template <>
+	struct simd<float, abi::avx512>
+	{
+
+		using value_type		 = float;
+		using abi_type			 = abi::avx512;
+		using mask_type			 = simd_mask<float, abi_type>;
+		using storage_type		 = simd_storage<float, abi_type>;
+		CCM_ALWAYS_INLINE simd() = default;
+		static constexpr int size() { return 16; }
+		CCM_ALWAYS_INLINE simd(float value) : m_value(_mm512_set1_ps(value)) {} // NOLINT
+		CCM_ALWAYS_INLINE simd(storage_type const &value) { copy_from(value.data(), element_aligned_tag()); } // NOLINT
+		CCM_ALWAYS_INLINE simd &operator=(storage_type const &value)
+		{
+			copy_from(value.data(), element_aligned_tag());
+			return *this;
+		}
+		template <class Flags>
+		CCM_ALWAYS_INLINE simd(float const *ptr, Flags /*flags*/) : m_value(_mm512_loadu_ps(ptr))
+		{
+		}
+		CCM_ALWAYS_INLINE simd(float const *ptr, int stride)
+			: m_value(_mm512_i32gather_ps(_mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(stride)),
+										  ptr,
+										  sizeof(float)))
+		{
+		}
+		CCM_ALWAYS_INLINE constexpr simd(__m512 const &value_in) : m_value(value_in) {} // NOLINT
+		CCM_ALWAYS_INLINE simd operator*(simd const &other) const { return { _mm512_mul_ps(m_value, other.m_value) }; }
+		CCM_ALWAYS_INLINE simd operator/(simd const &other) const { return { _mm512_div_ps(m_value, other.m_value) }; }
+		CCM_ALWAYS_INLINE simd operator+(simd const &other) const { return { _mm512_add_ps(m_value, other.m_value) }; }
+		CCM_ALWAYS_INLINE simd operator-(simd const &other) const { return { _mm512_sub_ps(m_value, other.m_value) }; }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator-() const { return { _mm512_sub_ps(_mm512_set1_ps(0.0F), m_value) }; }
+		CCM_ALWAYS_INLINE void copy_from(float const *ptr, element_aligned_tag /*unused*/) { m_value = _mm512_loadu_ps(ptr); }
+		CCM_ALWAYS_INLINE void copy_to(float *ptr, element_aligned_tag /*unused*/) const { _mm512_storeu_ps(ptr, m_value); }
+		// Masked forms: only the lanes set in mask are read or written, so a tail shorter than
+		// size() can be handled without touching memory past its end. Unread lanes are zero.
+		CCM_ALWAYS_INLINE void copy_from(float const *ptr, mask_type const &mask) { m_value = _mm512_maskz_loadu_ps(mask.get(), ptr); }
+		CCM_ALWAYS_INLINE void copy_to(float *ptr, mask_type const &mask) const { _mm512_mask_storeu_ps(ptr, mask.get(), m_value); }
+		[[nodiscard]] constexpr __m512 get() const { return m_value; }
+		[[nodiscard]] CCM_ALWAYS_INLINE float convert() const { return _mm512_cvtss_f32(m_value); }
+		CCM_ALWAYS_INLINE simd_mask<float, abi::avx512> operator<(simd const &other) const { return { _mm512_cmp_ps_mask(m_value, other.m_value, _CMP_LT_OS) }; }
+		CCM_ALWAYS_INLINE simd_mask<float, abi::avx512> operator==(simd const &other) const { return { _mm512_cmp_ps_mask(m_value, other.m_value, _CMP_EQ_OS) }; }
+
+	private:
+		__m512 m_value;
+	};
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> choose(simd_mask<float, abi::avx512> const &a, simd<float, abi::avx512> const &b, simd<float, abi::avx512> const &c)
+	{ return { _mm512_mask_blend_ps(a.get(), c.get(), b.get()) }; }
+
+	template <>
+	struct simd_mask<double, abi::avx512>
+	{
+		using value_type			  = bool;
+		using simd_type				  = simd<double, abi::avx512>;
+		using abi_type				  = abi::avx512;
+		CCM_ALWAYS_INLINE simd_mask() = default;
+		CCM_ALWAYS_INLINE simd_mask(bool value) : m_value(value ? __mmask8(0xFF) : __mmask8(0)) {} // NOLINT
+		CCM_ALWAYS_INLINE static constexpr int size() { return 8; }
+		CCM_ALWAYS_INLINE constexpr simd_mask(__mmask8 const &value_in) : m_value(value_in) {} // NOLINT
+		[[nodiscard]] constexpr __mmask8 get() const { return m_value; }
+		CCM_ALWAYS_INLINE simd_mask operator||(simd_mask const &other) const { return { static_cast<__mmask8>(m_value | other.m_value) }; }
+		CCM_ALWAYS_INLINE simd_mask operator&&(simd_mask const &other) const { return { static_cast<__mmask8>(m_value & other.m_value) }; }
+		CCM_ALWAYS_INLINE simd_mask operator!() const { return { static_cast<__mmask8>(~m_value) }; }
+
+		// The first count lanes set, for loading and storing the tail of an array.
+		[[nodiscard]] CCM_ALWAYS_INLINE static simd_mask first_n(int count)
+		{ return { count >= 8 ? __mmask8(0xFF) : static_cast<__mmask8>((1U << count) - 1U) }; }
+
+	private:
+		__mmask8 m_value;
+	};
+
+	CCM_ALWAYS_INLINE bool all_of(simd_mask<double, abi::avx512> const &a)
+	{ return a.get() == __mmask8(0xFF); }
+
+	CCM_ALWAYS_INLINE bool any_of(simd_mask<double, abi::avx512> const &a)
+	{ return a.get() != __mmask8(0); }
+
+	template <>
+	struct simd<double, abi::avx512> // NOLINT
+	{
+
+	public:
+		using value_type								= double;
+		using abi_type									= abi::avx512;
+		using mask_type									= simd_mask<double, abi_type>;
+		using storage_type								= simd_storage<double, abi_type>;
+		CCM_ALWAYS_INLINE simd()						= default;
+		CCM_ALWAYS_INLINE simd(simd const &)			= default;
+		CCM_ALWAYS_INLINE simd(simd &&)					= default;
+		CCM_ALWAYS_INLINE simd &operator=(simd const &) = default;
+		CCM_ALWAYS_INLINE simd &operator=(simd &&)		= default;
+		CCM_ALWAYS_INLINE static constexpr int size() { return 8; }
+		CCM_ALWAYS_INLINE simd(double value) : m_value(_mm512_set1_pd(value)) {} // NOLINT
+		CCM_ALWAYS_INLINE simd(double a, double b, double c, double d, double e, double f, double g, double h) : m_value(_mm512_setr_pd(a, b, c, d, e, f, g, h)) {}
+		CCM_ALWAYS_INLINE simd(storage_type const &value) { copy_from(value.data(), element_aligned_tag()); } // NOLINT
+		CCM_ALWAYS_INLINE simd &operator=(storage_type const &value)
+		{
+			copy_from(value.data(), element_aligned_tag());
+			return *this;
+		}
+		template <class Flags>
+		CCM_ALWAYS_INLINE simd(double const *ptr, Flags /*flags*/) : m_value(_mm512_loadu_pd(ptr))
+		{
+		}
+		CCM_ALWAYS_INLINE simd(double const *ptr, int stride)
+			: simd(ptr[0], ptr[stride], ptr[2 * stride], ptr[3 * stride], ptr[4 * stride], ptr[5 * stride], ptr[6 * stride], ptr[7 * stride]) // NOLINT
+		{
+		}
+		CCM_ALWAYS_INLINE constexpr simd(__m512d const &value_in) : m_value(value_in) {} // NOLINT
+		CCM_ALWAYS_INLINE simd operator*(simd const &other) const { return { _mm512_mul_pd(m_value, other.m_value) }; }
+		CCM_ALWAYS_INLINE simd operator/(simd const &other) const { return { _mm512_div_pd(m_value, other.m_value) }; }
+		CCM_ALWAYS_INLINE simd operator+(simd const &other) const { return { _mm512_add_pd(m_value, other.m_value) }; }
+		CCM_ALWAYS_INLINE simd operator-(simd const &other) const { return { _mm512_sub_pd(m_value, other.m_value) }; }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator-() const { return { _mm512_sub_pd(_mm512_set1_pd(0.0), m_value) }; }
+		CCM_ALWAYS_INLINE void copy_from(double const *ptr, element_aligned_tag /*unused*/) { m_value = _mm512_loadu_pd(ptr); }
+		CCM_ALWAYS_INLINE void copy_to(double *ptr, element_aligned_tag /*unused*/) const { _mm512_storeu_pd(ptr, m_value); }
+		// Masked forms: only the lanes set in mask are read or written. Unread lanes are zero.
+		CCM_ALWAYS_INLINE void copy_from(double const *ptr, mask_type const &mask) { m_value = _mm512_maskz_loadu_pd(mask.get(), ptr); }
+		CCM_ALWAYS_INLINE void copy_to(double *ptr, mask_type const &mask) const { _mm512_mask_storeu_pd(ptr, mask.get(), m_value); }
+		[[nodiscard]] CCM_ALWAYS_INLINE constexpr __m512d get() const { return m_value; }
+		[[nodiscard]] CCM_ALWAYS_INLINE double convert() const { return _mm512_cvtsd_f64(m_value); }
+		CCM_ALWAYS_INLINE simd_mask<double, abi::avx512> operator<(simd const &other) const { return { _mm512_cmp_pd_mask(m_value, other.m_value, _CMP_LT_OS) }; }
+		CCM_ALWAYS_INLINE simd_mask<double, abi::avx512> operator==(simd const &other) const { return { _mm512_cmp_pd_mask(m_value, other.m_value, _CMP_EQ_OS) }; }
+
+	private:
+		__m512d m_value;
+	};
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> choose(simd_mask<double, abi::avx512> const &a, simd<double, abi::avx512> const &b, simd<double, abi::avx512> const &c)
+	{ return { _mm512_mask_blend_pd(a.get(), c.get(), b.get()) }; }
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX512F
+#endif	   // CCMATH_HAS_SIMD
@@ -29,6 +29,10 @@
 		#include "instructions/avx2.hpp"
 	#endif
 
+	#ifdef CCMATH_HAS_SIMD_AVX512F
+		#include "instructions/avx512.hpp"
+	#endif
+
 	#ifdef CCMATH_HAS_SIMD_NEON
 		#include "instructions/neon.hpp"
 	#endif
@@ -38,6 +42,8 @@ namespace ccm::intrin
 {
 	namespace abi
 	{
+		// abi::avx512 is available when the build targets AVX-512F but is not made native: the
+		// rt entry points broadcast a single value, which gains nothing from 512-bit registers.
 #if defined(CCMATH_HAS_SIMD_AVX2)
 		using native = avx2;
 #elif defined(CCMATH_HAS_SIMD_SSE4)
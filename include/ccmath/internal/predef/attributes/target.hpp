@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_arch_support.hpp"
+
+// CCM_TARGET(features) compiles a single function for an instruction set the rest of
+// the translation unit may not assume, e.g. CCM_TARGET("avx2"). Such a function must
+// only be called after checking the CPU at runtime (see support/cpu_features.hpp).
+// CCM_FLATTEN inlines every call inside a function, so the header-only kernels it
+// calls are compiled for that function's target instead of the baseline one.
+// CCM_HAS_TARGET_ATTRIBUTE is defined where both are available: GCC and Clang on x86.
+#ifndef CCM_TARGET
+	#if (defined(__GNUC__) || defined(__clang__)) && defined(CCMATH_TARGET_ARCH_IS_X86_BASED)
+		#define CCM_TARGET(features)	 __attribute__((target(features)))
+		#define CCM_HAS_TARGET_ATTRIBUTE 1
+	#else
+		#define CCM_TARGET(features)
+	#endif
+#endif
+
+// CCM_NO_FP_CONTRACT keeps a function's a * b + c as a multiply and an add, including in the
+// calls CCM_FLATTEN inlines into it. Targets such as AVX-512F carry FMA instructions of their own,
+// so targeting them otherwise lets the compiler fuse what the baseline build rounds twice. Only
+// GCC applies the setting to inlined code; CCM_HAS_NO_FP_CONTRACT is defined where it is honoured.
+#ifndef CCM_NO_FP_CONTRACT
+	#if defined(__GNUC__) && !defined(__clang__)
+		#define CCM_NO_FP_CONTRACT	   __attribute__((optimize("fp-contract=off")))
+		#define CCM_HAS_NO_FP_CONTRACT 1
+	#else
+		#define CCM_NO_FP_CONTRACT
+	#endif
+#endif
+
+#ifndef CCM_FLATTEN
+	#if defined(__GNUC__) || defined(__clang__)
+		#define CCM_FLATTEN __attribute__((flatten))
+	#else
+		#define CCM_FLATTEN
+	#endif
+#endif
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_arch_support.hpp"
+
+#if defined(CCMATH_TARGET_ARCH_IS_X86_BASED) && defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif
+
+namespace ccm::support
+{
+	/**
+	 * @brief Instruction sets the running CPU and operating system can execute.
+	 * @note Unlike the CCMATH_HAS_SIMD_* macros, which describe what the compiler was allowed to
+	 * assume, these describe the host the binary is running on. Everything is false on targets
+	 * without a detection routine.
+	 */
+	struct cpu_features
+	{
+		bool sse2{};
+		bool sse4_1{};
+		bool sse4_2{};
+		bool avx{};
+		bool avx2{};
+		bool fma{};
+		bool avx512f{};
+		bool avx512dq{};
+		bool avx512bw{};
+		bool avx512vl{};
+	};
+
+	namespace detail
+	{
+		inline cpu_features detect_cpu_features() noexcept
+		{
+			cpu_features features{};
+#if defined(CCMATH_TARGET_ARCH_IS_X86_BASED) && (defined(__GNUC__) || defined(__clang__))
+			// The builtins also check that the OS saves the YMM and ZMM state.
+			__builtin_cpu_init();
+			features.sse2	  = __builtin_cpu_supports("sse2") != 0;
+			features.sse4_1	  = __builtin_cpu_supports("sse4.1") != 0;
+			features.sse4_2	  = __builtin_cpu_supports("sse4.2") != 0;
+			features.avx	  = __builtin_cpu_supports("avx") != 0;
+			features.avx2	  = __builtin_cpu_supports("avx2") != 0;
+			features.fma	  = __builtin_cpu_supports("fma") != 0;
+			features.avx512f  = __builtin_cpu_supports("avx512f") != 0;
+			features.avx512dq = __builtin_cpu_supports("avx512dq") != 0;
+			features.avx512bw = __builtin_cpu_supports("avx512bw") != 0;
+			features.avx512vl = __builtin_cpu_supports("avx512vl") != 0;
+#elif defined(CCMATH_TARGET_ARCH_IS_X86_BASED) && defined(_MSC_VER)
+			int regs[4]{};
+			__cpuid(regs, 0);
+			const int max_leaf = regs[0];
+
+			__cpuid(regs, 1);
+			const bool os_saves_ymm = ((regs[2] >> 27) & 1) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+			const bool os_saves_zmm = os_saves_ymm && (_xgetbv(0) & 0xe6) == 0xe6;
+			features.sse2			= ((regs[3] >> 26) & 1) != 0;
+			features.sse4_1			= ((regs[2] >> 19) & 1) != 0;
+			features.sse4_2			= ((regs[2] >> 20) & 1) != 0;
+			features.avx			= os_saves_ymm && ((regs[2] >> 28) & 1) != 0;
+			features.fma			= features.avx && ((regs[2] >> 12) & 1) != 0;
+
+			if (max_leaf >= 7)
+			{
+				__cpuidex(regs, 7, 0);
+				features.avx2	  = features.avx && ((regs[1] >> 5) & 1) != 0;
+				features.avx512f  = os_saves_zmm && ((regs[1] >> 16) & 1) != 0;
+				features.avx512dq = features.avx512f && ((regs[1] >> 17) & 1) != 0;
+				features.avx512bw = features.avx512f && ((regs[1] >> 30) & 1) != 0;
+				features.avx512vl = features.avx512f && ((regs[1] >> 31) & 1) != 0;
+			}
+#endif
+			return features;
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Returns the features of the running CPU, detected on first use and cached for the
+	 * life of the process.
+	 */
+	[[nodiscard]] inline cpu_features const & host_cpu_features() noexcept
+	{
+		static const cpu_features features = detail::detect_cpu_features();
+		return features;
+	}
+} // namespace ccm::support
@@ -106,14 +106,71 @@ namespace ccm::support::fenv::internal
 	inline int get_round()
 	{ return get_rounding_mode(); }
 
+	// Keeps the thread's cached rounding mode in step when one is being tracked.
 	inline int set_round(const int rounding_mode)
-	{ return std::fesetround(rounding_mode); }
+	{
+		const int result = std::fesetround(rounding_mode);
+		if (result == 0 && cached_rounding_mode != unknown_rounding_mode) { cached_rounding_mode = rounding_mode; }
+		return result;
+	}
 
 	inline int get_env(std::fenv_t *envp)
 	{ return std::fegetenv(envp); }
 
 	inline int set_env(const std::fenv_t *envp)
 	{ return std::fesetenv(envp); }
+
+	// What the *_if_required helpers below do with a side effect on the calling thread.
+	enum class side_effect_mode : std::uint8_t
+	{
+		eReport,  // write errno and raise the exception, as math_errhandling describes
+		eDiscard, // do neither
+		eCollect, // do neither, and OR the exception into collected_excepts instead
+	};
+
+	// Only changed inside a side-effect scope (see ccm::suppress_math_side_effects and the ccm::batch
+	// policy overloads). Outside of one it stays eReport. The helpers read it only on the paths that
+	// already have a side effect to report, but there they always do: suppression is a thread-local
+	// load and a branch per report, not a compile-time switch. CCM_CONFIG_DISABLE_ERRNO removes
+	// both, but only as a build-wide setting that every translation unit shares.
+	inline thread_local side_effect_mode current_side_effect_mode = side_effect_mode::eReport;
+	inline thread_local int collected_excepts					  = 0;
+
+	inline bool side_effects_reported()
+	{ return current_side_effect_mode == side_effect_mode::eReport; }
+
+	// Handles an exception that is not being reported; always returns 0 like a successful raise.
+	inline int divert_except(const int excepts)
+	{
+		if (current_side_effect_mode == side_effect_mode::eCollect) { collected_excepts |= excepts; }
+		return 0;
+	}
+
+	// Sets the calling thread's side-effect mode until the end of the scope. Scopes nest: the previous
+	// mode is restored on exit, and an enclosing collecting scope also receives what this one collected.
+	class side_effect_scope
+	{
+	public:
+		explicit side_effect_scope(const side_effect_mode mode) noexcept : m_mode(current_side_effect_mode), m_collected(collected_excepts)
+		{
+			current_side_effect_mode = mode;
+			collected_excepts		 = 0;
+		}
+
+		~side_effect_scope() noexcept
+		{
+			const int inner			 = collected_excepts;
+			current_side_effect_mode = m_mode;
+			collected_excepts		 = m_mode == side_effect_mode::eCollect ? m_collected | inner : m_collected;
+		}
+
+		side_effect_scope(side_effect_scope const &)			 = delete;
+		side_effect_scope & operator=(side_effect_scope const &) = delete;
+
+	private:
+		side_effect_mode m_mode;
+		int m_collected;
+	};
 } // namespace ccm::support::fenv::internal
 
 namespace ccm::support::fenv
@@ -157,7 +214,11 @@ namespace ccm::support::fenv
 
 		if constexpr (is_errno_enabled())
 		{
-			if constexpr ((ccm_math_err_handling() & get_mode(ccm_math_err_mode::eErrnoExcept)) != 0) { return internal::set_except(excepts); }
+			if constexpr ((ccm_math_err_handling() & get_mode(ccm_math_err_mode::eErrnoExcept)) != 0)
+			{
+				if (!internal::side_effects_reported()) { return internal::divert_except(excepts); }
+				return internal::set_except(excepts);
+			}
 		}
 		// ReSharper disable once CppDFAUnreachableCode // This is unreachable code if the above constexpr if statement is true which is desired.
 		return 0;
@@ -168,7 +229,11 @@ namespace ccm::support::fenv
 		if (is_constant_evaluated()) { return 0; } // We cannot raise fenv exceptions in a constexpr context. So we return.
 		if constexpr (is_errno_enabled())
 		{
-			if constexpr ((ccm_math_err_handling() & get_mode(ccm_math_err_mode::eErrnoExcept)) != 0) { return internal::raise_except(excepts); }
+			if constexpr ((ccm_math_err_handling() & get_mode(ccm_math_err_mode::eErrnoExcept)) != 0)
+			{
+				if (!internal::side_effects_reported()) { return internal::divert_except(excepts); }
+				return internal::raise_except(excepts);
+			}
 		}
 		// ReSharper disable once CppDFAUnreachableCode // This is unreachable code if the above constexpr if statement is true which is desired.
 		return 0;
@@ -178,7 +243,7 @@ namespace ccm::support::fenv
 	{
 		if (is_constant_evaluated()) { return; }
 		if constexpr (!is_errno_enabled()) { return; }
-		if ((ccm_math_err_handling() & get_mode(ccm_math_err_mode::eErrno)) != 0) { detail::write_errno(err); }
+		if ((ccm_math_err_handling() & get_mode(ccm_math_err_mode::eErrno)) != 0 && internal::side_effects_reported()) { detail::write_errno(err); }
 	}
 } // namespace ccm::support::fenv
 
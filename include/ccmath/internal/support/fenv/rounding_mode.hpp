@@ -34,20 +34,34 @@ namespace ccm::support::fenv
 
 	namespace internal
 	{
+		// Sentinel for "the rounding mode of this thread is not known to ccmath".
+		inline constexpr int unknown_rounding_mode = -1;
+
+		// The rounding mode of the calling thread as last recorded by ccmath, or unknown_rounding_mode.
+		// It only becomes known inside an assumption scope (see ccm::assume_round_to_nearest), whose
+		// contract is that every rounding change on the thread goes through ccmath's own wrappers
+		// (support::fenv::internal::set_round) until the scope ends. Outside of a scope it stays unknown,
+		// so a std::fesetround made directly by the caller is always observed.
+		inline thread_local int cached_rounding_mode = unknown_rounding_mode;
+
+		inline int rt_get_rounding_mode()
+		{
+			const int cached = cached_rounding_mode;
+			if (cached != unknown_rounding_mode) { return cached; }
+			return std::fegetround();
+		}
+
 		inline bool rt_rounding_mode_is_round_up()
-		{ return std::fegetround() == FE_UPWARD; }
+		{ return rt_get_rounding_mode() == FE_UPWARD; }
 
 		inline bool rt_rounding_mode_is_round_down()
-		{ return std::fegetround() == FE_DOWNWARD; }
+		{ return rt_get_rounding_mode() == FE_DOWNWARD; }
 
 		inline bool rt_rounding_mode_is_round_to_nearest()
-		{ return std::fegetround() == FE_TONEAREST; }
+		{ return rt_get_rounding_mode() == FE_TONEAREST; }
 
 		inline bool rt_rounding_mode_is_round_to_zero()
-		{ return std::fegetround() == FE_TOWARDZERO; }
-
-		inline int rt_get_rounding_mode()
-		{ return std::fegetround(); }
+		{ return rt_get_rounding_mode() == FE_TOWARDZERO; }
 	} // namespace internal
 
 	/**
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Path-hit counters for the branches of the pow, sin/cos and log kernels. Each named path has
+// one process-wide relaxed atomic counter, kept on its own cache line so threads hitting
+// different paths do not contend. Kernels mark a path with CCM_PATH_HIT (one scalar call) or
+// CCM_PATH_HIT_N (a number of vector lanes). A scalar call counts exactly one path of its kernel
+// and a vector lane exactly one lane path, so each group's hits sum to the elements evaluated.
+// Lanes counted as lane_scalar_fallback also count the scalar path they go on to take, where
+// that scalar kernel is instrumented. Both macros expand to nothing unless the build defines
+// CCM_CONFIG_ENABLE_PATH_STATS, so a default build carries no counters, loads or stores.
+// Hits during constant evaluation are never counted.
+
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(CCM_CONFIG_ENABLE_PATH_STATS) && defined(CCMATH_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+	#define CCMATH_PATH_STATS_ACTIVE
+	#include <atomic>
+#endif
+
+namespace ccm::support::path_stats
+{
+	// The names below are the counter labels tools/asmlab/registry/path_categories.json maps
+	// to path categories; keep the two in sync when adding a path.
+	enum class path : std::uint8_t
+	{
+		// Scalar double pow (pow_impl).
+		pow_special_operand,	   // zero, one, NaN, infinite or negative-base domain screen
+		pow_integer_exponent,	   // exact exponentiation by squaring for |y| <= 1024
+		pow_half_integer_exponent, // sqrt, 1/sqrt and sqrt(x)^(2k + 1)
+		pow_subnormal_base,		   // base normalized by 2^52, whichever reconstruction follows
+		pow_double_double,		   // in-range accurate double-double reconstruction
+		pow_scaled_range,		   // double-double reconstruction with a 2^+-512 scale
+		pow_clamped,			   // saturating overflow/underflow fast path
+		// Vector double pow (pow_simd), counted per lane.
+		pow_lane_vector,
+		pow_lane_scalar_fallback,
+		// Scalar double sin, cos and sincos (sincos_double_impl).
+		sincos_zero,
+		sincos_small_reduction,
+		sincos_payne_hanek,
+		sincos_non_finite,
+		// Vector sin, cos and sincos of either precision (sincos_simd_impl), counted per lane.
+		sincos_lane_small_reduction,
+		sincos_lane_payne_hanek,
+		sincos_lane_scalar_fallback,
+		// Scalar double log (log_double_impl).
+		log_near_one,
+		log_subnormal, // normalized by 2^52, then the table path
+		log_table,
+		// Vector double log (log_simd_impl), counted per lane.
+		log_lane_near_one,
+		log_lane_table,
+		log_lane_scalar_fallback,
+	};
+
+	inline constexpr std::size_t path_count = static_cast<std::size_t>(path::log_lane_scalar_fallback) + 1;
+
+	inline constexpr const char * path_names[path_count] = {
+		"pow.special_operand",
+		"pow.integer_exponent",
+		"pow.half_integer_exponent",
+		"pow.subnormal_base",
+		"pow.double_double",
+		"pow.scaled_range",
+		"pow.clamped",
+		"pow.lane_vector",
+		"pow.lane_scalar_fallback",
+		"sincos.zero",
+		"sincos.small_reduction",
+		"sincos.payne_hanek",
+		"sincos.non_finite",
+		"sincos.lane_small_reduction",
+		"sincos.lane_payne_hanek",
+		"sincos.lane_scalar_fallback",
+		"log.near_one",
+		"log.subnormal",
+		"log.table",
+		"log.lane_near_one",
+		"log.lane_table",
+		"log.lane_scalar_fallback",
+	};
+
+	inline constexpr bool enabled =
+#if defined(CCMATH_PATH_STATS_ACTIVE)
+		true;
+#else
+		false;
+#endif
+
+#if defined(CCMATH_PATH_STATS_ACTIVE)
+	namespace internal
+	{
+		struct alignas(64) counter
+		{
+			std::atomic<std::uint64_t> hits{ 0 };
+		};
+
+		inline counter counters[path_count];
+
+		constexpr void hit(path p, std::uint64_t n) noexcept
+		{
+			if (!support::is_constant_evaluated()) { counters[static_cast<std::size_t>(p)].hits.fetch_add(n, std::memory_order_relaxed); }
+		}
+	} // namespace internal
+#endif
+} // namespace ccm::support::path_stats
+
+#if defined(CCMATH_PATH_STATS_ACTIVE)
+	#define CCM_PATH_HIT(name)		   ::ccm::support::path_stats::internal::hit(::ccm::support::path_stats::path::name, 1)
+	#define CCM_PATH_HIT_N(name, lanes) ::ccm::support::path_stats::internal::hit(::ccm::support::path_stats::path::name, static_cast<std::uint64_t>(lanes))
+#else
+	#define CCM_PATH_HIT(name)		   static_cast<void>(0)
+	#define CCM_PATH_HIT_N(name, lanes) static_cast<void>(0)
+#endif
@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "batch/expo.hpp"
+#include "batch/hyper.hpp"
+#include "batch/power.hpp"
+#include "batch/trig.hpp"
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/batch/expo_batch.hpp"
+#include "ccmath/internal/math/runtime/batch/side_effect_policy.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// Batch forms of the exponential and logarithmic functions. Every output element
+// is bit identical to the matching ccm function evaluated through ccmath's generic
+// kernel (never a libm builtin), including the domain handling and the errno and
+// floating-point exception side effects, whichever of the vector or scalar paths
+// processed it. Each entry point also takes a trailing side-effect policy
+// (no_side_effects or collect_exceptions) that drops those side effects for the
+// whole call. The rounding mode is queried once per call. These entry points
+// are runtime only and are not constexpr.
+
+namespace ccm::batch
+{
+	/**
+	 * @brief Computes e raised to the power of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/exp
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void exp(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::exp_batch(in, out, count); }
+
+	/**
+	 * @brief Computes e raised to the power of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving e^x for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void exp(In const & in, Out && out) noexcept
+	{ ccm::batch::exp(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief exp(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto exp(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::exp_batch(in, out, count); }); }
+
+	/**
+	 * @brief exp(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto exp(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::exp(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes 2 raised to the power of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/exp2
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void exp2(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::exp2_batch(in, out, count); }
+
+	/**
+	 * @brief Computes 2 raised to the power of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving 2^x for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void exp2(In const & in, Out && out) noexcept
+	{ ccm::batch::exp2(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief exp2(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto exp2(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::exp2_batch(in, out, count); }); }
+
+	/**
+	 * @brief exp2(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto exp2(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::exp2(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes e raised to the power of each element, minus one.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/expm1
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void expm1(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::expm1_batch(in, out, count); }
+
+	/**
+	 * @brief Computes e raised to the power of each element, minus one.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving e^x - 1 for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void expm1(In const & in, Out && out) noexcept
+	{ ccm::batch::expm1(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief expm1(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto expm1(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::expm1_batch(in, out, count); }); }
+
+	/**
+	 * @brief expm1(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto expm1(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::expm1(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the natural (base e) logarithm of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/log
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void log(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::log_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the natural (base e) logarithm of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving ln(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void log(In const & in, Out && out) noexcept
+	{ ccm::batch::log(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief log(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto log(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::log_batch(in, out, count); }); }
+
+	/**
+	 * @brief log(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto log(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::log(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the base 2 logarithm of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/log2
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void log2(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::log2_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the base 2 logarithm of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving log2(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void log2(In const & in, Out && out) noexcept
+	{ ccm::batch::log2(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief log2(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto log2(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::log2_batch(in, out, count); }); }
+
+	/**
+	 * @brief log2(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto log2(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::log2(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the base 10 logarithm of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/log10
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void log10(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::log10_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the base 10 logarithm of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving log10(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void log10(In const & in, Out && out) noexcept
+	{ ccm::batch::log10(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief log10(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto log10(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::log10_batch(in, out, count); }); }
+
+	/**
+	 * @brief log10(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto log10(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::log10(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the natural logarithm of one plus each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/log1p
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void log1p(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::log1p_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the natural logarithm of one plus each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving ln(1 + x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void log1p(In const & in, Out && out) noexcept
+	{ ccm::batch::log1p(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief log1p(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto log1p(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::log1p_batch(in, out, count); }); }
+
+	/**
+	 * @brief log1p(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto log1p(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::log1p(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+} // namespace ccm::batch
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/batch/hyper_batch.hpp"
+#include "ccmath/internal/math/runtime/batch/side_effect_policy.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// Batch forms of the hyperbolic functions. Every output element is bit
+// identical to the matching ccm function evaluated through ccmath's generic
+// kernel (never a libm builtin), whichever of the vector or scalar paths
+// processed it. Each entry point also takes a trailing side-effect policy
+// (no_side_effects or collect_exceptions) that leaves errno and the
+// floating-point exception flags untouched for the whole call. These entry
+// points are runtime only and are not constexpr.
+
+namespace ccm::batch
+{
+	/**
+	 * @brief Computes the hyperbolic sine of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/sinh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void sinh(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::sinh_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the hyperbolic sine of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving sinh(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void sinh(In const & in, Out && out) noexcept
+	{ ccm::batch::sinh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief sinh(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto sinh(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::sinh_batch(in, out, count); }); }
+
+	/**
+	 * @brief sinh(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto sinh(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::sinh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the hyperbolic cosine of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/cosh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void cosh(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::cosh_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the hyperbolic cosine of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving cosh(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void cosh(In const & in, Out && out) noexcept
+	{ ccm::batch::cosh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief cosh(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto cosh(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::cosh_batch(in, out, count); }); }
+
+	/**
+	 * @brief cosh(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto cosh(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::cosh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the hyperbolic tangent of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/tanh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void tanh(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::tanh_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the hyperbolic tangent of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving tanh(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void tanh(In const & in, Out && out) noexcept
+	{ ccm::batch::tanh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief tanh(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto tanh(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::tanh_batch(in, out, count); }); }
+
+	/**
+	 * @brief tanh(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto tanh(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::tanh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the hyperbolic sine and cosine of each element with one exponential per element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as either output.
+	 * @param sinh_out Pointer to storage for count hyperbolic sines.
+	 * @param cosh_out Pointer to storage for count hyperbolic cosines. Must not overlap sinh_out.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void sinhcosh(T const * in, T * sinh_out, T * cosh_out, std::size_t count) noexcept
+	{ rt::batch_impl::sinhcosh_batch(in, sinh_out, cosh_out, count); }
+
+	/**
+	 * @brief Computes the hyperbolic sine and cosine of each element with one exponential per element.
+	 * @param in Contiguous range of input elements.
+	 * @param sinh_out Contiguous range receiving sinh(x) for each input. May be the same range as in.
+	 * @param cosh_out Contiguous range receiving cosh(x) for each input. Must not overlap sinh_out.
+	 * @note Processes min(std::size(in), std::size(sinh_out), std::size(cosh_out)) elements.
+	 */
+	template <typename In, typename SinhOut, typename CoshOut, rt::batch_impl::enable_if_ranges_t<In, SinhOut> = true,
+			  rt::batch_impl::enable_if_ranges_t<In, CoshOut> = true>
+	inline void sinhcosh(In const & in, SinhOut && sinh_out, CoshOut && cosh_out) noexcept
+	{ ccm::batch::sinhcosh(std::data(in), std::data(sinh_out), std::data(cosh_out), rt::batch_impl::range_count(in, sinh_out, cosh_out)); }
+
+	/**
+	 * @brief sinhcosh(in, sinh_out, cosh_out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto sinhcosh(T const * in, T * sinh_out, T * cosh_out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::sinhcosh_batch(in, sinh_out, cosh_out, count); }); }
+
+	/**
+	 * @brief sinhcosh(in, sinh_out, cosh_out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename SinhOut, typename CoshOut, typename Policy, rt::batch_impl::enable_if_ranges_t<In, SinhOut> = true,
+			  rt::batch_impl::enable_if_ranges_t<In, CoshOut> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto sinhcosh(In const & in, SinhOut && sinh_out, CoshOut && cosh_out, Policy policy) noexcept
+	{ return ccm::batch::sinhcosh(std::data(in), std::data(sinh_out), std::data(cosh_out), rt::batch_impl::range_count(in, sinh_out, cosh_out), policy); }
+
+	/**
+	 * @brief Computes the inverse hyperbolic sine of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/asinh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void asinh(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::asinh_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the inverse hyperbolic sine of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving asinh(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void asinh(In const & in, Out && out) noexcept
+	{ ccm::batch::asinh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief asinh(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto asinh(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::asinh_batch(in, out, count); }); }
+
+	/**
+	 * @brief asinh(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto asinh(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::asinh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the inverse hyperbolic cosine of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/acosh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void acosh(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::acosh_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the inverse hyperbolic cosine of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving acosh(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void acosh(In const & in, Out && out) noexcept
+	{ ccm::batch::acosh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief acosh(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto acosh(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::acosh_batch(in, out, count); }); }
+
+	/**
+	 * @brief acosh(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto acosh(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::acosh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the inverse hyperbolic tangent of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/atanh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void atanh(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::atanh_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the inverse hyperbolic tangent of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving atanh(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void atanh(In const & in, Out && out) noexcept
+	{ ccm::batch::atanh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief atanh(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto atanh(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::atanh_batch(in, out, count); }); }
+
+	/**
+	 * @brief atanh(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto atanh(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::atanh(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+} // namespace ccm::batch
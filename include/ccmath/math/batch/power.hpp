@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/batch/power_batch.hpp"
+#include "ccmath/internal/math/runtime/batch/side_effect_policy.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// Batch forms of the power functions. Every output element is bit identical to
+// the matching ccm function evaluated through ccmath's generic kernel (never a
+// libm builtin), whichever of the vector or scalar paths processed it. Each
+// entry point also takes a trailing side-effect policy (no_side_effects or
+// collect_exceptions) that leaves errno and the floating-point exception flags
+// untouched for the whole call. These entry points are runtime only and are not
+// constexpr.
+
+namespace ccm::batch
+{
+	/**
+	 * @brief Computes the cube root of each element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/cbrt
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void cbrt(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::cbrt_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the cube root of each element.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving cbrt(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void cbrt(In const & in, Out && out) noexcept
+	{ ccm::batch::cbrt(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief cbrt(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto cbrt(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::cbrt_batch(in, out, count); }); }
+
+	/**
+	 * @brief cbrt(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto cbrt(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::cbrt(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes sqrt(x[i]^2 + y[i]^2) for each element pair without undue overflow or underflow.
+	 * @tparam T Floating-point type.
+	 * @param x Pointer to count first coordinates. May be the same pointer as out.
+	 * @param y Pointer to count second coordinates. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/hypot
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void hypot(T const * x, T const * y, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::hypot_batch(x, y, out, count); }
+
+	/**
+	 * @brief Computes sqrt(x[i]^2 + y[i]^2) for each element pair without undue overflow or underflow.
+	 * @param x Contiguous range of first coordinates.
+	 * @param y Contiguous range of second coordinates.
+	 * @param out Contiguous range receiving hypot(x, y) for each pair. May be the same range as either input.
+	 * @note Processes min(std::size(x), std::size(y), std::size(out)) elements.
+	 */
+	template <typename InX, typename InY, typename Out, rt::batch_impl::enable_if_ranges_t<InX, Out> = true,
+			  rt::batch_impl::enable_if_ranges_t<InY, Out> = true>
+	inline void hypot(InX const & x, InY const & y, Out && out) noexcept
+	{ ccm::batch::hypot(std::data(x), std::data(y), std::data(out), rt::batch_impl::range_count(x, y, out)); }
+
+	/**
+	 * @brief hypot(x, y, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto hypot(T const * x, T const * y, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::hypot_batch(x, y, out, count); }); }
+
+	/**
+	 * @brief hypot(x, y, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename InX, typename InY, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<InX, Out> = true,
+			  rt::batch_impl::enable_if_ranges_t<InY, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto hypot(InX const & x, InY const & y, Out && out, Policy policy) noexcept
+	{ return ccm::batch::hypot(std::data(x), std::data(y), std::data(out), rt::batch_impl::range_count(x, y, out), policy); }
+
+	/**
+	 * @brief Computes sqrt(x[i]^2 + y[i]^2 + z[i]^2) for each element triple, such as the lengths of vectors stored as
+	 * separate x, y and z arrays. The inputs are scaled once per triple, not once per pair.
+	 * @tparam T Floating-point type.
+	 * @param x Pointer to count first coordinates. May be the same pointer as out.
+	 * @param y Pointer to count second coordinates. May be the same pointer as out.
+	 * @param z Pointer to count third coordinates. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/hypot
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void hypot(T const * x, T const * y, T const * z, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::hypot_batch(x, y, z, out, count); }
+
+	/**
+	 * @brief Computes sqrt(x[i]^2 + y[i]^2 + z[i]^2) for each element triple of three coordinate ranges.
+	 * @param x Contiguous range of first coordinates.
+	 * @param y Contiguous range of second coordinates.
+	 * @param z Contiguous range of third coordinates.
+	 * @param out Contiguous range receiving hypot(x, y, z) for each triple. May be the same range as any input.
+	 * @note Processes min(std::size(x), std::size(y), std::size(z), std::size(out)) elements.
+	 */
+	template <typename InX, typename InY, typename InZ, typename Out, rt::batch_impl::enable_if_ranges_t<InX, Out> = true,
+			  rt::batch_impl::enable_if_ranges_t<InY, Out> = true, rt::batch_impl::enable_if_ranges_t<InZ, Out> = true>
+	inline void hypot(InX const & x, InY const & y, InZ const & z, Out && out) noexcept
+	{ ccm::batch::hypot(std::data(x), std::data(y), std::data(z), std::data(out), rt::batch_impl::range_count(x, y, z, out)); }
+
+	/**
+	 * @brief hypot(x, y, z, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto hypot(T const * x, T const * y, T const * z, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::hypot_batch(x, y, z, out, count); }); }
+
+	/**
+	 * @brief hypot(x, y, z, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename InX, typename InY, typename InZ, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<InX, Out> = true,
+			  rt::batch_impl::enable_if_ranges_t<InY, Out> = true, rt::batch_impl::enable_if_ranges_t<InZ, Out> = true,
+			  rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto hypot(InX const & x, InY const & y, InZ const & z, Out && out, Policy policy) noexcept
+	{ return ccm::batch::hypot(std::data(x), std::data(y), std::data(z), std::data(out), rt::batch_impl::range_count(x, y, z, out), policy); }
+} // namespace ccm::batch
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/batch/trig_batch.hpp"
+#include "ccmath/internal/math/runtime/batch/side_effect_policy.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// Batch forms of the trigonometric functions. Every output element is bit
+// identical to the matching ccm function evaluated through ccmath's generic
+// kernel (never a libm builtin), including the errno and floating-point
+// exception side effects, whichever of the vector or scalar paths processed it.
+// Each entry point also takes a trailing side-effect policy (no_side_effects or
+// collect_exceptions) that drops those side effects for the whole call. These
+// entry points are runtime only and are not constexpr.
+
+namespace ccm::batch
+{
+	/**
+	 * @brief Computes the sine of each element, in radians.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/sin
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void sin(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::sin_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the sine of each element, in radians.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving sin(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void sin(In const & in, Out && out) noexcept
+	{ ccm::batch::sin(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief sin(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto sin(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::sin_batch(in, out, count); }); }
+
+	/**
+	 * @brief sin(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto sin(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::sin(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the cosine of each element, in radians.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/cos
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void cos(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::cos_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the cosine of each element, in radians.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving cos(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void cos(In const & in, Out && out) noexcept
+	{ ccm::batch::cos(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief cos(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto cos(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::cos_batch(in, out, count); }); }
+
+	/**
+	 * @brief cos(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto cos(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::cos(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the tangent of each element, in radians.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/tan
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void tan(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::tan_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the tangent of each element, in radians.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving tan(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void tan(In const & in, Out && out) noexcept
+	{ ccm::batch::tan(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief tan(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto tan(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::tan_batch(in, out, count); }); }
+
+	/**
+	 * @brief tan(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto tan(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::tan(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the sine and cosine of each element, in radians, with one range reduction per element.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as either output.
+	 * @param sin_out Pointer to storage for count sines.
+	 * @param cos_out Pointer to storage for count cosines. Must not overlap sin_out.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void sincos(T const * in, T * sin_out, T * cos_out, std::size_t count) noexcept
+	{ rt::batch_impl::sincos_batch(in, sin_out, cos_out, count); }
+
+	/**
+	 * @brief Computes the sine and cosine of each element, in radians, with one range reduction per element.
+	 * @param in Contiguous range of input elements.
+	 * @param sin_out Contiguous range receiving sin(x) for each input. May be the same range as in.
+	 * @param cos_out Contiguous range receiving cos(x) for each input. Must not overlap sin_out.
+	 * @note Processes min(std::size(in), std::size(sin_out), std::size(cos_out)) elements.
+	 */
+	template <typename In, typename SinOut, typename CosOut, rt::batch_impl::enable_if_ranges_t<In, SinOut> = true,
+			  rt::batch_impl::enable_if_ranges_t<In, CosOut> = true>
+	inline void sincos(In const & in, SinOut && sin_out, CosOut && cos_out) noexcept
+	{ ccm::batch::sincos(std::data(in), std::data(sin_out), std::data(cos_out), rt::batch_impl::range_count(in, sin_out, cos_out)); }
+
+	/**
+	 * @brief sincos(in, sin_out, cos_out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto sincos(T const * in, T * sin_out, T * cos_out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::sincos_batch(in, sin_out, cos_out, count); }); }
+
+	/**
+	 * @brief sincos(in, sin_out, cos_out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename SinOut, typename CosOut, typename Policy, rt::batch_impl::enable_if_ranges_t<In, SinOut> = true,
+			  rt::batch_impl::enable_if_ranges_t<In, CosOut> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto sincos(In const & in, SinOut && sin_out, CosOut && cos_out, Policy policy) noexcept
+	{ return ccm::batch::sincos(std::data(in), std::data(sin_out), std::data(cos_out), rt::batch_impl::range_count(in, sin_out, cos_out), policy); }
+
+	/**
+	 * @brief Computes the arc sine of each element, in radians.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/asin
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void asin(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::asin_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the arc sine of each element, in radians.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving asin(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void asin(In const & in, Out && out) noexcept
+	{ ccm::batch::asin(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief asin(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto asin(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::asin_batch(in, out, count); }); }
+
+	/**
+	 * @brief asin(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto asin(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::asin(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the arc cosine of each element, in radians.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/acos
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void acos(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::acos_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the arc cosine of each element, in radians.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving acos(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void acos(In const & in, Out && out) noexcept
+	{ ccm::batch::acos(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief acos(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto acos(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::acos_batch(in, out, count); }); }
+
+	/**
+	 * @brief acos(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto acos(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::acos(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the arc tangent of each element, in radians.
+	 * @tparam T Floating-point type.
+	 * @param in Pointer to count input elements. May be the same pointer as out.
+	 * @param out Pointer to storage for count results.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/atan
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void atan(T const * in, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::atan_batch(in, out, count); }
+
+	/**
+	 * @brief Computes the arc tangent of each element, in radians.
+	 * @param in Contiguous range of input elements.
+	 * @param out Contiguous range receiving atan(x) for each input. May be the same range as in.
+	 * @note Processes min(std::size(in), std::size(out)) elements.
+	 */
+	template <typename In, typename Out, rt::batch_impl::enable_if_ranges_t<In, Out> = true>
+	inline void atan(In const & in, Out && out) noexcept
+	{ ccm::batch::atan(std::data(in), std::data(out), rt::batch_impl::range_count(in, out)); }
+
+	/**
+	 * @brief atan(in, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto atan(T const * in, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::atan_batch(in, out, count); }); }
+
+	/**
+	 * @brief atan(in, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename In, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<In, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto atan(In const & in, Out && out, Policy policy) noexcept
+	{ return ccm::batch::atan(std::data(in), std::data(out), rt::batch_impl::range_count(in, out), policy); }
+
+	/**
+	 * @brief Computes the arc tangent of y[i] / x[i] for each element pair, using the signs to pick the quadrant.
+	 * @tparam T Floating-point type.
+	 * @param y Pointer to count numerators. May be the same pointer as out.
+	 * @param x Pointer to count denominators. May be the same pointer as out.
+	 * @param out Pointer to storage for count angles in radians.
+	 * @param count Number of elements to process.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/atan2
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	inline void atan2(T const * y, T const * x, T * out, std::size_t count) noexcept
+	{ rt::batch_impl::atan2_batch(y, x, out, count); }
+
+	/**
+	 * @brief Computes the arc tangent of y[i] / x[i] for each element pair, using the signs to pick the quadrant.
+	 * @param y Contiguous range of numerators.
+	 * @param x Contiguous range of denominators.
+	 * @param out Contiguous range receiving atan2(y, x) for each pair. May be the same range as either input.
+	 * @note Processes min(std::size(y), std::size(x), std::size(out)) elements.
+	 */
+	template <typename InY, typename InX, typename Out, rt::batch_impl::enable_if_ranges_t<InY, Out> = true,
+			  rt::batch_impl::enable_if_ranges_t<InX, Out> = true>
+	inline void atan2(InY const & y, InX const & x, Out && out) noexcept
+	{ ccm::batch::atan2(std::data(y), std::data(x), std::data(out), rt::batch_impl::range_count(y, x, out)); }
+
+	/**
+	 * @brief atan2(y, x, out, count) under a side-effect policy.
+	 * @param policy ccm::batch::no_side_effects, or ccm::batch::collect_exceptions to also get the raised exceptions back.
+	 * @return The FE_* exceptions the call raised under collect_exceptions; nothing under no_side_effects.
+	 */
+	template <typename T, typename Policy, std::enable_if_t<std::is_floating_point_v<T>, bool> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto atan2(T const * y, T const * x, T * out, std::size_t count, Policy policy) noexcept
+	{ return rt::batch_impl::with_policy(policy, [=] { rt::batch_impl::atan2_batch(y, x, out, count); }); }
+
+	/**
+	 * @brief atan2(y, x, out) under a side-effect policy; see the pointer overload.
+	 */
+	template <typename InY, typename InX, typename Out, typename Policy, rt::batch_impl::enable_if_ranges_t<InY, Out> = true,
+			  rt::batch_impl::enable_if_ranges_t<InX, Out> = true, rt::batch_impl::enable_if_policy_t<Policy> = true>
+	inline auto atan2(InY const & y, InX const & x, Out && out, Policy policy) noexcept
+	{ return ccm::batch::atan2(std::data(y), std::data(x), std::data(out), rt::batch_impl::range_count(y, x, out), policy); }
+} // namespace ccm::batch
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized exp2. Same scheme as exp_simd_impl.hpp: the main path replays
+// exp2_double_impl and exp2_float_impl operation for operation with per-lane
+// table gathers, and lanes that leave the scalar main path (overflow,
+// underflow, the scaled subnormal region, infinities and NaN) are recomputed
+// with the scalar kernel.
+
+#include "ccmath/internal/math/runtime/pp/conversion.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/math/expo/impl/exp2_double_impl.hpp"
+#include "ccmath/math/expo/impl/exp2_float_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	// 2^x for a vector of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> exp2_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec = pp::basic_simd<double, Abi>;
+		using U64  = pp::basic_simd<std::uint64_t, Abi>;
+
+		constexpr auto N		  = static_cast<int>(DVec::size());
+		constexpr auto exp2_data  = ccm::internal::exp2_data<double>();
+		constexpr auto table_size = static_cast<std::uint64_t>(1 << ccm::internal::exp2_data<double>::table_bits);
+		constexpr auto table_bits = ccm::internal::exp2_data<double>::table_bits;
+
+		constexpr std::uint64_t tiny_top  = ccm::support::top12_bits_of_double(0x1p-54);
+		constexpr std::uint64_t range_top = ccm::support::top12_bits_of_double(512.0) - tiny_top;
+
+		const U64 abs_top = (pp::simd_bit_cast<std::uint64_t>(x) >> U64(52)) & U64(0x7ff);
+
+		// Same gate as the scalar kernel. Tiny lanes return x + 1, everything at or above 512 in
+		// magnitude (including infinities and NaN) is resolved by the scalar kernel.
+		const auto out_of_range = (abs_top - U64(tiny_top)) >= U64(range_top);
+		const auto tiny			= abs_top < U64(tiny_top);
+		const auto needs_scalar = out_of_range & ~tiny;
+
+		const DVec xs = pp::simd_select(out_of_range, DVec(0.0), x);
+
+		// x = k/N + r, with int k and r in [-1/2N, 1/2N].
+		DVec expo			 = xs + DVec(exp2_data.shift);
+		const U64 expo_int64 = pp::simd_bit_cast<std::uint64_t>(expo);
+		expo				 = expo - DVec(exp2_data.shift);
+		const DVec rem		 = xs - expo;
+
+		// 2^(k/N) ~= scale * (1 + tail).
+		const U64 index = (expo_int64 & U64(table_size - 1)) << U64(1);
+		const U64 top	= expo_int64 << U64(52 - table_bits);
+		const DVec tail([&](auto i) { return ccm::support::uint64_to_double(exp2_data.tab[static_cast<std::size_t>(index[i])]); });
+		const U64 sign_bits = U64([&](auto i) { return exp2_data.tab[static_cast<std::size_t>(index[i]) + 1]; }) + top;
+
+		const DVec remSqr = rem * rem;
+		const DVec tmp	  = tail + rem * DVec(exp2_data.poly[0]) + remSqr * (DVec(exp2_data.poly[1]) + rem * DVec(exp2_data.poly[2])) +
+						 remSqr * remSqr * (DVec(exp2_data.poly[3]) + rem * DVec(exp2_data.poly[4]));
+
+		const DVec scale = pp::simd_bit_cast<double>(sign_bits);
+
+		DVec result = scale + scale * tmp;
+		if (pp::any_of(tiny)) { result = pp::simd_select(tiny, x + DVec(1.0), result); }
+		if (pp::any_of(needs_scalar))
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				if (needs_scalar[i]) { result[i] = exp2_double_impl(x[i]); }
+			}
+		}
+		return result;
+	}
+
+	// 2^x for a vector of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> exp2_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{
+		using FVec = pp::basic_simd<float, Abi>;
+		using DVec = pp::basic_simd<double, Abi>;
+		using U32  = pp::basic_simd<std::uint32_t, Abi>;
+		using U64  = pp::basic_simd<std::uint64_t, Abi>;
+
+		constexpr auto N		  = static_cast<int>(FVec::size());
+		constexpr auto exp2_data  = ccm::internal::exp2_data<float>();
+		constexpr auto table_size = ccm::internal::exp2_data<float>::shifted_table_bits;
+		constexpr auto table_bits = ccm::internal::exp2_data<float>::table_bits;
+
+		// |x| >= 128 or x is NaN: overflow, underflow and the non-finite inputs stay scalar side.
+		const U32 abs_top  = (pp::simd_bit_cast<std::uint32_t>(x) >> U32(20)) & U32(0x7ff);
+		const auto special = abs_top >= U32(ccm::support::top12_bits_of_float(128.0F));
+
+		const DVec xd = pp::static_simd_cast<double>(pp::simd_select(special, FVec(0.0F), x));
+
+		// x = k/N + r with r in [-1/(2N), 1/(2N)] and int k.
+		DVec corrected			= xd + DVec(exp2_data.shift_scaled);
+		const U64 lookup_index	= pp::simd_bit_cast<std::uint64_t>(corrected);
+		corrected				= corrected - DVec(exp2_data.shift_scaled);
+		const DVec rem			= xd - corrected;
+
+		// exp2(x) = 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1)
+		const U64 tab_bits([&](auto i) { return exp2_data.tab[static_cast<std::size_t>(lookup_index[i] % table_size)]; });
+		const DVec scale = pp::simd_bit_cast<double>(tab_bits + (lookup_index << U64(52 - table_bits)));
+
+		const DVec poly_head = DVec(exp2_data.poly[0]) * rem + DVec(exp2_data.poly[1]);
+		const DVec remSqr	 = rem * rem;
+		DVec result			 = DVec(exp2_data.poly[2]) * rem + DVec(1.0);
+		result				 = poly_head * remSqr + result;
+		result				 = result * scale;
+
+		FVec out = pp::static_simd_cast<float>(result);
+		if (pp::any_of(special))
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				if (special[i]) { out[i] = exp2_float_impl(x[i]); }
+			}
+		}
+		return out;
+	}
+} // namespace ccm::internal::impl
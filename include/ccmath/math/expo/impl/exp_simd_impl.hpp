@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized exp. The main path replays exp_double_impl and exp_float_impl
+// operation for operation, with the table lookups done as per-lane gathers, so
+// every lane that resolves through it is bit identical to the scalar kernel.
+// Lanes the scalar kernel routes through its special case handling (overflow,
+// underflow, the scaled subnormal region, infinities and NaN) are recomputed
+// with the scalar kernel, which keeps the result and its fenv side effects.
+
+#include "ccmath/internal/math/runtime/pp/conversion.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/math/expo/impl/exp_double_impl.hpp"
+#include "ccmath/math/expo/impl/exp_float_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	// e^x for a vector of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> exp_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec = pp::basic_simd<double, Abi>;
+		using U64  = pp::basic_simd<std::uint64_t, Abi>;
+
+		constexpr auto N = static_cast<int>(DVec::size());
+
+		constexpr std::uint64_t tiny_top  = ccm::support::top12_bits_of_double(0x1p-54);
+		constexpr std::uint64_t range_top = ccm::support::top12_bits_of_double(512.0) - tiny_top;
+
+		const U64 abs_top = (pp::simd_bit_cast<std::uint64_t>(x) >> U64(52)) & U64(0x7ff);
+
+		// Same gate as the scalar kernel. Tiny lanes return 1 + x, everything at or above 512 in
+		// magnitude (including infinities and NaN) is resolved by the scalar kernel.
+		const auto out_of_range = (abs_top - U64(tiny_top)) >= U64(range_top);
+		const auto tiny			= abs_top < U64(tiny_top);
+		const auto needs_scalar = out_of_range & ~tiny;
+
+		// Replace out of range lanes with a benign value so the vector main path cannot raise
+		// spurious floating point exceptions on them.
+		const DVec xs = pp::simd_select(out_of_range, DVec(0.0), x);
+
+		// x = ln2/N*expo + rem, with int expo and rem in [-ln2/2N, ln2/2N].
+		const DVec scaled_input = DVec(exp_invLn2N_dbl) * xs;
+		DVec expo				= scaled_input + DVec(exp_shift_dbl);
+		const U64 expo_int64	= pp::simd_bit_cast<std::uint64_t>(expo);
+		expo					= expo - DVec(exp_shift_dbl);
+
+		const DVec rem = xs + expo * DVec(exp_negLn2HiN_dbl) + expo * DVec(exp_negLn2LoN_dbl);
+
+		// 2^(expo/N) ~= scale * (1 + tail).
+		const U64 index = (expo_int64 & U64(k_exp_table_n_dbl - 1)) << U64(1);
+		const U64 top	= expo_int64 << U64(52 - k_exp_table_bits_dbl);
+		const DVec tail([&](auto i) { return ccm::support::uint64_to_double(exp_tab_dbl[static_cast<std::size_t>(index[i])]); });
+		const U64 sign_bits = U64([&](auto i) { return exp_tab_dbl[static_cast<std::size_t>(index[i]) + 1]; }) + top;
+
+		const DVec remSqr = rem * rem;
+		const DVec tmp	  = tail + rem + remSqr * (DVec(exp_poly_coeff_one_dbl) + rem * DVec(exp_poly_coeff_two_dbl)) +
+						 remSqr * remSqr * (DVec(exp_poly_coeff_three_dbl) + rem * DVec(exp_poly_coeff_four_dbl));
+
+		const DVec scale = pp::simd_bit_cast<double>(sign_bits);
+
+		DVec result = scale + scale * tmp;
+		if (pp::any_of(tiny)) { result = pp::simd_select(tiny, DVec(1.0) + x, result); }
+		if (pp::any_of(needs_scalar))
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				if (needs_scalar[i]) { result[i] = exp_double_impl(x[i]); }
+			}
+		}
+		return result;
+	}
+
+	// e^x for a vector of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> exp_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{
+		using FVec = pp::basic_simd<float, Abi>;
+		using DVec = pp::basic_simd<double, Abi>;
+		using U32  = pp::basic_simd<std::uint32_t, Abi>;
+		using U64  = pp::basic_simd<std::uint64_t, Abi>;
+
+		constexpr auto N = static_cast<int>(FVec::size());
+
+		// |x| >= 88 or x is NaN: overflow, underflow and the non-finite inputs stay scalar side.
+		const U32 abs_top  = (pp::simd_bit_cast<std::uint32_t>(x) >> U32(20)) & U32(0x7ff);
+		const auto special = abs_top >= U32(ccm::support::top12_bits_of_float(88.0F));
+
+		const FVec xs = pp::simd_select(special, FVec(0.0F), x);
+
+		// x*N/Ln2 = k + r with r in [-1/2, 1/2] and int k.
+		const DVec scaled_input = DVec(exp_inv_ln2_N_flt) * pp::static_simd_cast<double>(xs);
+		DVec expo				= scaled_input + DVec(exp_shift_flt);
+		const U64 expo_int64	= pp::simd_bit_cast<std::uint64_t>(expo);
+		expo					= expo - DVec(exp_shift_flt);
+		const DVec rem			= scaled_input - expo;
+
+		// exp(x) = 2^(k/N) * 2^(r/N) ~= s * (C0*r^3 + C1*r^2 + C2*r + 1)
+		const U64 tab_bits([&](auto i) { return exp_tab_flt[static_cast<std::size_t>(expo_int64[i] % k_exp_table_n_flt)]; });
+		const DVec scale = pp::simd_bit_cast<double>(tab_bits + (expo_int64 << U64(52 - k_exp_table_bits_flt)));
+
+		const DVec poly_head = DVec(exp_poly_scaled_flt[0]) * rem + DVec(exp_poly_scaled_flt[1]);
+		const DVec remSqr	 = rem * rem;
+		DVec result			 = DVec(exp_poly_scaled_flt[2]) * rem + DVec(1.0);
+		result				 = poly_head * remSqr + result;
+		result				 = scale * result;
+
+		FVec out = pp::static_simd_cast<float>(result);
+		if (pp::any_of(special))
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				if (special[i]) { out[i] = exp_float_impl(x[i]); }
+			}
+		}
+		return out;
+	}
+} // namespace ccm::internal::impl
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/math/expo/impl/log10_impl.hpp"
+#include "ccmath/math/expo/impl/log_simd_impl.hpp"
+#include "ccmath/math/numbers.hpp"
+
+namespace ccm::internal::impl
+{
+	// Same as log10_float_impl and log10_double_impl: ln(x) rounded to T, then scaled by log10(e) in T.
+	template <typename T, typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> log10_simd_impl(pp::basic_simd<T, Abi> const & x) noexcept
+	{
+		return log_simd_impl(x) * pp::basic_simd<T, Abi>(static_cast<T>(numbers::log10e_v<T>));
+	}
+} // namespace ccm::internal::impl
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized base 2 logarithm. The table driven main path and the double
+// precision near-one polynomial replay log2_double_impl and log2_float_impl
+// operation for operation, so every lane is bit identical to the scalar kernel.
+// Lanes the scalar kernel treats specially (zero, negative, subnormal, infinite
+// and NaN inputs) are recomputed with the scalar kernel. As with log_simd_impl,
+// the domain handling of ccm::log2 is left to the caller.
+
+#include "ccmath/internal/math/runtime/pp/conversion.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/math/expo/impl/log2_double_impl.hpp"
+#include "ccmath/math/expo/impl/log2_float_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	// log2(x) for a vector of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> log2_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec = pp::basic_simd<double, Abi>;
+		using U64  = pp::basic_simd<std::uint64_t, Abi>;
+		using I64  = pp::basic_simd<std::int64_t, Abi>;
+
+		constexpr auto N = static_cast<int>(DVec::size());
+
+		constexpr std::uint64_t low		= ccm::support::double_to_uint64(1.0 - 0x1.5b51p-5);
+		constexpr std::uint64_t high	= ccm::support::double_to_uint64(1.0 + 0x1.6ab2p-5);
+		constexpr std::uint64_t one		= ccm::support::double_to_uint64(1.0);
+		constexpr std::uint64_t hi_mask = 0xffffffff00000000ULL; // Keeps the top 32 bits for the hi/lo split.
+
+		const U64 intX = pp::simd_bit_cast<std::uint64_t>(x);
+		const U64 top  = intX >> U64(48);
+
+		const auto near_one = (intX - U64(low)) < U64(high - low);
+		const auto special	= (top - U64(0x0010)) >= U64(0x7ff0 - 0x0010);
+
+		// Replace special lanes with a benign value so the vector main path cannot raise
+		// spurious floating point exceptions on them.
+		const DVec xs	  = pp::simd_select(special, DVec(1.0), x);
+		const U64 intXs	  = pp::simd_bit_cast<std::uint64_t>(xs);
+		const U64 tmp	  = intXs - U64(k_log2TableOff_dbl);
+		const U64 index	  = (tmp >> U64(52 - ccm::internal::k_log2TableBitsDbl)) & U64(k_log2TableN_dbl - 1);
+		const I64 expo	  = pp::simd_bit_cast<std::int64_t>(tmp) >> I64(52); // Arithmetic shift
+		const U64 intNorm = intXs - (tmp & U64(0xfffULL << 52));
+
+		const DVec inverseCoeff([&](auto i) { return log2_tab_values_dbl[static_cast<std::size_t>(index[i])].invc; });
+		const DVec logarithmCoeff([&](auto i) { return log2_tab_values_dbl[static_cast<std::size_t>(index[i])].logc; });
+		const DVec centerHi([&](auto i) { return log2_tab2_values_dbl[static_cast<std::size_t>(index[i])].chi; });
+		const DVec centerLo([&](auto i) { return log2_tab2_values_dbl[static_cast<std::size_t>(index[i])].clo; });
+		const DVec normVal = pp::simd_bit_cast<double>(intNorm);
+		const DVec expoDbl = pp::static_simd_cast<double>(expo);
+
+		const DVec invLn2Hi(log2_inverse_ln2_high_value_dbl);
+		const DVec invLn2Lo(log2_inverse_ln2_low_value_dbl);
+
+		const DVec rem		   = (normVal - centerHi - centerLo) * inverseCoeff;
+		const DVec remHi	   = pp::simd_bit_cast<double>(pp::simd_bit_cast<std::uint64_t>(rem) & U64(hi_mask));
+		const DVec remLo	   = rem - remHi;
+		const DVec remHighPart = remHi * invLn2Hi;
+		const DVec remLowPart  = remLo * invLn2Hi + rem * invLn2Lo;
+
+		// hi + lo = rem/ln2 + log2(c) + expo
+		const DVec logExpoSum = expoDbl + logarithmCoeff;
+		const DVec highPart	  = logExpoSum + remHighPart;
+		const DVec lowPart	  = logExpoSum - highPart + remHighPart + remLowPart;
+
+		// log2(rem+1) = rem/ln2 + rem^2*poly(rem)
+		const DVec remSqr  = rem * rem;
+		const DVec remQuad = remSqr * remSqr;
+		const DVec polynomialTerm =
+			DVec(log2_poly_values_dbl[0]) + rem * DVec(log2_poly_values_dbl[1]) +
+			remSqr * (DVec(log2_poly_values_dbl[2]) + rem * DVec(log2_poly_values_dbl[3])) +
+			remQuad * (DVec(log2_poly_values_dbl[4]) + rem * DVec(log2_poly_values_dbl[5]));
+		DVec result = lowPart + remSqr * polynomialTerm + highPart;
+
+		if (pp::any_of(near_one))
+		{
+			// Inputs close to 1.0 use the dedicated polynomial with the hi/lo split of r/ln2.
+			const DVec xn		= pp::simd_select(near_one, x, DVec(1.0));
+			const DVec r		= xn - DVec(1.0);
+			const DVec rHi		= pp::simd_bit_cast<double>(pp::simd_bit_cast<std::uint64_t>(r) & U64(hi_mask));
+			const DVec rLo		= r - rHi;
+			const DVec nearHigh = rHi * invLn2Hi;
+			DVec nearLow		= rLo * invLn2Hi + r * invLn2Lo;
+
+			const DVec rSqr	 = r * r;
+			const DVec rQuad = rSqr * rSqr;
+
+			const DVec poly = rSqr * (DVec(log2_poly1_values_dbl[0]) + r * DVec(log2_poly1_values_dbl[1]));
+			DVec near		= nearHigh + poly;
+			nearLow			= nearLow + (nearHigh - near + poly);
+			nearLow			= nearLow + rQuad * (DVec(log2_poly1_values_dbl[2]) + r * DVec(log2_poly1_values_dbl[3]) +
+										 rSqr * (DVec(log2_poly1_values_dbl[4]) + r * DVec(log2_poly1_values_dbl[5])) +
+										 rQuad * (DVec(log2_poly1_values_dbl[6]) + r * DVec(log2_poly1_values_dbl[7]) +
+												  rSqr * (DVec(log2_poly1_values_dbl[8]) + r * DVec(log2_poly1_values_dbl[9]))));
+			near			= near + nearLow;
+
+			result = pp::simd_select(near_one, near, result);
+			result = pp::simd_select(intX == U64(one), DVec(0.0), result);
+		}
+
+		if (pp::any_of(special))
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				if (special[i]) { result[i] = log2_double_impl(x[i]); }
+			}
+		}
+		return result;
+	}
+
+	// log2(x) for a vector of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> log2_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{
+		using FVec = pp::basic_simd<float, Abi>;
+		using DVec = pp::basic_simd<double, Abi>;
+		using U32  = pp::basic_simd<std::uint32_t, Abi>;
+		using I32  = pp::basic_simd<std::int32_t, Abi>;
+
+		constexpr auto N = static_cast<int>(FVec::size());
+
+		const U32 intX	   = pp::simd_bit_cast<std::uint32_t>(x);
+		const auto is_one  = intX == U32(0x3f800000U);
+		const auto special = (intX - U32(0x00800000U)) >= U32(0x7f800000U - 0x00800000U);
+
+		const FVec xs	  = pp::simd_select(special, FVec(1.0F), x);
+		const U32 intXs	  = pp::simd_bit_cast<std::uint32_t>(xs);
+		const U32 tmp	  = intXs - U32(k_log2TableOff_flt);
+		const U32 index	  = (tmp >> U32(23 - ccm::internal::k_log2TableBitsFlt)) & U32(k_log2TableN_flt - 1);
+		const U32 intNorm = intXs - (tmp & U32(0xff800000U));
+		const I32 expo	  = pp::simd_bit_cast<std::int32_t>(tmp) >> I32(23);
+
+		const DVec inverseCoeff([&](auto i) { return log2_tab_values_flt[static_cast<std::size_t>(index[i])].invc; });
+		const DVec logarithmCoeff([&](auto i) { return log2_tab_values_flt[static_cast<std::size_t>(index[i])].logc; });
+		const DVec normVal = pp::static_simd_cast<double>(pp::simd_bit_cast<float>(intNorm));
+
+		// log2(x) = log1p(normVal/c-1)/ln2 + log2(c) + expo
+		const DVec rem	   = normVal * inverseCoeff - DVec(1.0);
+		const DVec result0 = logarithmCoeff + pp::static_simd_cast<double>(expo);
+
+		const DVec remSqr		  = rem * rem;
+		DVec result				  = DVec(log2_poly_values_flt[1]) * rem + DVec(log2_poly_values_flt[2]);
+		result					  = DVec(log2_poly_values_flt[0]) * remSqr + result;
+		const DVec polynomialTerm = DVec(log2_poly_values_flt[3]) * rem + result0;
+		result					  = result * remSqr + polynomialTerm;
+
+		FVec out = pp::simd_select(is_one, FVec(0.0F), pp::static_simd_cast<float>(result));
+		if (pp::any_of(special))
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				if (special[i]) { out[i] = log2_float_impl(x[i]); }
+			}
+		}
+		return out;
+	}
+} // namespace ccm::internal::impl
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Domain handling shared by ccm::log, ccm::log2 and ccm::log10, which the log kernels
+// leave to their callers. The scalar form raises the same errno and fenv side effects
+// as the public functions; the vector form keeps in-domain lanes on the vector kernel
+// and resolves the rest through the scalar form.
+
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/internal/predef/likely.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fenv/fenv_support.hpp"
+#include "ccmath/math/compare/isnan.hpp"
+
+#include <cerrno>
+#include <limits>
+
+namespace ccm::internal::impl
+{
+	template <typename T, typename Kernel>
+	inline T log_domain_or(T x, Kernel kernel) noexcept
+	{
+		if (x == static_cast<T>(0))
+		{
+			ccm::support::fenv::set_errno_if_required(ERANGE);
+			ccm::support::fenv::raise_except_if_required(FE_DIVBYZERO);
+			return -std::numeric_limits<T>::infinity();
+		}
+		if (x < static_cast<T>(0))
+		{
+			ccm::support::fenv::set_errno_if_required(EDOM);
+			ccm::support::fenv::raise_except_if_required(FE_INVALID);
+			return -std::numeric_limits<T>::quiet_NaN();
+		}
+		if (CCM_UNLIKELY(x == std::numeric_limits<T>::infinity())) { return std::numeric_limits<T>::infinity(); }
+		if (CCM_UNLIKELY(ccm::isnan(x))) { return std::numeric_limits<T>::quiet_NaN(); }
+		return kernel(x);
+	}
+
+	// Lanes outside the kernel's domain are replaced with 1 before the vector kernel runs and are
+	// then resolved by the scalar form with scalar_kernel.
+	template <typename T, typename Abi, typename VectorKernel, typename ScalarKernel>
+	CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> log_domain_or(pp::basic_simd<T, Abi> const & x, VectorKernel vector_kernel, ScalarKernel scalar_kernel) noexcept
+	{
+		using V			   = pp::basic_simd<T, Abi>;
+		const auto outside = (!(x > V(static_cast<T>(0)))) | (x == V(std::numeric_limits<T>::infinity()));
+		if (CCM_LIKELY(pp::none_of(outside))) { return vector_kernel(x); }
+
+		V result = vector_kernel(pp::simd_select(outside, V(static_cast<T>(1)), x));
+		for (int i = 0; i < static_cast<int>(V::size()); ++i)
+		{
+			if (outside[i]) { result[i] = log_domain_or(x[i], scalar_kernel); }
+		}
+		return result;
+	}
+} // namespace ccm::internal::impl
@@ -12,6 +12,7 @@
 
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/path_stats.hpp"
 #include "ccmath/internal/types/fp_types.hpp"
 #include "ccmath/math/expo/impl/log_data.hpp"
 
@@ -47,6 +48,7 @@ namespace ccm::internal
 			// Handle special cases where input is close to 1.0
 			if (CCM_UNLIKELY(intX - low < high - low))
 			{
+				CCM_PATH_HIT(log_near_one);
 				// Handle the case where x is exactly 1.0
 				if (CCM_UNLIKELY(intX == ccm::support::double_to_uint64(1.0))) { return 0; }
 
@@ -75,10 +77,15 @@ namespace ccm::internal
 			// Handle special cases for very small or very large inputs
 			if (CCM_UNLIKELY(top - 0x0010 >= 0x7ff0 - 0x0010))
 			{
-				// x is subnormal, normalize it.
+				// x is subnormal, normalize it. Counted as its own path, not as log_table.
+				CCM_PATH_HIT(log_subnormal);
 				intX = support::double_to_uint64(x * 0x1p52);
 				intX -= 52ULL << 52;
 			}
+			else
+			{
+				CCM_PATH_HIT(log_table);
+			}
 
 			/*
 			 * x = 2^expo normVal. normVal is in range [0x3fe6000000000000, 2 * 0x3fe6000000000000) and exact.
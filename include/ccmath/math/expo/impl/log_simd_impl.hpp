@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized natural logarithm. Both the table driven main path and the double
+// precision near-one polynomial replay log_double_impl and log_float_impl
+// operation for operation, so every lane is bit identical to the scalar kernel.
+// Lanes the scalar kernel treats specially (zero, negative, subnormal, infinite
+// and NaN inputs) are recomputed with the scalar kernel. Like the scalar kernel,
+// these functions do not apply the domain handling of ccm::log; callers that
+// need it filter those lanes first.
+
+#include "ccmath/internal/math/runtime/pp/conversion.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/path_stats.hpp"
+#include "ccmath/math/expo/impl/log_double_impl.hpp"
+#include "ccmath/math/expo/impl/log_float_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	// ln(x) for a vector of double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> log_simd_impl(pp::basic_simd<double, Abi> const & x) noexcept
+	{
+		using DVec = pp::basic_simd<double, Abi>;
+		using U64  = pp::basic_simd<std::uint64_t, Abi>;
+		using I64  = pp::basic_simd<std::int64_t, Abi>;
+
+		constexpr auto N = static_cast<int>(DVec::size());
+
+		constexpr std::uint64_t low	 = ccm::support::double_to_uint64(1.0 - 0x1p-4);
+		constexpr std::uint64_t high = ccm::support::double_to_uint64(1.0 + 0x1p-4);
+		constexpr std::uint64_t one	 = ccm::support::double_to_uint64(1.0);
+
+		const U64 intX = pp::simd_bit_cast<std::uint64_t>(x);
+		const U64 top  = intX >> U64(48);
+
+		const auto near_one = (intX - U64(low)) < U64(high - low);
+		const auto special	= (top - U64(0x0010)) >= U64(0x7ff0 - 0x0010);
+
+		// The two masks are disjoint: every lane near one is a normal number.
+		CCM_PATH_HIT_N(log_lane_near_one, pp::reduce_count(near_one));
+		CCM_PATH_HIT_N(log_lane_table, N - pp::reduce_count(near_one) - pp::reduce_count(special));
+		CCM_PATH_HIT_N(log_lane_scalar_fallback, pp::reduce_count(special));
+
+		// Replace special lanes with a benign value so the vector main path cannot raise
+		// spurious floating point exceptions on them.
+		const DVec xs	  = pp::simd_select(special, DVec(1.0), x);
+		const U64 intXs	  = pp::simd_bit_cast<std::uint64_t>(xs);
+		const U64 tmp	  = intXs - U64(k_logTableOff_dbl);
+		const U64 index	  = (tmp >> U64(52 - ccm::internal::k_logTableBitsDbl)) & U64(k_logTableN_dbl - 1);
+		const I64 expo	  = pp::simd_bit_cast<std::int64_t>(tmp) >> I64(52); // Arithmetic shift
+		const U64 intNorm = intXs - (tmp & U64(0xfffULL << 52));
+
+		const DVec inverseCoeff([&](auto i) { return log_tab_values_dbl[static_cast<std::size_t>(index[i])].invc; });
+		const DVec logarithmCoeff([&](auto i) { return log_tab_values_dbl[static_cast<std::size_t>(index[i])].logc; });
+		const DVec centerHi([&](auto i) { return log_tab2_values_dbl[static_cast<std::size_t>(index[i])].chi; });
+		const DVec centerLo([&](auto i) { return log_tab2_values_dbl[static_cast<std::size_t>(index[i])].clo; });
+		const DVec normVal = pp::simd_bit_cast<double>(intNorm);
+
+		// log(x) = log1p(normVal/c-1) + log(c) + expo*Ln2.
+		const DVec rem		   = (normVal - centerHi - centerLo) * inverseCoeff;
+		const DVec scaleFactor = pp::static_simd_cast<double>(expo);
+
+		// hi + lo = r + log(c) + expo*Ln2.
+		const DVec workspace = scaleFactor * DVec(log_ln2hi_value_dbl) + logarithmCoeff;
+		const DVec highPart	 = workspace + rem;
+		const DVec lowPart	 = workspace - highPart + rem + scaleFactor * DVec(log_ln2lo_value_dbl);
+
+		// log(x) = lo + (log1p(rem) - rem) + hi.
+		const DVec remSqr = rem * rem;
+		DVec result		  = lowPart + remSqr * DVec(log_poly_values_dbl[0]) +
+					  rem * remSqr *
+						  (DVec(log_poly_values_dbl[1]) + rem * DVec(log_poly_values_dbl[2]) +
+						   remSqr * (DVec(log_poly_values_dbl[3]) + rem * DVec(log_poly_values_dbl[4]))) +
+					  highPart;
+
+		if (pp::any_of(near_one))
+		{
+			// Inputs close to 1.0 use the dedicated polynomial with the hi/lo split correction.
+			const DVec xn		= pp::simd_select(near_one, x, DVec(1.0));
+			const DVec r		= xn - DVec(1.0);
+			const DVec rSqr		= r * r;
+			const DVec rCubed	= r * rSqr;
+			DVec near			= rCubed * (DVec(log_poly1_values_dbl[1]) + r * DVec(log_poly1_values_dbl[2]) + rSqr * DVec(log_poly1_values_dbl[3]) +
+									rCubed * (DVec(log_poly1_values_dbl[4]) + r * DVec(log_poly1_values_dbl[5]) + rSqr * DVec(log_poly1_values_dbl[6]) +
+											  rCubed * (DVec(log_poly1_values_dbl[7]) + r * DVec(log_poly1_values_dbl[8]) +
+														rSqr * DVec(log_poly1_values_dbl[9]) + rCubed * DVec(log_poly1_values_dbl[10]))));
+			DVec split			= r * DVec(0x1p27);
+			const DVec rhi		= r + split - split;
+			const DVec rlo		= r - rhi;
+			split				= rhi * rhi * DVec(log_poly1_values_dbl[0]);
+			const DVec nearHigh = r + split;
+			DVec nearLow		= r - nearHigh + split;
+			nearLow				= nearLow + DVec(log_poly1_values_dbl[0]) * rlo * (rhi + r);
+			near				= near + nearLow;
+			near				= near + nearHigh;
+
+			result = pp::simd_select(near_one, near, result);
+			result = pp::simd_select(intX == U64(one), DVec(0.0), result);
+		}
+
+		if (pp::any_of(special))
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				if (special[i]) { result[i] = log_double_impl(x[i]); }
+			}
+		}
+		return result;
+	}
+
+	// ln(x) for a vector of single precision lanes, evaluated in double precision lanes.
+	template <typename Abi>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<float, Abi> log_simd_impl(pp::basic_simd<float, Abi> const & x) noexcept
+	{
+		using FVec = pp::basic_simd<float, Abi>;
+		using DVec = pp::basic_simd<double, Abi>;
+		using U32  = pp::basic_simd<std::uint32_t, Abi>;
+		using I32  = pp::basic_simd<std::int32_t, Abi>;
+
+		constexpr auto N = static_cast<int>(FVec::size());
+
+		const U32 intX	   = pp::simd_bit_cast<std::uint32_t>(x);
+		const auto is_one  = intX == U32(0x3f800000U);
+		const auto special = (intX - U32(0x00800000U)) >= U32(0x7f800000U - 0x00800000U);
+
+		const FVec xs	   = pp::simd_select(special, FVec(1.0F), x);
+		const U32 intXs	   = pp::simd_bit_cast<std::uint32_t>(xs);
+		const U32 tmp	   = intXs - U32(k_logTableOff_flt);
+		const U32 index	   = (tmp >> U32(23 - ccm::internal::k_logTableBitsFlt)) & U32(k_logTableN_flt - 1);
+		const I32 expo	   = pp::simd_bit_cast<std::int32_t>(tmp) >> I32(23);
+		const U32 intNorm  = intXs - (tmp & U32(0x1ffU << 23));
+
+		const DVec inverseCoeff([&](auto i) { return log_tab_values_flt[static_cast<std::size_t>(index[i])].invc; });
+		const DVec logarithmCoeff([&](auto i) { return log_tab_values_flt[static_cast<std::size_t>(index[i])].logc; });
+		const DVec normVal = pp::static_simd_cast<double>(pp::simd_bit_cast<float>(intNorm));
+
+		// log(x) = log1p(normVal / inverseCoeff - 1) + log(inverseCoeff) + expo * Ln2
+		const DVec rem	   = normVal * inverseCoeff - DVec(1.0);
+		const DVec result0 = logarithmCoeff + pp::static_simd_cast<double>(expo) * DVec(log_ln2_value_flt);
+
+		const DVec remSqr = rem * rem;
+		DVec result		  = DVec(log_poly_values_flt[1]) * rem + DVec(log_poly_values_flt[2]);
+		result			  = DVec(log_poly_values_flt[0]) * remSqr + result;
+		result			  = result * remSqr + (result0 + rem);
+
+		FVec out = pp::simd_select(is_one, FVec(0.0F), pp::static_simd_cast<float>(result));
+		if (pp::any_of(special))
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				if (special[i]) { out[i] = log_float_impl(x[i]); }
+			}
+		}
+		return out;
+	}
+} // namespace ccm::internal::impl
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// ccm::fast trades a few ULP of accuracy for speed. The functions directly in ccm are the accurate tier.
+// Only kernels that measured faster than the accurate ones are here: pow, float exp and a reciprocal
+// square root had no shorter kernel that beat ccm::pow, ccm::exp and 1 / ccm::sqrt, so they have no
+// fast version.
+#include "fast/cos.hpp"
+#include "fast/exp.hpp"
+#include "fast/log.hpp"
+#include "fast/sin.hpp"
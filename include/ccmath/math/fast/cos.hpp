@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/math/fast/impl/sincos_fast_impl.hpp"
+#include "ccmath/math/trig/cos.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace ccm::fast
+{
+	/**
+	 * @brief Computes the cosine of an angle in radians with a shorter polynomial than ccm::cos.
+	 * @tparam T floating-point type. long double is evaluated in double precision.
+	 * @param num Angle in radians.
+	 * @return cosine of num, within 4 ULP for double and 1 ULP for float.
+	 * @note Angles below 2^-26 or at least 2^16 (double) or 2^20 (float) in magnitude, infinities and
+	 * NaN are handed to ccm::cos, so they get its results and errno/fenv behavior. Every other angle
+	 * leaves errno alone and raises at most FE_INEXACT.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T cos(T num)
+	{
+		if constexpr (std::is_same_v<T, float>)
+		{
+			const std::uint32_t x_abs = support::float_to_uint32(num) & 0x7fff'ffffU;
+			if (CCM_UNLIKELY(x_abs - 0x3280'0000U >= 0x4980'0000U - 0x3280'0000U)) { return ccm::cos(num); }
+			return internal::impl::sincos_fast_float_impl<false>(num);
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			const std::uint64_t x_abs = support::double_to_uint64(num) & 0x7fff'ffff'ffff'ffffULL;
+			if (CCM_UNLIKELY(x_abs - 0x3e50'0000'0000'0000ULL >= 0x40f0'0000'0000'0000ULL - 0x3e50'0000'0000'0000ULL)) { return ccm::cos(num); }
+			return internal::impl::sincos_fast_double_impl<false>(num);
+		}
+		else
+		{
+			return static_cast<T>(ccm::fast::cos(static_cast<double>(num)));
+		}
+	}
+} // namespace ccm::fast
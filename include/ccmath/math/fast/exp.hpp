@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/math/expo/exp.hpp"
+#include "ccmath/math/fast/impl/exp_fast_impl.hpp"
+
+#include <type_traits>
+
+namespace ccm::fast
+{
+	/**
+	 * @brief Computes e raised to the given power with a shorter polynomial than ccm::exp.
+	 * @tparam T double or long double; long double is evaluated in double precision. There is no float
+	 * version: ccm::exp's float kernel already evaluates a short polynomial in double, and no shorter
+	 * one was faster.
+	 * @param num floating-point value
+	 * @return e^num, within 3 ULP.
+	 * @note Arguments that are infinite, NaN or near the overflow and underflow thresholds are handed
+	 * to ccm::exp, so they get its results and errno/fenv behavior. Every other argument leaves errno
+	 * alone and raises at most FE_INEXACT.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T> && !std::is_same_v<T, float>, bool> = true>
+	constexpr T exp(T num)
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			if (CCM_UNLIKELY((support::top12_bits_of_double(num) & 0x7ff) >= support::top12_bits_of_double(512.0))) { return ccm::exp(num); }
+			return internal::impl::exp_fast_double_impl(num);
+		}
+		else
+		{
+			return static_cast<T>(ccm::fast::exp(static_cast<double>(num)));
+		}
+	}
+} // namespace ccm::fast
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/helpers/exp_helpers.hpp"
+#include "ccmath/internal/types/fp_types.hpp"
+#include "ccmath/math/expo/impl/exp_double_impl.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	// exp(r) - 1 - r ~= r^2 (C0 + r C1 + r^2 C2) on |r| <= ln2/256: one term fewer than exp_double_impl.
+	// Chebyshev fit; the polynomial error is below 3.1e-16 relative.
+	constexpr std::array<double, 3> exp_fast_poly_dbl = { 0x1.0000000000000p-1, 0x1.55555b7bae95fp-3, 0x1.5555596ee628dp-5 };
+
+	/**
+	 * @brief The table-driven exp of exp_double_impl with a degree-4 polynomial and no special-case handling.
+	 * @pre |x| < 512, so the result is a normal double and the table scale cannot overflow.
+	 */
+	constexpr double exp_fast_double_impl(double x)
+	{
+		const ccm::double_t scaled_input = exp_invLn2N_dbl * x;
+
+		ccm::double_t expo			   = support::helpers::narrow_eval(scaled_input + exp_shift_dbl);
+		const std::uint64_t expo_int64 = support::double_to_uint64(expo);
+		expo -= exp_shift_dbl;
+
+		const ccm::double_t rem = x + expo * exp_negLn2HiN_dbl + expo * exp_negLn2LoN_dbl;
+
+		// 2^(expo/N) ~= scale * (1 + tail).
+		const std::uint64_t index = 2 * (expo_int64 % k_exp_table_n_dbl);
+		const std::uint64_t top	  = expo_int64 << (52 - k_exp_table_bits_dbl);
+		const ccm::double_t tail  = support::uint64_to_double(exp_tab_dbl[index]);
+		const ccm::double_t scale = support::uint64_to_double(exp_tab_dbl[index + 1] + top);
+
+		const ccm::double_t rem_sqr	= rem * rem;
+		const ccm::double_t tmp		= tail + rem + rem_sqr * (exp_fast_poly_dbl[0] + rem * exp_fast_poly_dbl[1]) + rem_sqr * rem_sqr * exp_fast_poly_dbl[2];
+		return scale + scale * tmp;
+	}
+} // namespace ccm::internal::impl
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/types/fp_types.hpp"
+#include "ccmath/math/expo/impl/log_double_impl.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	// log1p(r) - r for |r| < 2^-9: Taylor terms through r^7, truncation error below 2^-63 relative.
+	constexpr std::array<double, 6> log_fast_near1_poly_dbl = { -0x1p-1, 0x1.5555555555555p-2, -0x1p-2, 0x1.999999999999ap-3, -0x1.5555555555555p-3, 0x1.2492492492492p-3 };
+
+	/**
+	 * @brief The table path of log_double_impl, with a degree-7 polynomial on a narrower window around 1
+	 * in place of its degree-12 one.
+	 * @pre x is positive, normal and finite.
+	 */
+	constexpr double log_fast_double_impl(double x)
+	{
+		const std::uint64_t int_x = ccm::support::double_to_uint64(x);
+
+		// The table path cancels badly once log(x) drops below ~2^-9, so that window gets a short Taylor series on the exact x - 1.
+		constexpr std::uint64_t low	 = ccm::support::double_to_uint64(1.0 - 0x1p-9);
+		constexpr std::uint64_t high = ccm::support::double_to_uint64(1.0 + 0x1p-9);
+		if (int_x - low < high - low)
+		{
+			const ccm::double_t rem		= x - 1.0;
+			const ccm::double_t rem_sqr = rem * rem;
+			const ccm::double_t poly	= log_fast_near1_poly_dbl[0] + rem * log_fast_near1_poly_dbl[1] +
+									   rem_sqr * (log_fast_near1_poly_dbl[2] + rem * log_fast_near1_poly_dbl[3] +
+												  rem_sqr * (log_fast_near1_poly_dbl[4] + rem * log_fast_near1_poly_dbl[5]));
+			return rem + rem_sqr * poly;
+		}
+
+		// x = 2^expo * norm_val with norm_val in [0x3fe6000000000000, 2 * 0x3fe6000000000000).
+		const std::uint64_t tmp = int_x - k_logTableOff_dbl;
+		// NOLINTBEGIN
+		const std::int64_t i	= (tmp >> (52 - ccm::internal::k_logTableBitsDbl)) % k_logTableN_dbl;
+		const std::int64_t expo = static_cast<std::int64_t>(tmp) >> 52;
+		// NOLINTEND
+		const auto index				 = static_cast<unsigned long>(i);
+		const ccm::double_t inverse		 = log_tab_values_dbl[index].invc;
+		const ccm::double_t log_c		 = log_tab_values_dbl[index].logc;
+		const ccm::double_t norm_val	 = support::uint64_to_double(int_x - (tmp & 0xfffULL << 52));
+		const ccm::double_t scale_factor = static_cast<ccm::double_t>(expo);
+
+		// log(x) = log1p(norm_val/c - 1) + log(c) + expo*Ln2, with |rem| < 1/(2*N).
+		const ccm::double_t rem = (norm_val - log_tab2_values_dbl[index].chi - log_tab2_values_dbl[index].clo) * inverse;
+
+		const ccm::double_t workspace = scale_factor * log_ln2hi_value_dbl + log_c;
+		const ccm::double_t high_part = workspace + rem;
+		const ccm::double_t low_part  = workspace - high_part + rem + scale_factor * log_ln2lo_value_dbl;
+
+		const ccm::double_t rem_sqr = rem * rem;
+		return low_part + rem_sqr * log_poly_values_dbl[0] +
+			   rem * rem_sqr * (log_poly_values_dbl[1] + rem * log_poly_values_dbl[2] + rem_sqr * (log_poly_values_dbl[3] + rem * log_poly_values_dbl[4])) +
+			   high_part;
+	}
+} // namespace ccm::internal::impl
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/helpers/exp_helpers.hpp"
+#include "ccmath/internal/support/multiply_add.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+#include "ccmath/math/trig/impl/sincos_double_data.hpp"
+#include "ccmath/math/trig/impl/sincos_double_impl.hpp"
+
+#include <array>
+
+namespace ccm::internal::impl
+{
+	// sin(y) ~= y + y^3 P(y^2) on |y| <= pi/16, one term fewer than SIN_POLY.
+	// Chebyshev fit; the relative error is below 1.8e-17.
+	constexpr std::array<double, 4> sin_fast_poly_dbl = { -0x1.5555555555546p-3, 0x1.11111110de94fp-7, -0x1.a019fb3b2b93bp-13, 0x1.719be0e9ce221p-19 };
+
+	// sincos_range_reduction_small with the branch-free shift rounding of exp_double_impl in place of
+	// nearest_integer, whose sign test mispredicts on mixed-sign inputs. Valid for |x| < 2^20.
+	constexpr unsigned sincos_fast_reduce(double x, double & y)
+	{
+		namespace data = sincos_double_data;
+
+		const double k = support::helpers::narrow_eval(x * data::ONE_OVER_PI + 0x1.8p52) - 0x1.8p52;
+		y			   = support::multiply_add(k, data::MPI[0], x);
+		y			   = support::multiply_add(k, data::MPI[1], y);
+		y			   = support::multiply_add(k, data::MPI[2], y);
+		return static_cast<unsigned>(static_cast<int>(k));
+	}
+
+	/**
+	 * @brief sin or cos through the small-argument reduction of sincos_double_impl with a shorter sine polynomial.
+	 * @pre 2^-26 <= |x| < 2^16. The reduction is exact to 2^20, but past 2^16 its ~119 bits of pi/8 no
+	 * longer keep angles next to a multiple of pi/2 within a few ULP.
+	 * @note The cosine polynomial stays at the five terms of COS_POLY: a four-term fit is only good to
+	 * ~1.9e-16 on the reduced interval, which would cost 2 ULP in the final result.
+	 */
+	template <bool IsSin>
+	constexpr double sincos_fast_double_impl(double x)
+	{
+		namespace data = sincos_double_data;
+
+		double y{};
+		const unsigned k = sincos_fast_reduce(x, y);
+
+		const double sin_k = data::SIN_K_PI_OVER_8[k & 15];
+		const double cos_k = data::SIN_K_PI_OVER_8[(k + 4) & 15];
+
+		const double y_sq = y * y;
+		double sp		  = support::multiply_add(y_sq, sin_fast_poly_dbl[3], sin_fast_poly_dbl[2]);
+		double cp		  = support::multiply_add(y_sq, data::COS_POLY[5], data::COS_POLY[4]);
+		sp				  = support::multiply_add(y_sq, sp, sin_fast_poly_dbl[1]);
+		cp				  = support::multiply_add(y_sq, cp, data::COS_POLY[3]);
+		sp				  = support::multiply_add(y_sq, sp, sin_fast_poly_dbl[0]);
+		cp				  = support::multiply_add(y_sq, cp, data::COS_POLY[2]);
+		cp				  = support::multiply_add(y_sq, cp, data::COS_POLY[1]);
+		const double s1	  = support::multiply_add(y_sq * y, sp, y);
+		const double c1	  = support::multiply_add(y_sq, cp, 1.0);
+
+		if constexpr (IsSin) { return support::multiply_add(cos_k, s1, sin_k * c1); }
+		else
+		{
+			return support::multiply_add(cos_k, c1, -sin_k * s1);
+		}
+	}
+
+	/**
+	 * @brief sinf or cosf through the double reduction above and three-term polynomials evaluated in double.
+	 * @pre 2^-26 <= |x| < 2^20.
+	 * @note The truncated sine and cosine polynomials are good to ~2^-39 on |y| <= pi/16, well past float
+	 * precision. The float reduction of sincos_float_impl is avoided since it is only exact with a
+	 * hardware FMA.
+	 */
+	template <bool IsSin>
+	constexpr float sincos_fast_float_impl(float x)
+	{
+		namespace data = sincos_double_data;
+
+		double y{};
+		const unsigned k = sincos_fast_reduce(static_cast<double>(x), y);
+
+		const double sin_k = data::SIN_K_PI_OVER_8[k & 15];
+		const double cos_k = data::SIN_K_PI_OVER_8[(k + 4) & 15];
+
+		const double y_sq = y * y;
+		const double s1	  = support::multiply_add(y_sq * y, support::polyeval(y_sq, sin_fast_poly_dbl[0], sin_fast_poly_dbl[1], sin_fast_poly_dbl[2]), y);
+		const double c1	  = support::multiply_add(y_sq, support::polyeval(y_sq, data::COS_POLY[1], data::COS_POLY[2], data::COS_POLY[3]), 1.0);
+
+		if constexpr (IsSin) { return static_cast<float>(support::multiply_add(cos_k, s1, sin_k * c1)); }
+		else
+		{
+			return static_cast<float>(support::multiply_add(cos_k, c1, -sin_k * s1));
+		}
+	}
+} // namespace ccm::internal::impl
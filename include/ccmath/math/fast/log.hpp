@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/math/expo/impl/log_float_impl.hpp"
+#include "ccmath/math/expo/log.hpp"
+#include "ccmath/math/fast/impl/log_fast_impl.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace ccm::fast
+{
+	/**
+	 * @brief Computes the natural logarithm without the separate near-1 path of ccm::log.
+	 * @tparam T floating-point type. long double is evaluated in double precision.
+	 * @param num floating-point value
+	 * @return ln(num), within 1 ULP for double and 1 ULP for float.
+	 * @note Zero, negative, subnormal, infinite and NaN arguments are handed to ccm::log, so they get its
+	 * results and errno/fenv behavior. Every other argument leaves errno alone and raises at most
+	 * FE_INEXACT.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T log(T num)
+	{
+		if constexpr (std::is_same_v<T, float>)
+		{
+			const std::uint32_t bits = support::float_to_uint32(num);
+			if (CCM_UNLIKELY(bits - 0x0080'0000U >= 0x7f80'0000U - 0x0080'0000U)) { return ccm::log(num); }
+			return internal::impl::log_float_impl(num);
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			if (CCM_UNLIKELY(support::top16_bits_of_double(num) - 0x0010U >= 0x7ff0U - 0x0010U)) { return ccm::log(num); }
+			return internal::impl::log_fast_double_impl(num);
+		}
+		else
+		{
+			return static_cast<T>(ccm::fast::log(static_cast<double>(num)));
+		}
+	}
+} // namespace ccm::fast
@@ -15,4 +15,5 @@
 #include "hyper/atanh.hpp"
 #include "hyper/cosh.hpp"
 #include "hyper/sinh.hpp"
+#include "hyper/sinhcosh.hpp"
 #include "hyper/tanh.hpp"
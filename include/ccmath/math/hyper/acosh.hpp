@@ -10,7 +10,59 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/builtins/hyper/acosh.hpp"
+#include "ccmath/internal/math/generic/func/hyper/acosh_gen.hpp"
+#include "ccmath/internal/math/runtime/func/hyper/acosh_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the inverse hyperbolic cosine of a floating-point value.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point value.
+	 * @return Inverse hyperbolic cosine of num.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/acosh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T acosh(T num) noexcept
+	{
+		if constexpr (ccm::builtin::has_constexpr_acosh<T>) { return ccm::builtin::acosh_ct(num); }
+		else
+		{
+			if (ccm::support::is_constant_evaluated()) { return ccm::gen::acosh_gen<T>(num); }
+			return ccm::rt::acosh_rt<T>(num);
+		}
+	}
+
+	/**
+	 * @brief Computes the inverse hyperbolic cosine of an integer value after promotion to double.
+	 * @tparam Integer Integral type.
+	 * @param num Integer value.
+	 * @return Inverse hyperbolic cosine of num as double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/acosh
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double acosh(Integer num) noexcept
+	{ return ccm::acosh<double>(static_cast<double>(num)); }
+
+	/**
+	 * @brief Computes the inverse hyperbolic cosine of a float.
+	 * @param num Floating-point value.
+	 * @return Inverse hyperbolic cosine of num as float.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/acosh
+	 */
+	constexpr float acoshf(float num) noexcept
+	{ return ccm::acosh<float>(num); }
 
+	/**
+	 * @brief Computes the inverse hyperbolic cosine of a long double.
+	 * @param num Floating-point value.
+	 * @return Inverse hyperbolic cosine of num as long double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/acosh
+	 */
+	constexpr long double acoshl(long double num) noexcept
+	{ return ccm::acosh<long double>(num); }
 } // namespace ccm
@@ -10,7 +10,59 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/builtins/hyper/asinh.hpp"
+#include "ccmath/internal/math/generic/func/hyper/asinh_gen.hpp"
+#include "ccmath/internal/math/runtime/func/hyper/asinh_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the inverse hyperbolic sine of a floating-point value.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point value.
+	 * @return Inverse hyperbolic sine of num.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/asinh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T asinh(T num) noexcept
+	{
+		if constexpr (ccm::builtin::has_constexpr_asinh<T>) { return ccm::builtin::asinh_ct(num); }
+		else
+		{
+			if (ccm::support::is_constant_evaluated()) { return ccm::gen::asinh_gen<T>(num); }
+			return ccm::rt::asinh_rt<T>(num);
+		}
+	}
+
+	/**
+	 * @brief Computes the inverse hyperbolic sine of an integer value after promotion to double.
+	 * @tparam Integer Integral type.
+	 * @param num Integer value.
+	 * @return Inverse hyperbolic sine of num as double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/asinh
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double asinh(Integer num) noexcept
+	{ return ccm::asinh<double>(static_cast<double>(num)); }
+
+	/**
+	 * @brief Computes the inverse hyperbolic sine of a float.
+	 * @param num Floating-point value.
+	 * @return Inverse hyperbolic sine of num as float.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/asinh
+	 */
+	constexpr float asinhf(float num) noexcept
+	{ return ccm::asinh<float>(num); }
 
+	/**
+	 * @brief Computes the inverse hyperbolic sine of a long double.
+	 * @param num Floating-point value.
+	 * @return Inverse hyperbolic sine of num as long double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/asinh
+	 */
+	constexpr long double asinhl(long double num) noexcept
+	{ return ccm::asinh<long double>(num); }
 } // namespace ccm
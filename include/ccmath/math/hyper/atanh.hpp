@@ -10,7 +10,59 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/builtins/hyper/atanh.hpp"
+#include "ccmath/internal/math/generic/func/hyper/atanh_gen.hpp"
+#include "ccmath/internal/math/runtime/func/hyper/atanh_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the inverse hyperbolic tangent of a floating-point value.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point value.
+	 * @return Inverse hyperbolic tangent of num.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/atanh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T atanh(T num) noexcept
+	{
+		if constexpr (ccm::builtin::has_constexpr_atanh<T>) { return ccm::builtin::atanh_ct(num); }
+		else
+		{
+			if (ccm::support::is_constant_evaluated()) { return ccm::gen::atanh_gen<T>(num); }
+			return ccm::rt::atanh_rt<T>(num);
+		}
+	}
+
+	/**
+	 * @brief Computes the inverse hyperbolic tangent of an integer value after promotion to double.
+	 * @tparam Integer Integral type.
+	 * @param num Integer value.
+	 * @return Inverse hyperbolic tangent of num as double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/atanh
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double atanh(Integer num) noexcept
+	{ return ccm::atanh<double>(static_cast<double>(num)); }
+
+	/**
+	 * @brief Computes the inverse hyperbolic tangent of a float.
+	 * @param num Floating-point value.
+	 * @return Inverse hyperbolic tangent of num as float.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/atanh
+	 */
+	constexpr float atanhf(float num) noexcept
+	{ return ccm::atanh<float>(num); }
 
+	/**
+	 * @brief Computes the inverse hyperbolic tangent of a long double.
+	 * @param num Floating-point value.
+	 * @return Inverse hyperbolic tangent of num as long double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/atanh
+	 */
+	constexpr long double atanhl(long double num) noexcept
+	{ return ccm::atanh<long double>(num); }
 } // namespace ccm
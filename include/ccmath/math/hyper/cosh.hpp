@@ -10,7 +10,59 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/builtins/hyper/cosh.hpp"
+#include "ccmath/internal/math/generic/func/hyper/cosh_gen.hpp"
+#include "ccmath/internal/math/runtime/func/hyper/cosh_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the hyperbolic cosine of a floating-point value.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point value.
+	 * @return Hyperbolic cosine of num.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/cosh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T cosh(T num) noexcept
+	{
+		if constexpr (ccm::builtin::has_constexpr_cosh<T>) { return ccm::builtin::cosh_ct(num); }
+		else
+		{
+			if (ccm::support::is_constant_evaluated()) { return ccm::gen::cosh_gen<T>(num); }
+			return ccm::rt::cosh_rt<T>(num);
+		}
+	}
+
+	/**
+	 * @brief Computes the hyperbolic cosine of an integer value after promotion to double.
+	 * @tparam Integer Integral type.
+	 * @param num Integer value.
+	 * @return Hyperbolic cosine of num as double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/cosh
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double cosh(Integer num) noexcept
+	{ return ccm::cosh<double>(static_cast<double>(num)); }
+
+	/**
+	 * @brief Computes the hyperbolic cosine of a float.
+	 * @param num Floating-point value.
+	 * @return Hyperbolic cosine of num as float.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/cosh
+	 */
+	constexpr float coshf(float num) noexcept
+	{ return ccm::cosh<float>(num); }
 
+	/**
+	 * @brief Computes the hyperbolic cosine of a long double.
+	 * @param num Floating-point value.
+	 * @return Hyperbolic cosine of num as long double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/cosh
+	 */
+	constexpr long double coshl(long double num) noexcept
+	{ return ccm::cosh<long double>(num); }
 } // namespace ccm
@@ -10,7 +10,59 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/builtins/hyper/sinh.hpp"
+#include "ccmath/internal/math/generic/func/hyper/sinh_gen.hpp"
+#include "ccmath/internal/math/runtime/func/hyper/sinh_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the hyperbolic sine of a floating-point value.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point value.
+	 * @return Hyperbolic sine of num.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/sinh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T sinh(T num) noexcept
+	{
+		if constexpr (ccm::builtin::has_constexpr_sinh<T>) { return ccm::builtin::sinh_ct(num); }
+		else
+		{
+			if (ccm::support::is_constant_evaluated()) { return ccm::gen::sinh_gen<T>(num); }
+			return ccm::rt::sinh_rt<T>(num);
+		}
+	}
+
+	/**
+	 * @brief Computes the hyperbolic sine of an integer value after promotion to double.
+	 * @tparam Integer Integral type.
+	 * @param num Integer value.
+	 * @return Hyperbolic sine of num as double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/sinh
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double sinh(Integer num) noexcept
+	{ return ccm::sinh<double>(static_cast<double>(num)); }
+
+	/**
+	 * @brief Computes the hyperbolic sine of a float.
+	 * @param num Floating-point value.
+	 * @return Hyperbolic sine of num as float.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/sinh
+	 */
+	constexpr float sinhf(float num) noexcept
+	{ return ccm::sinh<float>(num); }
 
+	/**
+	 * @brief Computes the hyperbolic sine of a long double.
+	 * @param num Floating-point value.
+	 * @return Hyperbolic sine of num as long double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/sinh
+	 */
+	constexpr long double sinhl(long double num) noexcept
+	{ return ccm::sinh<long double>(num); }
 } // namespace ccm
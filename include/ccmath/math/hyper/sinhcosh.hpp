@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/builtins/hyper/cosh.hpp"
+#include "ccmath/internal/math/generic/builtins/hyper/sinh.hpp"
+#include "ccmath/internal/math/generic/func/hyper/sinhcosh_gen.hpp"
+#include "ccmath/internal/math/runtime/func/hyper/sinhcosh_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+#include "ccmath/math/hyper/cosh.hpp"
+#include "ccmath/math/hyper/sinh.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace ccm
+{
+	/**
+	 * @brief Computes the hyperbolic sine and cosine of a value with a single exponential.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point value.
+	 * @param sinh_out Receives the hyperbolic sine of num, identical to ccm::sinh(num).
+	 * @param cosh_out Receives the hyperbolic cosine of num, identical to ccm::cosh(num).
+	 * @note This is a ccmath extension; neither the C library nor the C++ standard has it.
+	 */
+	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
+	constexpr void sinhcosh(T num, T * sinh_out, T * cosh_out)
+	{
+		// With constexpr builtins ccm::sinh and ccm::cosh do not reach the generic kernel, so there
+		// is no shared exp to reuse.
+		if constexpr (ccm::builtin::has_constexpr_sinh<T> || ccm::builtin::has_constexpr_cosh<T>)
+		{
+			*sinh_out = ccm::sinh(num);
+			*cosh_out = ccm::cosh(num);
+		}
+		else
+		{
+			if (ccm::support::is_constant_evaluated())
+			{
+				ccm::gen::sinhcosh_gen(num, *sinh_out, *cosh_out);
+				return;
+			}
+			ccm::rt::sinhcosh_rt(num, *sinh_out, *cosh_out);
+		}
+	}
+
+	/**
+	 * @brief Computes the hyperbolic sine and cosine of an integer value after promotion to double.
+	 * @tparam Integer Integral type.
+	 * @param num Integer value.
+	 * @param sinh_out Receives the hyperbolic sine of num.
+	 * @param cosh_out Receives the hyperbolic cosine of num.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr void sinhcosh(Integer num, double * sinh_out, double * cosh_out)
+	{ ccm::sinhcosh<double>(static_cast<double>(num), sinh_out, cosh_out); }
+
+	/**
+	 * @brief Computes the hyperbolic sine and cosine of a value with a single exponential.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point value.
+	 * @return A pair holding the hyperbolic sine of num in first and the hyperbolic cosine in second.
+	 */
+	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
+	constexpr std::pair<T, T> sinhcosh(T num)
+	{
+		T sinh_out{};
+		T cosh_out{};
+		ccm::sinhcosh<T>(num, &sinh_out, &cosh_out);
+		return { sinh_out, cosh_out };
+	}
+
+	/**
+	 * @brief Computes the hyperbolic sine and cosine of an integer value after promotion to double.
+	 * @tparam Integer Integral type.
+	 * @param num Integer value.
+	 * @return A pair holding the hyperbolic sine of num in first and the hyperbolic cosine in second.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr std::pair<double, double> sinhcosh(Integer num)
+	{ return ccm::sinhcosh<double>(static_cast<double>(num)); }
+} // namespace ccm
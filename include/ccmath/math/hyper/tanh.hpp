@@ -10,7 +10,59 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/builtins/hyper/tanh.hpp"
+#include "ccmath/internal/math/generic/func/hyper/tanh_gen.hpp"
+#include "ccmath/internal/math/runtime/func/hyper/tanh_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the hyperbolic tangent of a floating-point value.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point value.
+	 * @return Hyperbolic tangent of num.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/tanh
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T tanh(T num) noexcept
+	{
+		if constexpr (ccm::builtin::has_constexpr_tanh<T>) { return ccm::builtin::tanh_ct(num); }
+		else
+		{
+			if (ccm::support::is_constant_evaluated()) { return ccm::gen::tanh_gen<T>(num); }
+			return ccm::rt::tanh_rt<T>(num);
+		}
+	}
+
+	/**
+	 * @brief Computes the hyperbolic tangent of an integer value after promotion to double.
+	 * @tparam Integer Integral type.
+	 * @param num Integer value.
+	 * @return Hyperbolic tangent of num as double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/tanh
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double tanh(Integer num) noexcept
+	{ return ccm::tanh<double>(static_cast<double>(num)); }
+
+	/**
+	 * @brief Computes the hyperbolic tangent of a float.
+	 * @param num Floating-point value.
+	 * @return Hyperbolic tangent of num as float.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/tanh
+	 */
+	constexpr float tanhf(float num) noexcept
+	{ return ccm::tanh<float>(num); }
 
+	/**
+	 * @brief Computes the hyperbolic tangent of a long double.
+	 * @param num Floating-point value.
+	 * @return Hyperbolic tangent of num as long double.
+	 * @see https://en.cppreference.com/w/cpp/numeric/math/tanh
+	 */
+	constexpr long double tanhl(long double num) noexcept
+	{ return ccm::tanh<long double>(num); }
 } // namespace ccm
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/fenv/fenv_support.hpp"
+#include "ccmath/internal/support/fenv/rounding_mode.hpp"
+
+#include <cfenv>
+
+namespace ccm
+{
+	/**
+	 * @brief Scope in which the calling thread promises to stay in round-to-nearest.
+	 *
+	 * The runtime paths of ccmath (ccm::rt, ccm::batch and every function that reaches them) read the
+	 * floating-point rounding mode on each call so they can fall back to a generic kernel under a
+	 * directed mode. Inside this scope they read a thread-local copy instead of calling fegetround,
+	 * which removes a libc call from every evaluation.
+	 *
+	 * @pre The calling thread is in FE_TONEAREST when the scope starts, and for as long as it lasts the
+	 * rounding mode is only changed through ccmath's own fenv wrappers, which keep the copy current.
+	 * Changing it with std::fesetround inside the scope makes ccmath use the wrong kernel.
+	 *
+	 * @note Scopes nest; each one restores what the thread recorded before it. Only the thread that
+	 * opened a scope is affected, and ccmath behaves exactly as before outside of every scope.
+	 */
+	class assume_round_to_nearest
+	{
+	public:
+		assume_round_to_nearest() noexcept : m_previous(support::fenv::internal::cached_rounding_mode)
+		{ support::fenv::internal::cached_rounding_mode = FE_TONEAREST; }
+
+		~assume_round_to_nearest() noexcept
+		{ support::fenv::internal::cached_rounding_mode = m_previous; }
+
+		assume_round_to_nearest(assume_round_to_nearest const &)			 = delete;
+		assume_round_to_nearest & operator=(assume_round_to_nearest const &) = delete;
+
+	private:
+		int m_previous;
+	};
+} // namespace ccm
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/path_stats.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ccm::path_stats
+{
+	using path = support::path_stats::path;
+
+	/// Number of named kernel paths.
+	inline constexpr std::size_t path_count = support::path_stats::path_count;
+
+	/**
+	 * @brief True when the build counts kernel path hits.
+	 *
+	 * Counting is compiled in by defining CCM_CONFIG_ENABLE_PATH_STATS (the CCMATH_ENABLE_PATH_STATS
+	 * CMake option). Without it every counter reads zero and the kernels carry no instrumentation.
+	 */
+	inline constexpr bool enabled = support::path_stats::enabled;
+
+	/// Hit counts of every path at one point in time, indexed by path.
+	struct snapshot_type
+	{
+		std::array<std::uint64_t, path_count> hits{};
+
+		[[nodiscard]] constexpr std::uint64_t operator[](path p) const noexcept { return hits[static_cast<std::size_t>(p)]; }
+	};
+
+	/**
+	 * @brief The stable label of a path, such as "pow.double_double".
+	 *
+	 * These are the keys tools/asmlab/registry/path_categories.json uses to label the counters.
+	 */
+	[[nodiscard]] constexpr const char * name(path p) noexcept
+	{ return support::path_stats::path_names[static_cast<std::size_t>(p)]; }
+
+	/**
+	 * @brief Reads every counter.
+	 *
+	 * The counters are shared by all threads and updated with relaxed atomics, so a snapshot taken
+	 * while other threads evaluate kernels is a consistent count per path but not across paths.
+	 * Scalar paths count calls. Paths named lane_* count vector lanes, and a lane that falls back
+	 * to the scalar kernel is also counted on the scalar path it takes. Only the kernels named by
+	 * path are instrumented; a call that ccm::rt resolves through a builtin or libm counts nothing.
+	 */
+	[[nodiscard]] inline snapshot_type snapshot() noexcept
+	{
+		snapshot_type out{};
+#if defined(CCMATH_PATH_STATS_ACTIVE)
+		for (std::size_t i = 0; i < path_count; ++i) { out.hits[i] = support::path_stats::internal::counters[i].hits.load(std::memory_order_relaxed); }
+#endif
+		return out;
+	}
+
+	/// Sets every counter back to zero.
+	inline void reset() noexcept
+	{
+#if defined(CCMATH_PATH_STATS_ACTIVE)
+		for (auto & c : support::path_stats::internal::counters) { c.hits.store(0, std::memory_order_relaxed); }
+#endif
+	}
+} // namespace ccm::path_stats
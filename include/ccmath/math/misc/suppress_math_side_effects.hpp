@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/fenv/fenv_support.hpp"
+
+namespace ccm
+{
+	/**
+	 * @brief Scope in which ccmath neither writes errno nor raises floating-point exceptions.
+	 *
+	 * ccmath reports domain, pole and range errors through errno and the floating-point exception
+	 * flags, as math_errhandling describes. Inside this scope every runtime evaluation on the calling
+	 * thread (ccm::rt, ccm::batch and every function that reaches them) skips those writes and returns
+	 * the same values it would otherwise. Flags set by the hardware arithmetic itself are not undone;
+	 * the ccm::batch policy overloads also restore the flags once the call returns.
+	 *
+	 * Suppression is a run-time check, not a compile-time one. Each errno write or exception raise a
+	 * kernel would make first loads the thread's side-effect mode and branches on it, inside a scope
+	 * or not. Arguments that report nothing never reach that check. Arguments that do report still
+	 * pay for it: ccm::log over negative arguments measured about 2-4 ns per call slower in this
+	 * scope than with the side effects compiled out. Removing them at compile time is a build-wide
+	 * setting, not a per-call or per-file one: the CCMATH_DISABLE_ERRNO option defines
+	 * CCM_CONFIG_DISABLE_ERRNO for every target that links ccmath. Defining the macro in only some
+	 * translation units gives ccmath's inline functions different definitions in each, which the
+	 * one-definition rule forbids.
+	 *
+	 * @note Scopes nest; each one restores what the thread had before it. Only the thread that opened
+	 * a scope is affected, and ccmath behaves exactly as before outside of every scope.
+	 */
+	class suppress_math_side_effects
+	{
+	public:
+		suppress_math_side_effects() noexcept = default;
+
+		suppress_math_side_effects(suppress_math_side_effects const &)			   = delete;
+		suppress_math_side_effects & operator=(suppress_math_side_effects const &) = delete;
+
+	private:
+		support::fenv::internal::side_effect_scope m_scope{ support::fenv::internal::side_effect_mode::eDiscard };
+	};
+} // namespace ccm
@@ -44,17 +44,23 @@ namespace ccm
 	 * @param x First value.
 	 * @param y Second value.
 	 * @param z Third value.
-	 * @return sqrt(x*x + y*y + z*z) computed with the same scaling behavior as the 2-argument overload.
+	 * @return sqrt(x*x + y*y + z*z), with the inputs scaled once rather than once per pair.
 	 * @see https://en.cppreference.com/w/cpp/numeric/math/hypot
 	 */
-	constexpr float hypot(float x, float y, float z) noexcept
-	{ return ccm::hypot(ccm::hypot(x, y), z); }
-
-	constexpr double hypot(double x, double y, double z) noexcept
-	{ return ccm::hypot(ccm::hypot(x, y), z); }
-
-	constexpr long double hypot(long double x, long double y, long double z) noexcept
-	{ return ccm::hypot(ccm::hypot(x, y), z); }
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hypot(T x, T y, T z) noexcept
+	{
+		if (ccm::support::is_constant_evaluated())
+		{
+			// As in hypot_rt: the generic kernel works in double, so long double chains the builtin.
+			if constexpr (!std::is_same_v<T, float> && !std::is_same_v<T, double> && ccm::builtin::has_constexpr_hypot<T>)
+			{
+				return ccm::builtin::hypot_ct(ccm::builtin::hypot_ct(x, y), z);
+			}
+			else { return ccm::gen::hypot_gen<T>(x, y, z); }
+		}
+		return ccm::rt::hypot_rt<T>(x, y, z);
+	}
 
 	template <typename Arithmetic1,
 			  typename Arithmetic2,
@@ -16,4 +16,5 @@
 #include "trig/atan2.hpp"
 #include "trig/cos.hpp"
 #include "trig/sin.hpp"
+#include "trig/sincos.hpp"
 #include "trig/tan.hpp"
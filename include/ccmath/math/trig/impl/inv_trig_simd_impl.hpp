@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized asin, acos, atan and atan2. The branches of inv_trig_impl become
+// lane masks: every lane evaluates the candidate paths its vector needs, each
+// replaying the scalar operations in the same order with multiply_add fused
+// where support::multiply_add fuses, and simd_select keeps the one the scalar
+// kernel would have taken, so every lane is bit identical to the scalar kernel.
+// Where two paths need asin_eval the argument is selected first so the
+// polynomial runs once. Float asin (|x| <= 0.5) and float atan evaluate in
+// double lanes as the scalar kernel does; when the ABI has no double vector of
+// the same width those lanes fall back to the scalar kernel. Lanes that raise
+// domain errors or carry NaN or infinite inputs are recomputed with the scalar
+// kernel for its errno and fenv side effects.
+
+#include "ccmath/internal/math/runtime/pp/conversion.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/simd_cat.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/math/numbers.hpp"
+#include "ccmath/math/trig/impl/inv_trig_data.hpp"
+#include "ccmath/math/trig/impl/inv_trig_impl.hpp"
+#include "ccmath/math/trig/impl/sincos_simd_impl.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::internal::impl
+{
+	namespace inv_trig_simd_detail
+	{
+		using sincos_simd_detail::multiply_add;
+
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> lane_sqrt(pp::basic_simd<T, Abi> const & x) noexcept
+		{ return pp::basic_simd<T, Abi>::from_member(pp::SimdTraits<T, Abi>::op_sqrt(x.get())); }
+
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> lane_abs(pp::basic_simd<T, Abi> const & x) noexcept
+		{ return pp::basic_simd<T, Abi>::from_member(pp::SimdTraits<T, Abi>::op_fabs(x.get())); }
+
+		// Lane form of inv_trig_detail::asin_eval.
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> asin_eval(pp::basic_simd<T, Abi> const & xsq) noexcept
+		{
+			using namespace inv_trig_data;
+			using V = pp::basic_simd<T, Abi>;
+
+			const V x4 = xsq * xsq;
+			const V c0 = multiply_add(xsq, V(static_cast<T>(k_asin_coeffs[1])), V(static_cast<T>(k_asin_coeffs[0])));
+			const V c1 = multiply_add(xsq, V(static_cast<T>(k_asin_coeffs[3])), V(static_cast<T>(k_asin_coeffs[2])));
+			const V c2 = multiply_add(xsq, V(static_cast<T>(k_asin_coeffs[5])), V(static_cast<T>(k_asin_coeffs[4])));
+			const V c3 = multiply_add(xsq, V(static_cast<T>(k_asin_coeffs[7])), V(static_cast<T>(k_asin_coeffs[6])));
+			const V c4 = multiply_add(xsq, V(static_cast<T>(k_asin_coeffs[9])), V(static_cast<T>(k_asin_coeffs[8])));
+			const V c5 = multiply_add(xsq, V(static_cast<T>(k_asin_coeffs[11])), V(static_cast<T>(k_asin_coeffs[10])));
+			const V x8 = x4 * x4;
+			const V d0 = multiply_add(x4, c1, c0);
+			const V d1 = multiply_add(x4, c3, c2);
+			const V d2 = multiply_add(x4, c5, c4);
+			return multiply_add(x8, multiply_add(x8, d2, d1), d0);
+		}
+
+		// Lane form of inv_trig_detail::acos_kernel for finite |x| < 1. Both bands share one
+		// asin_eval on the selected argument.
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> acos_kernel(pp::basic_simd<T, Abi> const & x) noexcept
+		{
+			using namespace inv_trig_data;
+			using V = pp::basic_simd<T, Abi>;
+
+			const V pi_over_2(static_cast<T>(k_pi_over_2));
+			const V ax		 = lane_abs(x);
+			const auto small = ax <= V(static_cast<T>(0.5));
+
+			const V xsq = x * x;
+			const V u	= multiply_add(V(static_cast<T>(-0.5)), ax, V(static_cast<T>(0.5)));
+			const V r	= asin_eval(pp::simd_select(small, xsq, u));
+
+			const V tiny_res  = pi_over_2 + multiply_add(V(static_cast<T>(-0x1.5555555555555p-3)) * x, xsq, -x);
+			const V small_res = multiply_add(-(x * xsq), r, pi_over_2 - x);
+
+			const V cv		  = V(static_cast<T>(2)) * lane_sqrt(u);
+			const V large_abs = multiply_add(cv * u, r, cv);
+			const V large_res = pp::simd_select(x < V(static_cast<T>(0)), V(static_cast<T>(k_pi)) - large_abs, large_abs);
+
+			return pp::simd_select(small, pp::simd_select(ax < V(static_cast<T>(0x1.0p-10)), tiny_res, small_res), large_res);
+		}
+
+		// Lane form of inv_trig_detail::asin_small_impl for |x| <= 0.5, evaluated in the lane type.
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> asin_small_same(pp::basic_simd<T, Abi> const & x) noexcept
+		{
+			using V = pp::basic_simd<T, Abi>;
+
+			const V xsq		= x * x;
+			const V r		= asin_eval(xsq);
+			const V poly	= x + x * xsq * r;
+			const V tiny	= x + x * x * x * V(static_cast<T>(0x1.5555555555555p-3));
+			return pp::simd_select(lane_abs(x) < V(static_cast<T>(0x1.0p-14)), tiny, poly);
+		}
+
+		// asin_small_impl for |x| <= 0.5 in the lane type: float rounds a double evaluation once.
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> asin_small(pp::basic_simd<T, Abi> const & x) noexcept
+		{
+			using V = pp::basic_simd<T, Abi>;
+
+			if constexpr (std::is_same_v<T, double>) { return asin_small_same(x); }
+			else if constexpr (Abi::template IsValid<double>::value)
+			{
+				using D = pp::basic_simd<double, Abi>;
+
+				const D dx		 = pp::static_simd_cast<double>(x);
+				const D xsq		 = dx * dx;
+				const V poly	 = pp::static_simd_cast<float>(dx + dx * xsq * asin_eval(xsq));
+				const V tiny	 = x + x * x * x * V(static_cast<T>(0x1.5555555555555p-3));
+				return pp::simd_select(lane_abs(x) < V(0x1.0p-14f), tiny, poly);
+			}
+			else if constexpr (V::size() > 1)
+			{
+				// No double vector of this width, so each half is evaluated on its own.
+				const auto halves = pp::simd_split<pp::basic_simd<T, pp::detail::deduce_t<T, V::size() / 2>>>(x);
+				return pp::simd_cat(asin_small(halves[0]), asin_small(halves[1]));
+			}
+			else
+			{
+				V result;
+				for (int i = 0; i < static_cast<int>(V::size()); ++i) { result[i] = inv_trig_detail::asin_small_impl<T>(x[i]); }
+				return result;
+			}
+		}
+
+		// Lane form of the double atan_impl. NaN, zero and infinite lanes are resolved by select;
+		// the rest run the reciprocal fold, the cubic and the asin(x / sqrt(1 + x^2)) paths with one
+		// asin_eval between the asin_small and acos_kernel bands of the nested asin_impl.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<double, Abi> atan_double(pp::basic_simd<double, Abi> const & x) noexcept
+		{
+			using namespace inv_trig_data;
+			using V = pp::basic_simd<double, Abi>;
+
+			const V pi_over_2 = V(ccm::numbers::pi_v<double> / 2.0);
+			const V zero(0.0);
+			const V one(1.0);
+			const V half(0.5);
+
+			const V ax_in		  = lane_abs(x);
+			const auto neg		  = x < zero;
+			const auto is_inf	  = ax_in == V(std::numeric_limits<double>::infinity());
+			const auto passthru	  = (x != x) | (x == zero);
+			const auto special	  = passthru | is_inf;
+			const V ax			  = pp::simd_select(special, half, ax_in);
+
+			// |x| > 1 folds to pi/2 - atan(1/|x|), which is positive on the inner path.
+			const auto big	 = ax > one;
+			const V a		 = pp::simd_select(big, one / pp::simd_select(big, ax, one), ax);
+			const auto inner_neg = neg & !big;
+
+			const V cubic = a + a * a * a * V(-0x1.5555555555555p-2);
+
+			// asin_impl(+/-a / sqrt(1 + a^2)); the argument stays below 1/sqrt(2), so only the small
+			// band and the large band of acos_kernel are reachable.
+			const V z		   = a / lane_sqrt(one + a * a);
+			const V zs		   = pp::simd_select(inner_neg, -z, z);
+			const auto z_small = z <= half;
+			const V zsq		   = zs * zs;
+			const V u		   = multiply_add(V(-0.5), z, half);
+			const V r		   = asin_eval(pp::simd_select(z_small, zsq, u));
+
+			const V asin_tiny  = zs + zs * zs * zs * V(0x1.5555555555555p-3);
+			const V asin_poly  = zs + zs * zsq * r;
+			const V cv		   = V(2.0) * lane_sqrt(u);
+			const V acos_large = multiply_add(cv * u, r, cv);
+			const V acos_res   = pp::simd_select(inner_neg, V(k_pi) - acos_large, acos_large);
+			const V asin_res   = pp::simd_select(z_small, pp::simd_select(z < V(0x1.0p-14), asin_tiny, asin_poly), pi_over_2 - acos_res);
+
+			const V inner  = pp::simd_select(a < V(0x1.0p-14), pp::simd_select(inner_neg, -cubic, cubic), asin_res);
+			V result	   = pp::simd_select(big, pp::simd_select(neg, -pi_over_2 + inner, pi_over_2 - inner), inner);
+
+			if (pp::any_of(special))
+			{
+				result = pp::simd_select(is_inf, pp::simd_select(neg, -pi_over_2, pi_over_2), result);
+				result = pp::simd_select(passthru, x, result);
+			}
+			return result;
+		}
+
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> atan_lanes(pp::basic_simd<T, Abi> const & x) noexcept
+		{
+			using V = pp::basic_simd<T, Abi>;
+
+			if constexpr (std::is_same_v<T, double>) { return atan_double(x); }
+			else if constexpr (Abi::template IsValid<double>::value) { return pp::static_simd_cast<float>(atan_double(pp::static_simd_cast<double>(x))); }
+			else if constexpr (V::size() > 1)
+			{
+				const auto halves = pp::simd_split<pp::basic_simd<T, pp::detail::deduce_t<T, V::size() / 2>>>(x);
+				return pp::simd_cat(atan_lanes(halves[0]), atan_lanes(halves[1]));
+			}
+			else
+			{
+				V result;
+				for (int i = 0; i < static_cast<int>(V::size()); ++i) { result[i] = atan_impl<T>(x[i]); }
+				return result;
+			}
+		}
+	} // namespace inv_trig_simd_detail
+
+	// acos(x) for a vector of float or double lanes.
+	template <typename T, typename Abi, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> acos_simd_impl(pp::basic_simd<T, Abi> const & x) noexcept
+	{
+		using V = pp::basic_simd<T, Abi>;
+
+		const V one(static_cast<T>(1));
+		const V ax		   = inv_trig_simd_detail::lane_abs(x);
+		const auto outside = !(ax < one);
+
+		V result = inv_trig_simd_detail::acos_kernel(pp::simd_select(outside, V(static_cast<T>(0)), x));
+		if (pp::any_of(outside))
+		{
+			// acos(1) = 0 and acos(-1) = pi; the domain errors and NaNs go through the scalar kernel.
+			const V pi(static_cast<T>(ccm::numbers::pi_v<T>));
+			result = pp::simd_select(x == one, V(static_cast<T>(0)), pp::simd_select(x == -one, pi, result));
+
+			const auto scalar_lanes = outside & !(ax == one);
+			for (int i = 0; i < static_cast<int>(V::size()); ++i)
+			{
+				if (scalar_lanes[i]) { result[i] = acos_impl<T>(x[i]); }
+			}
+		}
+		return result;
+	}
+
+	// asin(x) for a vector of float or double lanes.
+	template <typename T, typename Abi, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> asin_simd_impl(pp::basic_simd<T, Abi> const & x) noexcept
+	{
+		using V = pp::basic_simd<T, Abi>;
+
+		const V zero(static_cast<T>(0));
+		const auto small = inv_trig_simd_detail::lane_abs(x) <= V(static_cast<T>(0.5));
+
+		// Each band runs only when some lane needs it; NaN lanes fail the small test and reach
+		// acos_simd_impl, which returns them unchanged as the scalar kernel does.
+		V result = zero;
+		if (pp::any_of(small)) { result = inv_trig_simd_detail::asin_small(pp::simd_select(small, x, zero)); }
+		if (!pp::all_of(small))
+		{
+			const V pi_over_2 = V(static_cast<T>(ccm::numbers::pi_v<T>) / static_cast<T>(2));
+			result			  = pp::simd_select(small, result, pi_over_2 - acos_simd_impl(pp::simd_select(small, V(static_cast<T>(1)), x)));
+		}
+
+		// asin(+/-0) = +/-0.
+		return pp::simd_select(x == zero, x, result);
+	}
+
+	// atan(x) for a vector of float or double lanes.
+	template <typename T, typename Abi, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> atan_simd_impl(pp::basic_simd<T, Abi> const & x) noexcept
+	{ return inv_trig_simd_detail::atan_lanes(x); }
+
+	// atan2(y, x) for vectors of float or double lanes. Quadrant fixups and x = 0 are selected per
+	// lane; lanes with a NaN or infinite input go through the scalar kernel.
+	template <typename T, typename Abi, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> atan2_simd_impl(pp::basic_simd<T, Abi> const & y, pp::basic_simd<T, Abi> const & x) noexcept
+	{
+		using V	   = pp::basic_simd<T, Abi>;
+		using U	   = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+		using UVec = pp::basic_simd<U, Abi>;
+
+		const V zero(static_cast<T>(0));
+		const V one(static_cast<T>(1));
+		const V inf(std::numeric_limits<T>::infinity());
+		const V pi(static_cast<T>(ccm::numbers::pi_v<T>));
+		const V pi_over_2 = V(static_cast<T>(ccm::numbers::pi_v<T>) / static_cast<T>(2));
+
+		const auto finite	  = (inv_trig_simd_detail::lane_abs(y) < inf) & (inv_trig_simd_detail::lane_abs(x) < inf);
+		const auto non_finite = !finite;
+		const auto x_zero	  = x == zero;
+		const auto skip		  = non_finite | x_zero;
+
+		const V ys	  = pp::simd_select(skip, one, y);
+		const V xs	  = pp::simd_select(skip, one, x);
+		const V angle = inv_trig_simd_detail::atan_lanes(ys / xs);
+		V result	  = pp::simd_select(xs < zero, pp::simd_select(ys >= zero, angle + pi, angle - pi), angle);
+
+		if (pp::any_of(skip))
+		{
+			// x = +/-0: +/-pi/2 off the axis; on it, y for x = +0 and pi with the sign of y for x = -0.
+			const UVec sign_bit(static_cast<U>(U(1) << (sizeof(T) * 8 - 1)));
+			const auto x_signed = (pp::simd_bit_cast<U>(x) & sign_bit) != UVec(0);
+			const auto y_signed = (pp::simd_bit_cast<U>(y) & sign_bit) != UVec(0);
+			const V on_axis		= pp::simd_select(x_signed, pp::simd_select(y_signed, -pi, pi), y);
+			const V zero_res = pp::simd_select(y > zero, pi_over_2, pp::simd_select(y < zero, -pi_over_2, on_axis));
+			result			 = pp::simd_select(x_zero, zero_res, result);
+
+			for (int i = 0; i < static_cast<int>(V::size()); ++i)
+			{
+				if (non_finite[i]) { result[i] = atan2_impl<T>(y[i], x[i]); }
+			}
+		}
+		return result;
+	}
+} // namespace ccm::internal::impl
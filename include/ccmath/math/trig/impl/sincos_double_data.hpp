@@ -49,6 +49,21 @@ namespace ccm::internal::sincos_double_data
 		0x1.0p0, -0x1.0p-1, 0x1.55555555554fp-5, -0x1.6c16c16b84c68p-10, 0x1.a019f88d4441ep-16, -0x1.27a8a5f9090d7p-22,
 	};
 
+	// tan(y)/y on [-pi/16, pi/16] = TAN_POLY[0] + y^2 (TAN_POLY[1] + y^2 (...)); Taylor coefficients
+	// 2^(2n) (2^(2n) - 1) |B_2n| / (2n)! rounded to double (truncation error ~2^-59). tan(y) = y * poly.
+	constexpr std::array<double, 10> TAN_POLY = {
+		0x1.0p0,				// 1
+		0x1.5555555555555p-2,	// 1/3
+		0x1.1111111111111p-3,	// 2/15
+		0x1.ba1ba1ba1ba1cp-5,	// 17/315
+		0x1.664f4882c10fap-6,	// 62/2835
+		0x1.226e355e6c23dp-7,	// 1382/155925
+		0x1.d6d3d0e157de0p-9,	// 21844/6081075
+		0x1.7da36452b75e3p-10,	// 929569/638512875
+		0x1.3558248036744p-11,	// 6404582/10854718875
+		0x1.f57d7734d1664p-13,	// 443861162/1856156927625
+	};
+
 	// Large-|x| reduction is handled by the shared Payne-Hanek path in sincos_payne_hanek.hpp.
 
 } // namespace ccm::internal::sincos_double_data
@@ -18,6 +18,7 @@
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/internal/support/fp/nearest_integer.hpp"
 #include "ccmath/internal/support/multiply_add.hpp"
+#include "ccmath/internal/support/path_stats.hpp"
 #include "ccmath/math/trig/impl/sincos_double_data.hpp"
 #include "ccmath/math/trig/impl/sincos_payne_hanek.hpp"
 
@@ -43,44 +44,9 @@ namespace ccm::internal::impl
 			return static_cast<unsigned>(static_cast<int>(k));
 		}
 
-		template <bool IsSin>
-		constexpr double sincos_eval(double x)
+		// s1 ~ sin(y) and c1 ~ cos(y) for the reduced argument |y| <= pi/16.
+		constexpr void sincos_poly(double y, double & s1, double & c1)
 		{
-			FPBits xbits(x);
-			const std::uint64_t x_abs = ccm::support::bit_cast<std::uint64_t>(x) & 0x7fff'ffff'ffff'ffffULL;
-
-			// sin(+/-0) = +/-0, cos(+/-0) = 1. Returning x preserves the sign of a signed zero,
-			// which the reconstruction below would otherwise flush to +0.
-			if (x_abs == 0) { return IsSin ? x : 1.0; }
-
-			double y{};
-			unsigned k = 0;
-
-			if (x_abs < 0x4130'0000'0000'0000ULL) { k = sincos_range_reduction_small(x, y); }
-			else
-			{
-				if (CCM_UNLIKELY(x_abs >= 0x7ff0'0000'0000'0000ULL))
-				{
-					if (xbits.is_signaling_nan())
-					{
-						support::fenv::raise_except_if_required(FE_INVALID);
-						return FPBits::quiet_nan().get_val();
-					}
-
-					if (x_abs == 0x7ff0'0000'0000'0000ULL)
-					{
-						support::fenv::set_errno_if_required(EDOM);
-						support::fenv::raise_except_if_required(FE_INVALID);
-					}
-					return x + FPBits::quiet_nan().get_val();
-				}
-
-				k = sincos_ph::payne_hanek_reduce(x, y);
-			}
-
-			const double sin_k = data::SIN_K_PI_OVER_8[k & 15];
-			const double cos_k = data::SIN_K_PI_OVER_8[(k + 4) & 15];
-
 			const double y_sq = y * y;
 
 			// sin(y) = y * (1 + y^2 (SIN_POLY[1] + y^2 (...))) and cos(y) = 1 + y^2 (COS_POLY[1] + ...),
@@ -97,8 +63,70 @@ namespace ccm::internal::impl
 			cp		  = support::multiply_add(y_sq, cp, data::COS_POLY[1]);
 
 			const double y3 = y_sq * y;
-			const double c1 = support::multiply_add(y_sq, cp, 1.0);
-			const double s1 = support::multiply_add(y3, sp, y);
+			c1				= support::multiply_add(y_sq, cp, 1.0);
+			s1				= support::multiply_add(y3, sp, y);
+		}
+
+		// Reduces x to y in [-pi/16, pi/16] and returns k, the low bits of the pi/8 multiple.
+		// Returns false without reducing when x is infinite or NaN; result then holds the value
+		// both sin and cos return for x, with the errno and fenv side effects already raised.
+		constexpr bool sincos_reduce(double x, std::uint64_t x_abs, double & y, unsigned & k, double & result)
+		{
+			if (x_abs < 0x4130'0000'0000'0000ULL)
+			{
+				CCM_PATH_HIT(sincos_small_reduction);
+				k = sincos_range_reduction_small(x, y);
+				return true;
+			}
+
+			if (CCM_UNLIKELY(x_abs >= 0x7ff0'0000'0000'0000ULL))
+			{
+				CCM_PATH_HIT(sincos_non_finite);
+				if (FPBits(x).is_signaling_nan())
+				{
+					support::fenv::raise_except_if_required(FE_INVALID);
+					result = FPBits::quiet_nan().get_val();
+					return false;
+				}
+
+				if (x_abs == 0x7ff0'0000'0000'0000ULL)
+				{
+					support::fenv::set_errno_if_required(EDOM);
+					support::fenv::raise_except_if_required(FE_INVALID);
+				}
+				result = x + FPBits::quiet_nan().get_val();
+				return false;
+			}
+
+			CCM_PATH_HIT(sincos_payne_hanek);
+			k = sincos_ph::payne_hanek_reduce(x, y);
+			return true;
+		}
+
+		template <bool IsSin>
+		constexpr double sincos_eval(double x)
+		{
+			const std::uint64_t x_abs = ccm::support::bit_cast<std::uint64_t>(x) & 0x7fff'ffff'ffff'ffffULL;
+
+			// sin(+/-0) = +/-0, cos(+/-0) = 1. Returning x preserves the sign of a signed zero,
+			// which the reconstruction below would otherwise flush to +0.
+			if (x_abs == 0)
+			{
+				CCM_PATH_HIT(sincos_zero);
+				return IsSin ? x : 1.0;
+			}
+
+			double y{};
+			unsigned k = 0;
+			double special{};
+			if (!sincos_reduce(x, x_abs, y, k, special)) { return special; }
+
+			const double sin_k = data::SIN_K_PI_OVER_8[k & 15];
+			const double cos_k = data::SIN_K_PI_OVER_8[(k + 4) & 15];
+
+			double s1{};
+			double c1{};
+			sincos_poly(y, s1, c1);
 
 			// The cos tail is in the else so it is discarded for the sin instantiation rather than
 			// left as unreachable code, which MSVC rejects under /W4 (C4702).
@@ -109,6 +137,39 @@ namespace ccm::internal::impl
 			}
 		}
 
+		// Both results of sincos_eval from one range reduction.
+		constexpr void sincos_eval_both(double x, double & sin_out, double & cos_out)
+		{
+			const std::uint64_t x_abs = ccm::support::bit_cast<std::uint64_t>(x) & 0x7fff'ffff'ffff'ffffULL;
+			if (x_abs == 0)
+			{
+				CCM_PATH_HIT(sincos_zero);
+				sin_out = x;
+				cos_out = 1.0;
+				return;
+			}
+
+			double y{};
+			unsigned k = 0;
+			double special{};
+			if (!sincos_reduce(x, x_abs, y, k, special))
+			{
+				sin_out = special;
+				cos_out = special;
+				return;
+			}
+
+			const double sin_k = data::SIN_K_PI_OVER_8[k & 15];
+			const double cos_k = data::SIN_K_PI_OVER_8[(k + 4) & 15];
+
+			double s1{};
+			double c1{};
+			sincos_poly(y, s1, c1);
+
+			sin_out = support::multiply_add(cos_k, s1, sin_k * c1);
+			cos_out = support::multiply_add(cos_k, c1, -sin_k * s1);
+		}
+
 	} // namespace sincos_double_detail
 
 	constexpr double sin_double_impl(double x)
@@ -117,6 +178,9 @@ namespace ccm::internal::impl
 	constexpr double cos_double_impl(double x)
 	{ return sincos_double_detail::sincos_eval<false>(x); }
 
+	constexpr void sincos_double_impl(double x, double & sin_out, double & cos_out)
+	{ sincos_double_detail::sincos_eval_both(x, sin_out, cos_out); }
+
 } // namespace ccm::internal::impl
 
 namespace ccm::internal
@@ -126,4 +190,7 @@ namespace ccm::internal
 
 	constexpr double cos_double(double num) noexcept
 	{ return impl::cos_double_impl(num); }
+
+	constexpr void sincos_double(double num, double & sin_out, double & cos_out) noexcept
+	{ impl::sincos_double_impl(num, sin_out, cos_out); }
 } // namespace ccm::internal
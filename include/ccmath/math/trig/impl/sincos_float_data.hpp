@@ -28,6 +28,10 @@ namespace ccm::internal::sincos_float_data
 
 	constexpr float ONE_OVER_PI = 0x1.45f306p+1f;
 
+	// tan(y)/y on [-pi/16, pi/16] = TAN_POLY[0] + y^2 (TAN_POLY[1] + y^2 (...)); Taylor coefficients
+	// rounded to float (truncation error ~2^-30). tan(y) = y * poly.
+	constexpr std::array<float, 5> TAN_POLY = { 0x1.0p0f, 0x1.555556p-2f, 0x1.111112p-3f, 0x1.ba1ba2p-5f, 0x1.664f48p-6f };
+
 	// Large-|x| reduction is handled by the shared Payne-Hanek path in sincos_payne_hanek.hpp.
 
 } // namespace ccm::internal::sincos_float_data
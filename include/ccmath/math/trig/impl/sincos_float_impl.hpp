@@ -43,10 +43,55 @@ namespace ccm::internal::impl
 			return static_cast<unsigned>(static_cast<int>(k));
 		}
 
+		// s1 ~ sin(y) and c1 ~ cos(y) for the reduced argument |y| <= pi/16.
+		constexpr void sincosf_poly(float y, float & s1, float & c1)
+		{
+			const float y_sq = y * y;
+			const float p1	 = support::multiply_add(y_sq, 0x1.111112p-7f, -0x1.555556p-3f);
+			const float q1	 = support::multiply_add(y_sq, 0x1.54b8bep-5f, -0x1.ffffc4p-2f);
+			const float y3	 = y_sq * y;
+			c1				 = support::multiply_add(y_sq, q1, 1.0f);
+			s1				 = support::multiply_add(y3, p1, y);
+		}
+
+		// Reduces x to y in [-pi/16, pi/16] and returns k, the low bits of the pi/8 multiple.
+		// Returns false without reducing when x is infinite or NaN; result then holds the value
+		// both sin and cos return for x, with the errno and fenv side effects already raised.
+		constexpr bool sincosf_reduce(float x, std::uint32_t x_abs, float & y, unsigned & k, float & result)
+		{
+			if (x_abs < 0x4880'0000U)
+			{
+				k = sincosf_range_reduction_small(x, y);
+				return true;
+			}
+
+			if (CCM_UNLIKELY(x_abs >= 0x7f80'0000U))
+			{
+				if (FPBits(x).is_signaling_nan())
+				{
+					support::fenv::raise_except_if_required(FE_INVALID);
+					result = FPBits::quiet_nan().get_val();
+					return false;
+				}
+
+				if (x_abs == 0x7f80'0000U)
+				{
+					support::fenv::set_errno_if_required(EDOM);
+					support::fenv::raise_except_if_required(FE_INVALID);
+				}
+				result = x + FPBits::quiet_nan().get_val();
+				return false;
+			}
+
+			double yd = 0.0;
+			k		  = sincos_ph::payne_hanek_reduce(static_cast<double>(x), yd);
+			y		  = static_cast<float>(yd);
+			return true;
+		}
+
 		template <bool IsSin>
 		constexpr float sincosf_eval(float x)
 		{
-			FPBits xbits(x);
 			const std::uint32_t x_abs = ccm::support::bit_cast<std::uint32_t>(x) & 0x7fff'ffffU;
 
 			// sin(+/-0) = +/-0, cos(+/-0) = 1. Returning x preserves the sign of a signed zero.
@@ -54,40 +99,15 @@ namespace ccm::internal::impl
 
 			float y{};
 			unsigned k = 0;
-
-			if (x_abs < 0x4880'0000U) { k = sincosf_range_reduction_small(x, y); }
-			else
-			{
-				if (CCM_UNLIKELY(x_abs >= 0x7f80'0000U))
-				{
-					if (xbits.is_signaling_nan())
-					{
-						support::fenv::raise_except_if_required(FE_INVALID);
-						return FPBits::quiet_nan().get_val();
-					}
-
-					if (x_abs == 0x7f80'0000U)
-					{
-						support::fenv::set_errno_if_required(EDOM);
-						support::fenv::raise_except_if_required(FE_INVALID);
-					}
-					return x + FPBits::quiet_nan().get_val();
-				}
-
-				double yd = 0.0;
-				k		  = sincos_ph::payne_hanek_reduce(static_cast<double>(x), yd);
-				y		  = static_cast<float>(yd);
-			}
+			float special{};
+			if (!sincosf_reduce(x, x_abs, y, k, special)) { return special; }
 
 			const float sin_k = data::SIN_K_PI_OVER_8[k & 15];
 			const float cos_k = data::SIN_K_PI_OVER_8[(k + 4) & 15];
 
-			const float y_sq = y * y;
-			const float p1	 = support::multiply_add(y_sq, 0x1.111112p-7f, -0x1.555556p-3f);
-			const float q1	 = support::multiply_add(y_sq, 0x1.54b8bep-5f, -0x1.ffffc4p-2f);
-			const float y3	 = y_sq * y;
-			const float c1	 = support::multiply_add(y_sq, q1, 1.0f);
-			const float s1	 = support::multiply_add(y3, p1, y);
+			float s1{};
+			float c1{};
+			sincosf_poly(y, s1, c1);
 
 			// The cos tail is in the else so it is discarded for the sin instantiation rather than
 			// left as unreachable code, which MSVC rejects under /W4 (C4702).
@@ -98,6 +118,38 @@ namespace ccm::internal::impl
 			}
 		}
 
+		// Both results of sincosf_eval from one range reduction.
+		constexpr void sincosf_eval_both(float x, float & sin_out, float & cos_out)
+		{
+			const std::uint32_t x_abs = ccm::support::bit_cast<std::uint32_t>(x) & 0x7fff'ffffU;
+			if (x_abs == 0)
+			{
+				sin_out = x;
+				cos_out = 1.0f;
+				return;
+			}
+
+			float y{};
+			unsigned k = 0;
+			float special{};
+			if (!sincosf_reduce(x, x_abs, y, k, special))
+			{
+				sin_out = special;
+				cos_out = special;
+				return;
+			}
+
+			const float sin_k = data::SIN_K_PI_OVER_8[k & 15];
+			const float cos_k = data::SIN_K_PI_OVER_8[(k + 4) & 15];
+
+			float s1{};
+			float c1{};
+			sincosf_poly(y, s1, c1);
+
+			sin_out = support::multiply_add(cos_k, s1, sin_k * c1);
+			cos_out = support::multiply_add(cos_k, c1, -sin_k * s1);
+		}
+
 	} // namespace sincos_float_detail
 
 	constexpr float sin_float_impl(float x)
@@ -106,6 +158,9 @@ namespace ccm::internal::impl
 	constexpr float cos_float_impl(float x)
 	{ return sincos_float_detail::sincosf_eval<false>(x); }
 
+	constexpr void sincos_float_impl(float x, float & sin_out, float & cos_out)
+	{ sincos_float_detail::sincosf_eval_both(x, sin_out, cos_out); }
+
 } // namespace ccm::internal::impl
 
 namespace ccm::internal
@@ -115,4 +170,7 @@ namespace ccm::internal
 
 	constexpr float cos_float(float num) noexcept
 	{ return impl::cos_float_impl(num); }
+
+	constexpr void sincos_float(float num, float & sin_out, float & cos_out) noexcept
+	{ impl::sincos_float_impl(num, sin_out, cos_out); }
 } // namespace ccm::internal
@@ -18,6 +18,7 @@
 // becomes. Operating in double serves both kernels: a float argument casts to double exactly and
 // only needs the top bits of the result.
 
+#include "ccmath/internal/config/type_support.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/internal/support/multiply_add.hpp"
 
@@ -46,9 +47,14 @@ namespace ccm::internal::impl::sincos_ph
 		std::uint64_t lo;
 	};
 
-	// 64 x 64 -> 128 unsigned multiply, portable and constexpr (no __int128).
+	// 64 x 64 -> 128 unsigned multiply, constexpr. Uses the native 128-bit integer where the compiler
+	// has one and falls back to four 32 x 32 -> 64 partial products otherwise.
 	constexpr U128 mul64(std::uint64_t a, std::uint64_t b) noexcept
 	{
+#ifdef CCM_TYPES_HAS_INT128
+		const __uint128_t p = static_cast<__uint128_t>(a) * b;
+		return U128{ static_cast<std::uint64_t>(p >> 64), static_cast<std::uint64_t>(p) };
+#else
 		const std::uint64_t a_lo = a & 0xffffffffULL;
 		const std::uint64_t a_hi = a >> 32;
 		const std::uint64_t b_lo = b & 0xffffffffULL;
@@ -61,6 +67,7 @@ namespace ccm::internal::impl::sincos_ph
 		const std::uint64_t lo	 = (ll & 0xffffffffULL) | (mid << 32);
 		const std::uint64_t hi	 = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
 		return U128{ hi, lo };
+#endif
 	}
 
 	// Add a 64-bit word into the 256-bit accumulator (acc[0] low .. acc[3] high) at limb `word`,
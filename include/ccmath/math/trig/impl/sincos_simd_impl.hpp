@@ -0,0 +1,442 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized sin, cos and sincos. The small range reduction, the
+// SIN_K_PI_OVER_8 table reconstruction and the polynomials replay
+// sincos_double_impl and sincos_float_impl operation for operation, with
+// multiply_add fused exactly where the scalar kernels fuse it, so every lane is
+// bit identical to the scalar kernel. Lanes too large for the small reduction
+// go through a lane form of sincos_ph::payne_hanek_reduce that forms the 64 x 64
+// -> 128 products of the 8/pi window across all lanes at once and lands on the
+// same bits as the scalar reduction; infinite and NaN lanes are recomputed with
+// the scalar kernel, which keeps their errno and fenv side effects.
+
+#include "ccmath/internal/math/generic/builtins/basic/fma.hpp"
+#include "ccmath/internal/math/runtime/pp/conversion.hpp"
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/internal/support/path_stats.hpp"
+#include "ccmath/math/trig/impl/sincos_double_impl.hpp"
+#include "ccmath/math/trig/impl/sincos_float_impl.hpp"
+#include "ccmath/math/trig/impl/sincos_payne_hanek.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ccm::internal::impl
+{
+	namespace sincos_simd_detail
+	{
+		// Lane form of support::multiply_add: fused wherever the scalar wrapper is fused.
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> multiply_add(pp::basic_simd<T, Abi> const & x, pp::basic_simd<T, Abi> const & y,
+															  pp::basic_simd<T, Abi> const & z) noexcept
+		{
+#ifdef CCMATH_TARGET_CPU_HAS_FMA
+			if constexpr (ccm::builtin::has_constexpr_fma<T> || ccm::builtin::has_runtime_fma<T>)
+			{
+				return pp::basic_simd<T, Abi>::from_member(pp::SimdTraits<T, Abi>::op_fma(x.get(), y.get(), z.get()));
+			}
+			else
+#endif
+			{
+				return (x * y) + z;
+			}
+		}
+
+		// Lane form of support::fp::nearest_integer for |x| below 2^(digits-1), including its
+		// correction for non-default rounding modes.
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> nearest_integer(pp::basic_simd<T, Abi> const & x) noexcept
+		{
+			using V = pp::basic_simd<T, Abi>;
+
+			const V round_offset(std::is_same_v<T, float> ? static_cast<T>(0x1.0p23F) : static_cast<T>(0x1.0p52));
+			const V r	 = pp::simd_select(x < V(static_cast<T>(0)), (x - round_offset) + round_offset, (x + round_offset) - round_offset);
+			const V diff = x - r;
+
+			V out = pp::simd_select(diff > V(static_cast<T>(0.5)), r + V(static_cast<T>(1)), r);
+			out	  = pp::simd_select(diff < V(static_cast<T>(-0.5)), r - V(static_cast<T>(1)), out);
+			return out;
+		}
+
+		template <typename T>
+		struct sincos_simd_traits;
+
+		template <>
+		struct sincos_simd_traits<double>
+		{
+			using bits_type = std::uint64_t;
+			using int_type	= std::int64_t;
+
+			static constexpr bits_type abs_mask		 = 0x7fff'ffff'ffff'ffffULL;
+			static constexpr bits_type large_bits	 = 0x4130'0000'0000'0000ULL; // 2^20
+			static constexpr bits_type infinity_bits = 0x7ff0'0000'0000'0000ULL;
+
+			static constexpr auto & sin_k	   = sincos_double_data::SIN_K_PI_OVER_8;
+			static constexpr auto & mpi		   = sincos_double_data::MPI;
+			static constexpr double one_over_pi = sincos_double_data::ONE_OVER_PI;
+
+			static unsigned payne_hanek(double x, double & y) noexcept { return sincos_ph::payne_hanek_reduce(x, y); }
+			static double sin_scalar(double x) noexcept { return sin_double_impl(x); }
+			static double cos_scalar(double x) noexcept { return cos_double_impl(x); }
+			static void sincos_scalar(double x, double & s, double & c) noexcept { sincos_double_impl(x, s, c); }
+		};
+
+		template <>
+		struct sincos_simd_traits<float>
+		{
+			using bits_type = std::uint32_t;
+			using int_type	= std::int32_t;
+
+			static constexpr bits_type abs_mask		 = 0x7fff'ffffU;
+			static constexpr bits_type large_bits	 = 0x4880'0000U; // 2^18
+			static constexpr bits_type infinity_bits = 0x7f80'0000U;
+
+			static constexpr auto & sin_k	  = sincos_float_data::SIN_K_PI_OVER_8;
+			static constexpr auto & mpi		  = sincos_float_data::MPI;
+			static constexpr float one_over_pi = sincos_float_data::ONE_OVER_PI;
+
+			static unsigned payne_hanek(float x, float & y) noexcept
+			{
+				double yd		 = 0.0;
+				const unsigned k = sincos_ph::payne_hanek_reduce(static_cast<double>(x), yd);
+				y				 = static_cast<float>(yd);
+				return k;
+			}
+			static float sin_scalar(float x) noexcept { return sin_float_impl(x); }
+			static float cos_scalar(float x) noexcept { return cos_float_impl(x); }
+			static void sincos_scalar(float x, float & s, float & c) noexcept { sincos_float_impl(x, s, c); }
+		};
+
+		// Lane form of sincos_ph::mul64 from 32 x 32 -> 64 partial products, which vector units
+		// provide where they lack a full 64-bit multiply.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE void mul64(pp::basic_simd<std::uint64_t, Abi> const & a, pp::basic_simd<std::uint64_t, Abi> const & b,
+									 pp::basic_simd<std::uint64_t, Abi> & hi, pp::basic_simd<std::uint64_t, Abi> & lo) noexcept
+		{
+			using UVec = pp::basic_simd<std::uint64_t, Abi>;
+
+			const UVec low_half(0xffffffffULL);
+			const UVec a_lo = a & low_half;
+			const UVec a_hi = a >> UVec(32);
+			const UVec b_lo = b & low_half;
+			const UVec b_hi = b >> UVec(32);
+			const UVec ll	= a_lo * b_lo;
+			const UVec lh	= a_lo * b_hi;
+			const UVec hl	= a_hi * b_lo;
+			const UVec hh	= a_hi * b_hi;
+			const UVec mid	= (ll >> UVec(32)) + (lh & low_half) + (hl & low_half);
+			lo				= (ll & low_half) | (mid << UVec(32));
+			hi				= hh + (lh >> UVec(32)) + (hl >> UVec(32)) + (mid >> UVec(32));
+		}
+
+		// Word i of the 64-bit fixed-point expansion of 8/pi: word -1 is the integer part 2,
+		// words 0..31 are FRAC_8_OVER_PI and every later word is treated as zero, as in the
+		// scalar reduction.
+		inline std::uint64_t payne_hanek_word(std::int64_t i) noexcept
+		{
+			if (i < 0) { return 2ULL; }
+			if (i >= static_cast<std::int64_t>(sincos_ph::FRAC_8_OVER_PI.size())) { return 0ULL; }
+			return sincos_ph::FRAC_8_OVER_PI[static_cast<std::size_t>(i)];
+		}
+
+		// Lane form of sincos_ph::payne_hanek_reduce for finite |x| >= 2^18. The scalar reduction
+		// adds each 64-bit half of mantissa * word(i) into a 256-bit accumulator at bit
+		// e - 52 - 64 i + 188, dropping the bits that fall below it. That position splits into a
+		// limb and an offset that is the same for every word of a lane, so only six words, at
+		// limbs 3 down to -2 before the offset, can reach the accumulator. Each half is shifted
+		// by the offset on its own and summed in 32-bit digits, which keeps the per-word
+		// truncation and the mod 2^256 wrap of the scalar sum, so k and y are bit identical.
+		template <typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<std::int64_t, Abi> payne_hanek_reduce(pp::basic_simd<double, Abi> const & x, pp::basic_simd<double, Abi> & y) noexcept
+		{
+			using V	   = pp::basic_simd<double, Abi>;
+			using IVec = pp::basic_simd<std::int64_t, Abi>;
+			using UVec = pp::basic_simd<std::uint64_t, Abi>;
+
+			const UVec bits		= pp::simd_bit_cast<std::uint64_t>(x);
+			const UVec abs		= bits & UVec(0x7fff'ffff'ffff'ffffULL);
+			const UVec mantissa = (abs & UVec(0x000f'ffff'ffff'ffffULL)) | UVec(0x0010'0000'0000'0000ULL);
+
+			// (e - 52) + 188, the bit position of mantissa * word(0), as 64 q + off.
+			const UVec pos	   = (abs >> UVec(52)) - UVec(887);
+			const IVec q	   = pp::simd_bit_cast<std::int64_t>(pos >> UVec(6));
+			const UVec off	   = pos & UVec(63);
+			const UVec off_rev = UVec(63) - off;
+
+			UVec digits[8];
+			for (auto & d : digits) { d = UVec(0); }
+			const UVec low_half(0xffffffffULL);
+			const auto deposit = [&](int limb, UVec const & w)
+			{
+				digits[2 * limb] += w & low_half;
+				digits[(2 * limb) + 1] += w >> UVec(32);
+			};
+			// A word at `limb` before the offset: its low part stays in that limb and its high
+			// part moves to the next one. (w >> 1) >> (63 - off) is w >> (64 - off) without the
+			// out-of-range shift when off is zero.
+			const auto place = [&](int limb, UVec const & w)
+			{
+				if (limb >= 0 && limb < 4) { deposit(limb, w << off); }
+				if (limb >= -1 && limb < 3) { deposit(limb + 1, (w >> UVec(1)) >> off_rev); }
+			};
+
+			for (int j = 0; j < 6; ++j)
+			{
+				const IVec index = q + IVec(j - 3);
+				const UVec word([&](auto i) { return payne_hanek_word(index[i]); });
+				UVec hi;
+				UVec lo;
+				mul64(mantissa, word, hi, lo);
+				place(3 - j, lo);
+				place(4 - j, hi);
+			}
+
+			UVec carry(0);
+			for (auto & d : digits)
+			{
+				d += carry;
+				carry = d >> UVec(32);
+				d &= low_half;
+			}
+			const UVec acc1 = digits[2] | (digits[3] << UVec(32));
+			const UVec acc2 = digits[4] | (digits[5] << UVec(32));
+			const UVec acc3 = digits[6] | (digits[7] << UVec(32));
+
+			IVec k				  = pp::simd_bit_cast<std::int64_t>((acc3 >> UVec(60)) & UVec(15));
+			const UVec a3		  = acc3 & UVec(0x0fff'ffff'ffff'ffffULL);
+			const auto round_up	  = ((a3 >> UVec(59)) & UVec(1)) != UVec(0);
+			const UVec w0		  = (a3 << UVec(4)) | (acc2 >> UVec(60));
+			const UVec w1		  = (acc2 << UVec(4)) | (acc1 >> UVec(60));
+			V r_hi				  = pp::static_simd_cast<double>(w0 >> UVec(11)) * V(0x1.0p-53);
+			const V r_lo		  = pp::static_simd_cast<double>(w0 & UVec(0x7ffULL)) * V(0x1.0p-64) + pp::static_simd_cast<double>(w1) * V(0x1.0p-128);
+
+			r_hi = pp::simd_select(round_up, r_hi - V(1.0), r_hi);
+			k	 = pp::simd_select(round_up, (k + IVec(1)) & IVec(15), k);
+
+			const V y_val = multiply_add(r_hi, V(sincos_ph::PI_OVER_8_HI), multiply_add(r_hi, V(sincos_ph::PI_OVER_8_LO), r_lo * V(sincos_ph::PI_OVER_8_HI)));
+			const auto neg = (bits >> UVec(63)) != UVec(0);
+			y			   = pp::simd_select(neg, -y_val, y_val);
+			return pp::simd_select(neg, (IVec(0) - k) & IVec(15), k);
+		}
+
+		// sin(y) and cos(y) for the reduced argument |y| <= pi/16, returned as
+		// s1 = y + y^3 * P(y^2) and c1 = 1 + y^2 * Q(y^2).
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE void sincos_simd_poly(pp::basic_simd<T, Abi> const & y, pp::basic_simd<T, Abi> & s1, pp::basic_simd<T, Abi> & c1) noexcept
+		{
+			using V = pp::basic_simd<T, Abi>;
+
+			const V y_sq = y * y;
+			if constexpr (std::is_same_v<T, double>)
+			{
+				namespace data = sincos_double_data;
+
+				V sp = multiply_add(y_sq, V(data::SIN_POLY[5]), V(data::SIN_POLY[4]));
+				sp	 = multiply_add(y_sq, sp, V(data::SIN_POLY[3]));
+				sp	 = multiply_add(y_sq, sp, V(data::SIN_POLY[2]));
+				sp	 = multiply_add(y_sq, sp, V(data::SIN_POLY[1]));
+
+				V cp = multiply_add(y_sq, V(data::COS_POLY[5]), V(data::COS_POLY[4]));
+				cp	 = multiply_add(y_sq, cp, V(data::COS_POLY[3]));
+				cp	 = multiply_add(y_sq, cp, V(data::COS_POLY[2]));
+				cp	 = multiply_add(y_sq, cp, V(data::COS_POLY[1]));
+
+				const V y3 = y_sq * y;
+				c1		   = multiply_add(y_sq, cp, V(1.0));
+				s1		   = multiply_add(y3, sp, y);
+			}
+			else
+			{
+				const V p1 = multiply_add(y_sq, V(0x1.111112p-7f), V(-0x1.555556p-3f));
+				const V q1 = multiply_add(y_sq, V(0x1.54b8bep-5f), V(-0x1.ffffc4p-2f));
+				const V y3 = y_sq * y;
+				c1		   = multiply_add(y_sq, q1, V(1.0f));
+				s1		   = multiply_add(y3, p1, y);
+			}
+		}
+
+		// Reduces every lane to y in [-pi/16, pi/16] and k, the low bits of the pi/8 multiple.
+		// Lanes at or above the small reduction bound go through the lane Payne-Hanek; non-finite lanes
+		// are left with a finite stand-in for the caller to replace.
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE void sincos_simd_reduce(pp::basic_simd<T, Abi> const & x, pp::basic_simd<T, Abi> & y,
+												  pp::basic_simd<typename sincos_simd_traits<T>::int_type, Abi> & k) noexcept
+		{
+			using Traits = sincos_simd_traits<T>;
+			using V		 = pp::basic_simd<T, Abi>;
+			using UVec	 = pp::basic_simd<typename Traits::bits_type, Abi>;
+
+			constexpr auto N = static_cast<int>(V::size());
+
+			const UVec x_abs = pp::simd_bit_cast<typename Traits::bits_type>(x) & UVec(Traits::abs_mask);
+			const auto large = x_abs >= UVec(Traits::large_bits);
+
+			// Large lanes run the small reduction on a benign value and are overwritten below.
+			const V xs = pp::simd_select(large, V(static_cast<T>(0)), x);
+
+			const V prod_hi = xs * V(Traits::one_over_pi);
+			const V kf		= nearest_integer(prod_hi);
+
+			const V y_hi = multiply_add(kf, V(Traits::mpi[0]), xs);
+			y			 = multiply_add(kf, V(Traits::mpi[1]), y_hi);
+			y			 = multiply_add(kf, V(Traits::mpi[2]), y);
+			k			 = pp::static_simd_cast<typename Traits::int_type>(kf);
+
+			CCM_PATH_HIT_N(sincos_lane_small_reduction, N - pp::reduce_count(large));
+			if (pp::any_of(large))
+			{
+				const auto finite_large = large & (x_abs < UVec(Traits::infinity_bits));
+				CCM_PATH_HIT_N(sincos_lane_payne_hanek, pp::reduce_count(finite_large));
+				if constexpr (Abi::template IsValid<double>::value)
+				{
+					// The reduction runs in double for both kernels, as the scalar one does. The
+					// other lanes reduce the bound itself and keep their small-range result.
+					const V xl = pp::simd_select(finite_large, x, pp::simd_bit_cast<T>(UVec(Traits::large_bits)));
+					pp::basic_simd<double, Abi> yd;
+					const auto kd = payne_hanek_reduce(pp::static_simd_cast<double>(xl), yd);
+					y			  = pp::simd_select(finite_large, pp::static_simd_cast<T>(yd), y);
+					k			  = pp::simd_select(finite_large, pp::static_simd_cast<typename Traits::int_type>(kd), k);
+				}
+				else
+				{
+					// No double vector of this width, so the lanes are reduced one at a time.
+					for (int i = 0; i < N; ++i)
+					{
+						if (!finite_large[i]) { continue; }
+						T yi{};
+						k[i] = static_cast<typename Traits::int_type>(Traits::payne_hanek(x[i], yi));
+						y[i] = yi;
+					}
+				}
+			}
+		}
+
+		template <bool IsSin, typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> sincos_simd_eval(pp::basic_simd<T, Abi> const & x) noexcept
+		{
+			using Traits = sincos_simd_traits<T>;
+			using V		 = pp::basic_simd<T, Abi>;
+			using IVec	 = pp::basic_simd<typename Traits::int_type, Abi>;
+			using UVec	 = pp::basic_simd<typename Traits::bits_type, Abi>;
+
+			constexpr auto N = static_cast<int>(V::size());
+
+			V y;
+			IVec k;
+			sincos_simd_reduce(x, y, k);
+
+			const IVec mask(15);
+			const IVec sin_index = k & mask;
+			const IVec cos_index = (k + IVec(4)) & mask;
+			const V sin_k([&](auto i) { return Traits::sin_k[static_cast<std::size_t>(sin_index[i])]; });
+			const V cos_k([&](auto i) { return Traits::sin_k[static_cast<std::size_t>(cos_index[i])]; });
+
+			V s1;
+			V c1;
+			sincos_simd_poly(y, s1, c1);
+
+			V result;
+			if constexpr (IsSin) { result = multiply_add(cos_k, s1, sin_k * c1); }
+			else
+			{
+				result = multiply_add(cos_k, c1, -sin_k * s1);
+			}
+
+			// sin(+/-0) = +/-0 and cos(+/-0) = 1, as in the scalar kernel.
+			const UVec x_abs = pp::simd_bit_cast<typename Traits::bits_type>(x) & UVec(Traits::abs_mask);
+			const auto zero	 = x_abs == UVec(0);
+			if (pp::any_of(zero)) { result = pp::simd_select(zero, IsSin ? x : V(static_cast<T>(1)), result); }
+
+			const auto non_finite = x_abs >= UVec(Traits::infinity_bits);
+			if (pp::any_of(non_finite))
+			{
+				CCM_PATH_HIT_N(sincos_lane_scalar_fallback, pp::reduce_count(non_finite));
+				for (int i = 0; i < N; ++i)
+				{
+					if (non_finite[i]) { result[i] = IsSin ? Traits::sin_scalar(x[i]) : Traits::cos_scalar(x[i]); }
+				}
+			}
+			return result;
+		}
+
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE void sincos_simd_eval_both(pp::basic_simd<T, Abi> const & x, pp::basic_simd<T, Abi> & sin_out, pp::basic_simd<T, Abi> & cos_out) noexcept
+		{
+			using Traits = sincos_simd_traits<T>;
+			using V		 = pp::basic_simd<T, Abi>;
+			using IVec	 = pp::basic_simd<typename Traits::int_type, Abi>;
+			using UVec	 = pp::basic_simd<typename Traits::bits_type, Abi>;
+
+			constexpr auto N = static_cast<int>(V::size());
+
+			V y;
+			IVec k;
+			sincos_simd_reduce(x, y, k);
+
+			const IVec mask(15);
+			const IVec sin_index = k & mask;
+			const IVec cos_index = (k + IVec(4)) & mask;
+			const V sin_k([&](auto i) { return Traits::sin_k[static_cast<std::size_t>(sin_index[i])]; });
+			const V cos_k([&](auto i) { return Traits::sin_k[static_cast<std::size_t>(cos_index[i])]; });
+
+			V s1;
+			V c1;
+			sincos_simd_poly(y, s1, c1);
+
+			sin_out = multiply_add(cos_k, s1, sin_k * c1);
+			cos_out = multiply_add(cos_k, c1, -sin_k * s1);
+
+			const UVec x_abs = pp::simd_bit_cast<typename Traits::bits_type>(x) & UVec(Traits::abs_mask);
+			const auto zero	 = x_abs == UVec(0);
+			if (pp::any_of(zero))
+			{
+				sin_out = pp::simd_select(zero, x, sin_out);
+				cos_out = pp::simd_select(zero, V(static_cast<T>(1)), cos_out);
+			}
+
+			const auto non_finite = x_abs >= UVec(Traits::infinity_bits);
+			if (pp::any_of(non_finite))
+			{
+				CCM_PATH_HIT_N(sincos_lane_scalar_fallback, pp::reduce_count(non_finite));
+				for (int i = 0; i < N; ++i)
+				{
+					if (!non_finite[i]) { continue; }
+					T s{};
+					T c{};
+					Traits::sincos_scalar(x[i], s, c);
+					sin_out[i] = s;
+					cos_out[i] = c;
+				}
+			}
+		}
+	} // namespace sincos_simd_detail
+
+	// sin(x) for a vector of float or double lanes.
+	template <typename T, typename Abi, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> sin_simd_impl(pp::basic_simd<T, Abi> const & x) noexcept
+	{ return sincos_simd_detail::sincos_simd_eval<true>(x); }
+
+	// cos(x) for a vector of float or double lanes.
+	template <typename T, typename Abi, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> cos_simd_impl(pp::basic_simd<T, Abi> const & x) noexcept
+	{ return sincos_simd_detail::sincos_simd_eval<false>(x); }
+
+	// sin(x) and cos(x) for a vector of float or double lanes from one range reduction.
+	template <typename T, typename Abi, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	CCM_ALWAYS_INLINE void sincos_simd_impl(pp::basic_simd<T, Abi> const & x, pp::basic_simd<T, Abi> & sin_out, pp::basic_simd<T, Abi> & cos_out) noexcept
+	{ sincos_simd_detail::sincos_simd_eval_both(x, sin_out, cos_out); }
+} // namespace ccm::internal::impl
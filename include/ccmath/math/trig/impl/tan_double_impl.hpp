@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// Double tan on the sin/cos range reduction. One reduction gives y in [-pi/16, pi/16] and k, the
+// pi/8 multiple; tan(y) comes from its own polynomial, and dividing the sin and cos
+// reconstructions of sincos_double_impl by cos(y) leaves
+// tan(k pi/8 + y) = (sin_k + cos_k tan(y)) / (cos_k - sin_k tan(y)), a single quotient.
+
+#pragma once
+
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/multiply_add.hpp"
+#include "ccmath/math/trig/impl/sincos_double_data.hpp"
+#include "ccmath/math/trig/impl/sincos_double_impl.hpp"
+
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	namespace tan_double_detail
+	{
+		namespace data = sincos_double_data;
+
+		// t ~ tan(y) for the reduced argument |y| <= pi/16, as y + y^3 * P(y^2).
+		constexpr double tan_poly(double y)
+		{
+			const double y_sq = y * y;
+
+			double tp = support::multiply_add(y_sq, data::TAN_POLY[9], data::TAN_POLY[8]);
+			tp		  = support::multiply_add(y_sq, tp, data::TAN_POLY[7]);
+			tp		  = support::multiply_add(y_sq, tp, data::TAN_POLY[6]);
+			tp		  = support::multiply_add(y_sq, tp, data::TAN_POLY[5]);
+			tp		  = support::multiply_add(y_sq, tp, data::TAN_POLY[4]);
+			tp		  = support::multiply_add(y_sq, tp, data::TAN_POLY[3]);
+			tp		  = support::multiply_add(y_sq, tp, data::TAN_POLY[2]);
+			tp		  = support::multiply_add(y_sq, tp, data::TAN_POLY[1]);
+
+			return support::multiply_add(y_sq * y, tp, y);
+		}
+	} // namespace tan_double_detail
+
+	constexpr double tan_double_impl(double x)
+	{
+		const std::uint64_t x_abs = ccm::support::bit_cast<std::uint64_t>(x) & 0x7fff'ffff'ffff'ffffULL;
+
+		// tan(+/-0) = +/-0.
+		if (x_abs == 0) { return x; }
+
+		double y{};
+		unsigned k = 0;
+		double special{};
+		if (!sincos_double_detail::sincos_reduce(x, x_abs, y, k, special)) { return special; }
+
+		const double sin_k = sincos_double_data::SIN_K_PI_OVER_8[k & 15];
+		const double cos_k = sincos_double_data::SIN_K_PI_OVER_8[(k + 4) & 15];
+		const double t	   = tan_double_detail::tan_poly(y);
+
+		return support::multiply_add(cos_k, t, sin_k) / support::multiply_add(-sin_k, t, cos_k);
+	}
+
+} // namespace ccm::internal::impl
+
+namespace ccm::internal
+{
+	constexpr double tan_double(double num) noexcept
+	{ return impl::tan_double_impl(num); }
+} // namespace ccm::internal
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// Float tan on the sin/cos range reduction; see tan_double_impl.hpp for the reconstruction.
+
+#pragma once
+
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/multiply_add.hpp"
+#include "ccmath/math/trig/impl/sincos_float_data.hpp"
+#include "ccmath/math/trig/impl/sincos_float_impl.hpp"
+
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	namespace tan_float_detail
+	{
+		namespace data = sincos_float_data;
+
+		// t ~ tan(y) for the reduced argument |y| <= pi/16, as y + y^3 * P(y^2).
+		constexpr float tanf_poly(float y)
+		{
+			const float y_sq = y * y;
+
+			float tp = support::multiply_add(y_sq, data::TAN_POLY[4], data::TAN_POLY[3]);
+			tp		 = support::multiply_add(y_sq, tp, data::TAN_POLY[2]);
+			tp		 = support::multiply_add(y_sq, tp, data::TAN_POLY[1]);
+
+			return support::multiply_add(y_sq * y, tp, y);
+		}
+	} // namespace tan_float_detail
+
+	constexpr float tan_float_impl(float x)
+	{
+		const std::uint32_t x_abs = ccm::support::bit_cast<std::uint32_t>(x) & 0x7fff'ffffU;
+
+		// tan(+/-0) = +/-0.
+		if (x_abs == 0) { return x; }
+
+		float y{};
+		unsigned k = 0;
+		float special{};
+		if (!sincos_float_detail::sincosf_reduce(x, x_abs, y, k, special)) { return special; }
+
+		const float sin_k = sincos_float_data::SIN_K_PI_OVER_8[k & 15];
+		const float cos_k = sincos_float_data::SIN_K_PI_OVER_8[(k + 4) & 15];
+		const float t	  = tan_float_detail::tanf_poly(y);
+
+		return support::multiply_add(cos_k, t, sin_k) / support::multiply_add(-sin_k, t, cos_k);
+	}
+
+} // namespace ccm::internal::impl
+
+namespace ccm::internal
+{
+	constexpr float tan_float(float num) noexcept
+	{ return impl::tan_float_impl(num); }
+} // namespace ccm::internal
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Vectorized tan. Shares the lane range reduction of sincos_simd_impl, including
+// its lane Payne-Hanek path, and replays the tan polynomial and single-quotient
+// reconstruction of tan_double_impl and tan_float_impl operation for operation,
+// so every lane is bit identical to the scalar kernel. Infinite and NaN lanes
+// are recomputed with the scalar kernel for its errno and fenv side effects.
+
+#include "ccmath/internal/math/runtime/pp/mask_reductions.hpp"
+#include "ccmath/internal/math/runtime/pp/simd.hpp"
+#include "ccmath/internal/math/runtime/pp/where.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/math/trig/impl/sincos_simd_impl.hpp"
+#include "ccmath/math/trig/impl/tan_double_impl.hpp"
+#include "ccmath/math/trig/impl/tan_float_impl.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::internal::impl
+{
+	namespace tan_simd_detail
+	{
+		using sincos_simd_detail::multiply_add;
+
+		// tan(y) for the reduced argument |y| <= pi/16, as y + y^3 * P(y^2).
+		template <typename T, typename Abi>
+		CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> tan_simd_poly(pp::basic_simd<T, Abi> const & y) noexcept
+		{
+			using V = pp::basic_simd<T, Abi>;
+
+			const V y_sq = y * y;
+			V tp;
+			if constexpr (std::is_same_v<T, double>)
+			{
+				namespace data = sincos_double_data;
+
+				tp = multiply_add(y_sq, V(data::TAN_POLY[9]), V(data::TAN_POLY[8]));
+				tp = multiply_add(y_sq, tp, V(data::TAN_POLY[7]));
+				tp = multiply_add(y_sq, tp, V(data::TAN_POLY[6]));
+				tp = multiply_add(y_sq, tp, V(data::TAN_POLY[5]));
+				tp = multiply_add(y_sq, tp, V(data::TAN_POLY[4]));
+				tp = multiply_add(y_sq, tp, V(data::TAN_POLY[3]));
+				tp = multiply_add(y_sq, tp, V(data::TAN_POLY[2]));
+				tp = multiply_add(y_sq, tp, V(data::TAN_POLY[1]));
+			}
+			else
+			{
+				namespace data = sincos_float_data;
+
+				tp = multiply_add(y_sq, V(data::TAN_POLY[4]), V(data::TAN_POLY[3]));
+				tp = multiply_add(y_sq, tp, V(data::TAN_POLY[2]));
+				tp = multiply_add(y_sq, tp, V(data::TAN_POLY[1]));
+			}
+			return multiply_add(y_sq * y, tp, y);
+		}
+
+		template <typename T>
+		inline T tan_scalar(T x) noexcept
+		{
+			if constexpr (std::is_same_v<T, float>) { return tan_float_impl(x); }
+			else { return tan_double_impl(x); }
+		}
+	} // namespace tan_simd_detail
+
+	// tan(x) for a vector of float or double lanes.
+	template <typename T, typename Abi, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	[[nodiscard]] CCM_ALWAYS_INLINE pp::basic_simd<T, Abi> tan_simd_impl(pp::basic_simd<T, Abi> const & x) noexcept
+	{
+		using Traits = sincos_simd_detail::sincos_simd_traits<T>;
+		using V		 = pp::basic_simd<T, Abi>;
+		using IVec	 = pp::basic_simd<typename Traits::int_type, Abi>;
+		using UVec	 = pp::basic_simd<typename Traits::bits_type, Abi>;
+
+		constexpr auto N = static_cast<int>(V::size());
+
+		V y;
+		IVec k;
+		sincos_simd_detail::sincos_simd_reduce(x, y, k);
+
+		const IVec mask(15);
+		const IVec sin_index = k & mask;
+		const IVec cos_index = (k + IVec(4)) & mask;
+		const V sin_k([&](auto i) { return Traits::sin_k[static_cast<std::size_t>(sin_index[i])]; });
+		const V cos_k([&](auto i) { return Traits::sin_k[static_cast<std::size_t>(cos_index[i])]; });
+
+		const V t = tan_simd_detail::tan_simd_poly(y);
+		V result  = tan_simd_detail::multiply_add(cos_k, t, sin_k) / tan_simd_detail::multiply_add(-sin_k, t, cos_k);
+
+		// tan(+/-0) = +/-0, as in the scalar kernel.
+		const UVec x_abs = pp::simd_bit_cast<typename Traits::bits_type>(x) & UVec(Traits::abs_mask);
+		const auto zero	 = x_abs == UVec(0);
+		if (pp::any_of(zero)) { result = pp::simd_select(zero, x, result); }
+
+		const auto non_finite = x_abs >= UVec(Traits::infinity_bits);
+		if (pp::any_of(non_finite))
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				if (non_finite[i]) { result[i] = tan_simd_detail::tan_scalar<T>(x[i]); }
+			}
+		}
+		return result;
+	}
+} // namespace ccm::internal::impl
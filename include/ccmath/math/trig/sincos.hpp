@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/builtins/trig/cos.hpp"
+#include "ccmath/internal/math/generic/builtins/trig/sin.hpp"
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+#include "ccmath/internal/math/runtime/func/trig/sincos_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+#include "ccmath/math/trig/cos.hpp"
+#include "ccmath/math/trig/sin.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace ccm
+{
+	/**
+	 * @brief Computes the sine and cosine of an angle in radians with a single range reduction.
+	 * @tparam T Floating-point type.
+	 * @param num Angle in radians.
+	 * @param sin_out Receives the sine of num, identical to ccm::sin(num).
+	 * @param cos_out Receives the cosine of num, identical to ccm::cos(num).
+	 * @note This is a GNU extension in the C library and is not part of the C++ standard.
+	 */
+	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
+	constexpr void sincos(T num, T * sin_out, T * cos_out)
+	{
+		if (ccm::support::is_constant_evaluated())
+		{
+			// With constexpr builtins ccm::sin and ccm::cos do not reach the generic kernel, so there
+			// is no shared reduction to reuse.
+			if constexpr (ccm::builtin::has_constexpr_sin<T> || ccm::builtin::has_constexpr_cos<T>)
+			{
+				*sin_out = ccm::sin(num);
+				*cos_out = ccm::cos(num);
+			}
+			else { ccm::gen::sincos_gen(num, *sin_out, *cos_out); }
+			return;
+		}
+		ccm::rt::sincos_rt(num, *sin_out, *cos_out);
+	}
+
+	/**
+	 * @brief Computes the sine and cosine of an integral angle value after promotion to double.
+	 * @tparam Integer Integral type.
+	 * @param num Angle in radians.
+	 * @param sin_out Receives the sine of num.
+	 * @param cos_out Receives the cosine of num.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr void sincos(Integer num, double * sin_out, double * cos_out)
+	{ ccm::sincos<double>(static_cast<double>(num), sin_out, cos_out); }
+
+	/**
+	 * @brief Computes the sine and cosine of an angle in radians with a single range reduction.
+	 * @tparam T Floating-point type.
+	 * @param num Angle in radians.
+	 * @return A pair holding the sine of num in first and the cosine of num in second.
+	 */
+	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
+	constexpr std::pair<T, T> sincos(T num)
+	{
+		T sin_out{};
+		T cos_out{};
+		ccm::sincos<T>(num, &sin_out, &cos_out);
+		return { sin_out, cos_out };
+	}
+
+	/**
+	 * @brief Computes the sine and cosine of an integral angle value after promotion to double.
+	 * @tparam Integer Integral type.
+	 * @param num Angle in radians.
+	 * @return A pair holding the sine of num in first and the cosine of num in second.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr std::pair<double, double> sincos(Integer num)
+	{ return ccm::sincos<double>(static_cast<double>(num)); }
+
+	/**
+	 * @brief Computes the sine and cosine of a float angle in radians.
+	 * @param num Angle in radians.
+	 * @param sin_out Receives the sine of num.
+	 * @param cos_out Receives the cosine of num.
+	 */
+	constexpr void sincosf(float num, float * sin_out, float * cos_out)
+	{ ccm::sincos<float>(num, sin_out, cos_out); }
+
+	/**
+	 * @brief Computes the sine and cosine of a long double angle in radians.
+	 * @param num Angle in radians.
+	 * @param sin_out Receives the sine of num.
+	 * @param cos_out Receives the cosine of num.
+	 */
+	constexpr void sincosl(long double num, long double * sin_out, long double * cos_out)
+	{ ccm::sincos<long double>(num, sin_out, cos_out); }
+} // namespace ccm
+
+/// @ingroup trig
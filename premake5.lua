@@ -37,7 +37,14 @@ newoption {
 
 newoption {
     trigger = "ccmath-deterministic",
-    description = "Produce bit-identical cross-hardware math: route transcendentals through the generic kernels (no libm), force the correctly-rounded FMA path, disable runtime SIMD, and evaluate long double in double precision (GCC/Clang)",
+    description = "Produce bit-identical cross-hardware math: route transcendentals through the generic kernels (no libm), force the correctly-rounded FMA path, keep runtime SIMD on its bit-identical kernels (no SVML), and evaluate long double in double precision (GCC/Clang)",
+    allowed = { { "true", "Enable" }, { "false", "Disable" } },
+    default = "false",
+}
+
+newoption {
+    trigger = "ccmath-enable-path-stats",
+    description = "Count hits of the named pow, sin/cos and log kernel paths in relaxed atomic counters (ccm::path_stats); diagnostic builds only",
     allowed = { { "true", "Enable" }, { "false", "Disable" } },
     default = "false",
 }
@@ -65,7 +72,7 @@ end
 function ccmath.defines()
     local defs = {}
 
-    if _ccmath_option_enabled("ccmath-enable-runtime-simd", true) and not _ccmath_option_enabled("ccmath-deterministic", false) then
+    if _ccmath_option_enabled("ccmath-enable-runtime-simd", true) then
         table.insert(defs, "CCM_CONFIG_USE_RT_SIMD")
     end
 
@@ -81,6 +88,10 @@ function ccmath.defines()
         table.insert(defs, "CCM_CONFIG_DETERMINISTIC")
     end
 
+    if _ccmath_option_enabled("ccmath-enable-path-stats", false) then
+        table.insert(defs, "CCM_CONFIG_ENABLE_PATH_STATS")
+    end
+
     return defs
 end
 
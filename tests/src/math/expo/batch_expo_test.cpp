@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The ccm::batch entry points are contractually bit identical to the scalar generic path element
+// by element, whichever of the vector or scalar paths handled the element. These tests pin that
+// contract for every tail length, in place, through the range overloads and under directed
+// rounding. The vector kernels themselves are pinned lane by lane in exp_simd_test.cpp and
+// log_simd_test.cpp.
+
+#include "ccmath/internal/math/generic/func/expo/exp2_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/exp_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/expm1_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log10_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log1p_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log2_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log_gen.hpp"
+#include "ccmath/math/batch/expo.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	template <typename T>
+	std::vector<T> build_exp_inputs()
+	{
+		constexpr T inf = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  T(1),
+							  T(-1),
+							  T(0.5),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest(),
+							  std::numeric_limits<T>::epsilon() };
+
+		// Walk through the tiny, main, scaled and overflow regions of both kernels.
+		const T limit = std::is_same_v<T, float> ? T(110) : T(760);
+		for (T x = -limit; x <= limit; x += limit / T(997))
+		{
+			xs.push_back(x);
+			xs.push_back(std::nextafter(x, inf));
+		}
+		for (int e = -80; e <= 12; ++e)
+		{
+			xs.push_back(std::ldexp(T(1.25), e));
+			xs.push_back(-std::ldexp(T(1.25), e));
+		}
+		for (T x : { T(88.0), T(88.72), T(-87.9), T(-103.9), T(-104.0), T(511.9), T(512.0), T(709.7), T(709.8), T(-708.3), T(-745.0) })
+		{
+			xs.push_back(x);
+			xs.push_back(-x);
+		}
+
+		std::mt19937_64 rng(20260701ULL);
+		std::uniform_real_distribution<T> dist(-limit, limit);
+		for (int i = 0; i < 20000; ++i) { xs.push_back(dist(rng)); }
+		return xs;
+	}
+
+	template <typename T>
+	std::vector<T> build_log_inputs()
+	{
+		constexpr T inf = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  T(1),
+							  T(-1),
+							  T(2),
+							  T(10),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::numeric_limits<T>::max(),
+							  std::nextafter(T(1), T(0)),
+							  std::nextafter(T(1), T(2)) };
+
+		// Dense sampling of the near-one window, which has its own polynomial in the double kernel.
+		for (T x = T(0.9); x <= T(1.1); x += T(0.0001)) { xs.push_back(x); }
+		for (int e = -1074; e <= 1023; e += 3)
+		{
+			const T v = std::ldexp(T(1.3), e);
+			if (std::isfinite(v)) { xs.push_back(v); }
+		}
+
+		std::mt19937_64 rng(20260702ULL);
+		std::uniform_real_distribution<T> mantissa(T(1), T(2));
+		std::uniform_int_distribution<int> exponent(std::numeric_limits<T>::min_exponent - 1, std::numeric_limits<T>::max_exponent - 1);
+		for (int i = 0; i < 20000; ++i) { xs.push_back(std::ldexp(mantissa(rng), exponent(rng))); }
+		return xs;
+	}
+
+	// Scalar references for the batch entry points: ccm's domain handling over the generic kernels.
+	template <typename T>
+	T log_family_reference(T x, T (*kernel)(T))
+	{
+		if (x == T(0)) { return -std::numeric_limits<T>::infinity(); }
+		if (x < T(0)) { return -std::numeric_limits<T>::quiet_NaN(); }
+		if (x == std::numeric_limits<T>::infinity() || std::isnan(x)) { return x; }
+		return kernel(x);
+	}
+
+	template <typename T, typename BatchFn, typename RefFn>
+	void expect_batch_matches_reference(const std::vector<T> & xs, BatchFn batch_fn, RefFn ref_fn, const char * tag)
+	{
+		// Every length up to a few native widths, so each tail length is exercised.
+		for (std::size_t n = 0; n <= 40; ++n)
+		{
+			std::vector<T> out(n + 1, T(-12345));
+			batch_fn(xs.data(), out.data(), n);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				EXPECT_TRUE(bit_equal(out[i], ref_fn(xs[i]))) << tag << " n=" << n << " i=" << i << " x=" << xs[i];
+			}
+			EXPECT_EQ(out[n], T(-12345)) << tag << " wrote past the end for n=" << n;
+		}
+
+		std::vector<T> out(xs.size());
+		batch_fn(xs.data(), out.data(), xs.size());
+		for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], ref_fn(xs[i]))) << tag << " x=" << xs[i]; }
+	}
+
+	template <typename T>
+	void expect_batch_family(const std::vector<T> & exp_xs, const std::vector<T> & log_xs)
+	{
+		std::vector<T> mixed = log_xs;
+		for (T x : { T(0), T(-0.0), T(-2), -std::numeric_limits<T>::infinity() }) { mixed.insert(mixed.begin() + 3, x); }
+		std::vector<T> log1p_xs = mixed;
+		for (T x : { T(-1), T(-0.5), T(-1.5), T(1e-9), T(-1e-9) }) { log1p_xs.insert(log1p_xs.begin() + 5, x); }
+
+		expect_batch_matches_reference<T>(exp_xs, [](T const * in, T * out, std::size_t n) { ccm::batch::exp(in, out, n); },
+										  [](T x) { return ccm::gen::exp_gen(x); }, "exp");
+		expect_batch_matches_reference<T>(exp_xs, [](T const * in, T * out, std::size_t n) { ccm::batch::exp2(in, out, n); },
+										  [](T x) { return ccm::gen::exp2_gen(x); }, "exp2");
+		expect_batch_matches_reference<T>(exp_xs, [](T const * in, T * out, std::size_t n) { ccm::batch::expm1(in, out, n); },
+										  [](T x) { return ccm::gen::expm1_gen(x); }, "expm1");
+		expect_batch_matches_reference<T>(mixed, [](T const * in, T * out, std::size_t n) { ccm::batch::log(in, out, n); },
+										  [](T x) { return log_family_reference<T>(x, ccm::gen::log_gen<T>); }, "log");
+		expect_batch_matches_reference<T>(mixed, [](T const * in, T * out, std::size_t n) { ccm::batch::log2(in, out, n); },
+										  [](T x) { return log_family_reference<T>(x, ccm::gen::log2_gen<T>); }, "log2");
+		expect_batch_matches_reference<T>(mixed, [](T const * in, T * out, std::size_t n) { ccm::batch::log10(in, out, n); },
+										  [](T x) { return log_family_reference<T>(x, ccm::gen::log10_gen<T>); }, "log10");
+		expect_batch_matches_reference<T>(log1p_xs, [](T const * in, T * out, std::size_t n) { ccm::batch::log1p(in, out, n); },
+										  [](T x) { return ccm::gen::log1p_gen(x); }, "log1p");
+	}
+} // namespace
+
+TEST(CcmathBatchExpo, BatchMatchesScalarFloat)
+{
+	expect_batch_family(build_exp_inputs<float>(), build_log_inputs<float>());
+}
+
+TEST(CcmathBatchExpo, BatchMatchesScalarDouble)
+{
+	expect_batch_family(build_exp_inputs<double>(), build_log_inputs<double>());
+}
+
+TEST(CcmathBatchExpo, RangeOverloadsAndInPlace)
+{
+	std::vector<double> xs = { 0.25, 1.0, 2.0, 3.5, -7.0, 100.0, 0.0, 1e-300, 42.0 };
+	std::array<double, 9> out{};
+	ccm::batch::exp(xs, out);
+	for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], ccm::gen::exp_gen(xs[i]))); }
+
+	// Only min(size(in), size(out)) elements are written.
+	std::array<double, 4> short_out{};
+	ccm::batch::log(xs, short_out);
+	for (std::size_t i = 0; i < short_out.size(); ++i) { EXPECT_TRUE(bit_equal(short_out[i], ccm::gen::log_gen(xs[i]))); }
+
+	std::vector<double> in_place = xs;
+	ccm::batch::log10(in_place, in_place);
+	for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(in_place[i], log_family_reference<double>(xs[i], ccm::gen::log10_gen<double>))); }
+}
+
+TEST(CcmathBatchExpo, DirectedRoundingUsesScalarKernel)
+{
+	const std::vector<double> xs = build_exp_inputs<double>();
+	const int saved				 = std::fegetround();
+	for (int mode : { FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO })
+	{
+		ASSERT_EQ(std::fesetround(mode), 0);
+		std::vector<double> out(xs.size());
+		ccm::batch::exp(xs.data(), out.data(), xs.size());
+		for (std::size_t i = 0; i < xs.size(); ++i)
+		{
+			const double ref = ccm::gen::exp_gen(xs[i]);
+			EXPECT_TRUE(bit_equal(out[i], ref)) << "mode=" << mode << " x=" << xs[i];
+		}
+	}
+	std::fesetround(saved);
+}
+
+TEST(CcmathBatchExpo, DomainErrorsSetErrnoAndFlags)
+{
+	const std::vector<double> xs = { 4.0, 2.0, 0.0, 8.0, 16.0, -1.0, 32.0, 64.0, 128.0 };
+	std::vector<double> out(xs.size());
+
+	std::feclearexcept(FE_ALL_EXCEPT);
+	errno = 0;
+	ccm::batch::log(xs.data(), out.data(), xs.size());
+	EXPECT_EQ(out[2], -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(out[5]));
+	if (math_errhandling & MATH_ERREXCEPT)
+	{
+		EXPECT_NE(std::fetestexcept(FE_DIVBYZERO), 0);
+		EXPECT_NE(std::fetestexcept(FE_INVALID), 0);
+	}
+}
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The vectorized exp and exp2 kernels are contractually bit identical to the scalar kernels on
+// every lane. These tests pin that contract across several vector widths and over the regions
+// each kernel routes scalar side: tiny arguments, the scaled overflow/underflow band, infinities
+// and NaN. pp::exp and pp::exp2 are checked to route through the kernels, and the fenv side
+// effects of the scalar fallback lanes are pinned against the scalar kernels too.
+
+#include "ccmath/internal/math/runtime/pp/pp.hpp"
+#include "ccmath/math/expo/impl/exp2_simd_impl.hpp"
+#include "ccmath/math/expo/impl/exp_simd_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace ccm::pp;
+
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	template <typename T>
+	T exp_scalar(T x)
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::exp_float_impl(x); }
+		else { return ccm::internal::impl::exp_double_impl(x); }
+	}
+
+	template <typename T>
+	T exp2_scalar(T x)
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::exp2_float_impl(x); }
+		else { return ccm::internal::impl::exp2_double_impl(x); }
+	}
+
+	// limit is past the overflow and underflow thresholds of the function being tested.
+	template <typename T>
+	std::vector<T> build_inputs(T limit, std::initializer_list<T> edges)
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  T(1),
+							  T(-1),
+							  T(0.5),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest(),
+							  std::numeric_limits<T>::epsilon() };
+
+		// Walk through the tiny, main, scaled and overflow regions.
+		for (T x = -limit; x <= limit; x += limit / T(997))
+		{
+			xs.push_back(x);
+			xs.push_back(std::nextafter(x, inf));
+		}
+		for (int e = -80; e <= 12; ++e)
+		{
+			xs.push_back(std::ldexp(T(1.25), e));
+			xs.push_back(-std::ldexp(T(1.25), e));
+		}
+		for (T x : edges)
+		{
+			xs.push_back(x);
+			xs.push_back(-x);
+			xs.push_back(std::nextafter(x, inf));
+			xs.push_back(std::nextafter(x, -inf));
+		}
+
+		// Integers and half-integers are exact table entries for exp2.
+		for (int k = -40; k <= 40; ++k) { xs.push_back(static_cast<T>(k) * T(0.5)); }
+
+		std::mt19937_64 rng(20260701ULL);
+		std::uniform_real_distribution<T> dist(-limit, limit);
+		for (int i = 0; i < 20000; ++i) { xs.push_back(dist(rng)); }
+		return xs;
+	}
+
+	template <typename T>
+	std::vector<T> exp_inputs()
+	{
+		if constexpr (std::is_same_v<T, float>) { return build_inputs<T>(T(110), { T(88.0), T(88.72), T(87.9), T(103.9), T(104.0) }); }
+		else { return build_inputs<T>(T(760), { T(511.9), T(512.0), T(709.7), T(709.8), T(708.3), T(745.0), T(745.2) }); }
+	}
+
+	template <typename T>
+	std::vector<T> exp2_inputs()
+	{
+		if constexpr (std::is_same_v<T, float>) { return build_inputs<T>(T(160), { T(127.9), T(128.0), T(149.0), T(149.5), T(150.0) }); }
+		else { return build_inputs<T>(T(1100), { T(511.9), T(512.0), T(928.0), T(1022.0), T(1023.9), T(1024.0), T(1075.0) }); }
+	}
+
+	template <typename V, typename VectorFn, typename ScalarFn>
+	void expect_kernel_matches_scalar(const std::vector<typename V::value_type> & xs, VectorFn vector_fn, ScalarFn scalar_fn, const char * tag)
+	{
+		using T				= typename V::value_type;
+		constexpr int width = static_cast<int>(V::size());
+
+		for (std::size_t base = 0; base < xs.size(); base += width)
+		{
+			alignas(64) T xb[64];
+			const int count = static_cast<int>(std::min<std::size_t>(width, xs.size() - base));
+			for (int i = 0; i < width; ++i) { xb[i] = i < count ? xs[base + static_cast<std::size_t>(i)] : T(1.5); }
+
+			const V rv = vector_fn(V(xb, element_aligned));
+			for (int i = 0; i < count; ++i)
+			{
+				const T got = rv[i];
+				const T ref = scalar_fn(xb[i]);
+				EXPECT_TRUE(bit_equal(got, ref)) << tag << " x=" << xb[i] << " got=0x" << std::hex << float_bits(got) << " ref=0x" << float_bits(ref);
+			}
+		}
+	}
+
+	template <typename T, typename VectorFn, typename ScalarFn>
+	void expect_all_widths(const std::vector<T> & xs, VectorFn vector_fn, ScalarFn scalar_fn)
+	{
+		expect_kernel_matches_scalar<native_simd<T>>(xs, vector_fn, scalar_fn, "native");
+		expect_kernel_matches_scalar<simd<T, 2>>(xs, vector_fn, scalar_fn, "w2");
+		expect_kernel_matches_scalar<simd<T, 4>>(xs, vector_fn, scalar_fn, "w4");
+		if constexpr (VecAbi<8>::template IsValid<T>::value) { expect_kernel_matches_scalar<simd<T, 8>>(xs, vector_fn, scalar_fn, "w8"); }
+		else { GTEST_SKIP() << "8-wide simd not available on this target"; }
+	}
+
+	struct FenvObservation
+	{
+		bool overflow;
+		bool underflow;
+		int err;
+	};
+
+	template <typename F>
+	FenvObservation observe_fenv(F && run)
+	{
+		std::feclearexcept(FE_ALL_EXCEPT);
+		errno = 0;
+		run();
+		return { std::fetestexcept(FE_OVERFLOW) != 0, std::fetestexcept(FE_UNDERFLOW) != 0, errno };
+	}
+} // namespace
+
+TEST(CcmathExpSimd, ExpBitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(exp_inputs<float>(), [](auto const & v) { return ccm::internal::impl::exp_simd_impl(v); }, exp_scalar<float>);
+}
+
+TEST(CcmathExpSimd, ExpBitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(exp_inputs<double>(), [](auto const & v) { return ccm::internal::impl::exp_simd_impl(v); }, exp_scalar<double>);
+}
+
+TEST(CcmathExpSimd, Exp2BitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(exp2_inputs<float>(), [](auto const & v) { return ccm::internal::impl::exp2_simd_impl(v); }, exp2_scalar<float>);
+}
+
+TEST(CcmathExpSimd, Exp2BitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(exp2_inputs<double>(), [](auto const & v) { return ccm::internal::impl::exp2_simd_impl(v); }, exp2_scalar<double>);
+}
+
+TEST(CcmathExpSimd, PpExpRoutesThroughKernels)
+{
+	const native_simd<double> xd([](auto i) { return -3.0 + 1.7 * static_cast<double>(i); });
+	const native_simd<float> xf([](auto i) { return -3.0F + 1.7F * static_cast<float>(i); });
+
+	const auto ed  = ccm::pp::exp(xd);
+	const auto e2d = ccm::pp::exp2(xd);
+	const auto ef  = ccm::pp::exp(xf);
+	const auto e2f = ccm::pp::exp2(xf);
+	for (int i = 0; i < static_cast<int>(xd.size()); ++i)
+	{
+		EXPECT_TRUE(bit_equal(ed[i], exp_scalar(xd[i])));
+		EXPECT_TRUE(bit_equal(e2d[i], exp2_scalar(xd[i])));
+	}
+	for (int i = 0; i < static_cast<int>(xf.size()); ++i)
+	{
+		EXPECT_TRUE(bit_equal(ef[i], exp_scalar(xf[i])));
+		EXPECT_TRUE(bit_equal(e2f[i], exp2_scalar(xf[i])));
+	}
+}
+
+TEST(CcmathExpSimd, FenvAndErrnoParityWithScalarKernel)
+{
+	using VD = native_simd<double>;
+	using VF = native_simd<float>;
+
+	for (double x : { 710.0, -746.0, 1e300, -1e300, 1.5, -700.0 })
+	{
+		volatile double simd_out = 0.0;
+		volatile double scal_out = 0.0;
+		const FenvObservation simd_obs = observe_fenv([&] { simd_out = ccm::internal::impl::exp_simd_impl(VD(x))[0]; });
+		const FenvObservation scal_obs = observe_fenv([&] { scal_out = exp_scalar(x); });
+		EXPECT_EQ(simd_obs.overflow, scal_obs.overflow) << "FE_OVERFLOW differs for exp(" << x << ")";
+		EXPECT_EQ(simd_obs.underflow, scal_obs.underflow) << "FE_UNDERFLOW differs for exp(" << x << ")";
+		EXPECT_EQ(simd_obs.err, scal_obs.err) << "errno differs for exp(" << x << ")";
+	}
+
+	for (float x : { 200.0F, -200.0F, -149.5F, 12.25F })
+	{
+		volatile float simd_out = 0.0F;
+		volatile float scal_out = 0.0F;
+		const FenvObservation simd_obs = observe_fenv([&] { simd_out = ccm::internal::impl::exp2_simd_impl(VF(x))[0]; });
+		const FenvObservation scal_obs = observe_fenv([&] { scal_out = exp2_scalar(x); });
+		EXPECT_EQ(simd_obs.overflow, scal_obs.overflow) << "FE_OVERFLOW differs for exp2f(" << x << ")";
+		EXPECT_EQ(simd_obs.underflow, scal_obs.underflow) << "FE_UNDERFLOW differs for exp2f(" << x << ")";
+		EXPECT_EQ(simd_obs.err, scal_obs.err) << "errno differs for exp2f(" << x << ")";
+	}
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The vectorized log, log2 and log10 kernels are contractually bit identical to the scalar
+// kernels on every lane. These tests pin that contract across several vector widths, over the
+// near-one windows of the double kernels and over the lanes each kernel routes scalar side:
+// zero, negative, subnormal, infinite and NaN inputs. pp::log, pp::log2 and pp::log10 are
+// checked to route through the kernels with the domain handling of ccm::log applied.
+
+#include "ccmath/internal/math/generic/func/expo/log10_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log2_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log_gen.hpp"
+#include "ccmath/internal/math/runtime/pp/pp.hpp"
+#include "ccmath/math/expo/impl/log10_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log2_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log_simd_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace ccm::pp;
+
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	template <typename T>
+	T log_scalar(T x)
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::log_float_impl(x); }
+		else { return ccm::internal::impl::log_double_impl(x); }
+	}
+
+	template <typename T>
+	T log2_scalar(T x)
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::log2_float_impl(x); }
+		else { return ccm::internal::impl::log2_double_impl(x); }
+	}
+
+	template <typename T>
+	T log10_scalar(T x)
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::log10_float_impl(x); }
+		else { return ccm::internal::impl::log10_double_impl(x); }
+	}
+
+	template <typename T>
+	std::vector<T> build_inputs()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  T(1),
+							  T(-1),
+							  T(2),
+							  T(10),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::numeric_limits<T>::max(),
+							  std::nextafter(T(1), T(0)),
+							  std::nextafter(T(1), T(2)) };
+
+		// Dense sampling around 1.0 covers the near-one windows of log (1 +- 0x1p-4) and log2
+		// (1 - 0x1.5b51p-5 .. 1 + 0x1.6ab2p-5) and their edges.
+		for (T x = T(0.9); x <= T(1.1); x += T(0.0001)) { xs.push_back(x); }
+		for (T edge : { T(1.0 - 0x1p-4), T(1.0 + 0x1p-4), T(1.0 - 0x1.5b51p-5), T(1.0 + 0x1.6ab2p-5) })
+		{
+			xs.push_back(edge);
+			xs.push_back(std::nextafter(edge, T(0)));
+			xs.push_back(std::nextafter(edge, T(2)));
+		}
+
+		// Every binade, including the subnormal range, plus the negated values.
+		for (int e = -1074; e <= 1023; e += 3)
+		{
+			const T v = std::ldexp(T(1.3), e);
+			if (std::isfinite(v))
+			{
+				xs.push_back(v);
+				xs.push_back(-v);
+			}
+		}
+
+		std::mt19937_64 rng(20260703ULL);
+		std::uniform_real_distribution<T> mantissa(T(1), T(2));
+		std::uniform_int_distribution<int> exponent(std::numeric_limits<T>::min_exponent - 1, std::numeric_limits<T>::max_exponent - 1);
+		for (int i = 0; i < 20000; ++i) { xs.push_back(std::ldexp(mantissa(rng), exponent(rng))); }
+		return xs;
+	}
+
+	template <typename V, typename VectorFn, typename ScalarFn>
+	void expect_kernel_matches_scalar(const std::vector<typename V::value_type> & xs, VectorFn vector_fn, ScalarFn scalar_fn, const char * tag)
+	{
+		using T				= typename V::value_type;
+		constexpr int width = static_cast<int>(V::size());
+
+		for (std::size_t base = 0; base < xs.size(); base += width)
+		{
+			alignas(64) T xb[64];
+			const int count = static_cast<int>(std::min<std::size_t>(width, xs.size() - base));
+			for (int i = 0; i < width; ++i) { xb[i] = i < count ? xs[base + static_cast<std::size_t>(i)] : T(1.5); }
+
+			const V rv = vector_fn(V(xb, element_aligned));
+			for (int i = 0; i < count; ++i)
+			{
+				const T got = rv[i];
+				const T ref = scalar_fn(xb[i]);
+				EXPECT_TRUE(bit_equal(got, ref)) << tag << " x=" << xb[i] << " got=0x" << std::hex << float_bits(got) << " ref=0x" << float_bits(ref);
+			}
+		}
+	}
+
+	template <typename T, typename VectorFn, typename ScalarFn>
+	void expect_all_widths(const std::vector<T> & xs, VectorFn vector_fn, ScalarFn scalar_fn)
+	{
+		expect_kernel_matches_scalar<native_simd<T>>(xs, vector_fn, scalar_fn, "native");
+		expect_kernel_matches_scalar<simd<T, 2>>(xs, vector_fn, scalar_fn, "w2");
+		expect_kernel_matches_scalar<simd<T, 4>>(xs, vector_fn, scalar_fn, "w4");
+		if constexpr (VecAbi<8>::template IsValid<T>::value) { expect_kernel_matches_scalar<simd<T, 8>>(xs, vector_fn, scalar_fn, "w8"); }
+		else { GTEST_SKIP() << "8-wide simd not available on this target"; }
+	}
+
+	// ccm's domain handling over the generic kernels.
+	template <typename T>
+	T log_family_reference(T x, T (*kernel)(T))
+	{
+		if (x == T(0)) { return -std::numeric_limits<T>::infinity(); }
+		if (x < T(0)) { return -std::numeric_limits<T>::quiet_NaN(); }
+		if (x == std::numeric_limits<T>::infinity() || std::isnan(x)) { return x; }
+		return kernel(x);
+	}
+
+	template <typename T>
+	void expect_pp_log_family()
+	{
+		const std::vector<T> xs = build_inputs<T>();
+		const auto ref_log		= [](T x) { return log_family_reference<T>(x, ccm::gen::log_gen<T>); };
+		const auto ref_log2		= [](T x) { return log_family_reference<T>(x, ccm::gen::log2_gen<T>); };
+		const auto ref_log10	= [](T x) { return log_family_reference<T>(x, ccm::gen::log10_gen<T>); };
+
+		expect_kernel_matches_scalar<native_simd<T>>(xs, [](auto const & v) { return ccm::pp::log(v); }, ref_log, "pp::log");
+		expect_kernel_matches_scalar<native_simd<T>>(xs, [](auto const & v) { return ccm::pp::log2(v); }, ref_log2, "pp::log2");
+		expect_kernel_matches_scalar<native_simd<T>>(xs, [](auto const & v) { return ccm::pp::log10(v); }, ref_log10, "pp::log10");
+	}
+} // namespace
+
+TEST(CcmathLogSimd, LogBitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(build_inputs<float>(), [](auto const & v) { return ccm::internal::impl::log_simd_impl(v); }, log_scalar<float>);
+}
+
+TEST(CcmathLogSimd, LogBitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(build_inputs<double>(), [](auto const & v) { return ccm::internal::impl::log_simd_impl(v); }, log_scalar<double>);
+}
+
+TEST(CcmathLogSimd, Log2BitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(build_inputs<float>(), [](auto const & v) { return ccm::internal::impl::log2_simd_impl(v); }, log2_scalar<float>);
+}
+
+TEST(CcmathLogSimd, Log2BitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(build_inputs<double>(), [](auto const & v) { return ccm::internal::impl::log2_simd_impl(v); }, log2_scalar<double>);
+}
+
+TEST(CcmathLogSimd, Log10BitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(build_inputs<float>(), [](auto const & v) { return ccm::internal::impl::log10_simd_impl(v); }, log10_scalar<float>);
+}
+
+TEST(CcmathLogSimd, Log10BitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(build_inputs<double>(), [](auto const & v) { return ccm::internal::impl::log10_simd_impl(v); }, log10_scalar<double>);
+}
+
+TEST(CcmathLogSimd, PpLogFamilyAppliesDomainHandlingFloat)
+{
+	expect_pp_log_family<float>();
+}
+
+TEST(CcmathLogSimd, PpLogFamilyAppliesDomainHandlingDouble)
+{
+	expect_pp_log_family<double>();
+}
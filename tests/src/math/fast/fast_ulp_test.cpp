@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include "ccmath/ccmath.hpp"
+#include "utils/math_samples.hpp"
+#include "utils/ulp_suite.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	// The bounds documented on each ccm::fast function and in docs/ULP_STATUS.md.
+	constexpr std::int64_t kExpDoubleUlp = 3;
+	constexpr std::int64_t kLogDoubleUlp = 1;
+	constexpr std::int64_t kLogFloatUlp	 = 1;
+	constexpr std::int64_t kTrigDoubleUlp = 4;
+	constexpr std::int64_t kTrigFloatUlp  = 1;
+
+	// n points spread evenly over [lo, hi], each nudged off the grid so the sweep does not only hit short mantissas.
+	template <typename T>
+	std::vector<T> sweep(T lo, T hi, int n)
+	{
+		std::vector<T> xs;
+		xs.reserve(static_cast<std::size_t>(n));
+		for (int i = 0; i < n; ++i)
+		{
+			const double t = (static_cast<double>(i) + 0.318309886) / static_cast<double>(n);
+			xs.push_back(static_cast<T>(static_cast<double>(lo) + (static_cast<double>(hi) - static_cast<double>(lo)) * t));
+		}
+		return xs;
+	}
+
+	// Like sweep, but evenly spaced in log2 so every binade between lo and hi is covered.
+	template <typename T>
+	std::vector<T> log_sweep(T lo, T hi, int n)
+	{
+		std::vector<T> xs;
+		for (const double e : sweep(std::log2(static_cast<double>(lo)), std::log2(static_cast<double>(hi)), n)) { xs.push_back(static_cast<T>(std::exp2(e))); }
+		return xs;
+	}
+
+	template <typename T, typename FastFn, typename StdFn>
+	void expect_unary_within(const std::vector<T> & xs, FastFn fast_fn, StdFn std_fn, std::int64_t max_ulp)
+	{
+		for (const T x : xs)
+		{
+			SCOPED_TRACE(x);
+			ccm::test::ExpectSameFloatingAsStd(fast_fn(x), std_fn(x), max_ulp);
+		}
+	}
+
+	template <typename T>
+	bool same_result(T a, T b)
+	{ return (std::isnan(a) && std::isnan(b)) || (a == b && std::signbit(a) == std::signbit(b)); }
+
+	// Hard inputs are handed to the accurate function, so results and errno must match it exactly.
+	template <typename T, typename FastFn, typename AccurateFn>
+	void expect_forwarded(T x, FastFn fast_fn, AccurateFn accurate_fn)
+	{
+		SCOPED_TRACE(x);
+		errno			   = 0;
+		const T accurate   = accurate_fn(x);
+		const int acc_errno = errno;
+		errno			   = 0;
+		const T fast	   = fast_fn(x);
+		EXPECT_TRUE(same_result(fast, accurate)) << "fast=" << fast << " accurate=" << accurate;
+		EXPECT_EQ(errno, acc_errno);
+	}
+
+	template <typename T, typename = void>
+	struct has_fast_exp : std::false_type
+	{
+	};
+
+	template <typename T>
+	struct has_fast_exp<T, std::void_t<decltype(ccm::fast::exp(std::declval<T>()))>> : std::true_type
+	{
+	};
+} // namespace
+
+TEST(CcmathFastUlpTests, ExpDouble)
+{
+	ccm::test::ExpectUlpUnaryOver(ccm::test::samples::kExpoDouble, ccm::fast::exp<double>, static_cast<double (*)(double)>(std::exp), kExpDoubleUlp);
+	expect_unary_within(sweep(-745.0, 710.0, 200000), ccm::fast::exp<double>, static_cast<double (*)(double)>(std::exp), kExpDoubleUlp);
+	expect_unary_within(sweep(-1.0, 1.0, 100000), ccm::fast::exp<double>, static_cast<double (*)(double)>(std::exp), kExpDoubleUlp);
+}
+
+TEST(CcmathFastUlpTests, NoFloatExp)
+{
+	// ccm::exp's float kernel is already as short as a fast one would be.
+	static_assert(has_fast_exp<double>::value);
+	static_assert(has_fast_exp<long double>::value);
+	static_assert(!has_fast_exp<float>::value);
+}
+
+TEST(CcmathFastUlpTests, LogDouble)
+{
+	ccm::test::ExpectUlpUnaryOver(ccm::test::samples::kExpoDouble, ccm::fast::log<double>, static_cast<double (*)(double)>(std::log), kLogDoubleUlp);
+	expect_unary_within(log_sweep(1e-300, 1e300, 200000), ccm::fast::log<double>, static_cast<double (*)(double)>(std::log), kLogDoubleUlp);
+	// Both sides of the switch between the near-1 polynomial and the table path.
+	expect_unary_within(sweep(0.99, 1.01, 200000), ccm::fast::log<double>, static_cast<double (*)(double)>(std::log), kLogDoubleUlp);
+}
+
+TEST(CcmathFastUlpTests, LogFloat)
+{
+	ccm::test::ExpectUlpUnaryOver(ccm::test::samples::kExpoFloat, ccm::fast::log<float>, static_cast<float (*)(float)>(std::log), kLogFloatUlp);
+	expect_unary_within(log_sweep(1e-37F, 1e37F, 200000), ccm::fast::log<float>, static_cast<float (*)(float)>(std::log), kLogFloatUlp);
+}
+
+TEST(CcmathFastUlpTests, SinCosDouble)
+{
+	ccm::test::ExpectUlpUnaryOver(ccm::test::samples::kTrigDouble, ccm::fast::sin<double>, static_cast<double (*)(double)>(std::sin), kTrigDoubleUlp);
+	ccm::test::ExpectUlpUnaryOver(ccm::test::samples::kTrigDouble, ccm::fast::cos<double>, static_cast<double (*)(double)>(std::cos), kTrigDoubleUlp);
+	const auto xs = sweep(-70000.0, 70000.0, 200000);
+	expect_unary_within(xs, ccm::fast::sin<double>, static_cast<double (*)(double)>(std::sin), kTrigDoubleUlp);
+	expect_unary_within(xs, ccm::fast::cos<double>, static_cast<double (*)(double)>(std::cos), kTrigDoubleUlp);
+
+	// Angles next to multiples of pi/8, where the reduced argument or the result is close to zero.
+	std::vector<double> near_multiples;
+	for (int k = -2000; k <= 2000; ++k)
+	{
+		const double x = static_cast<double>(k) * 0.39269908169872414;
+		near_multiples.push_back(x);
+		near_multiples.push_back(std::nextafter(x, 0.0));
+		near_multiples.push_back(std::nextafter(x, 2.0 * x));
+	}
+	expect_unary_within(near_multiples, ccm::fast::sin<double>, static_cast<double (*)(double)>(std::sin), kTrigDoubleUlp);
+	expect_unary_within(near_multiples, ccm::fast::cos<double>, static_cast<double (*)(double)>(std::cos), kTrigDoubleUlp);
+}
+
+TEST(CcmathFastUlpTests, SinCosFloat)
+{
+	ccm::test::ExpectUlpUnaryOver(ccm::test::samples::kTrigFloat, ccm::fast::sin<float>, static_cast<float (*)(float)>(std::sin), kTrigFloatUlp);
+	ccm::test::ExpectUlpUnaryOver(ccm::test::samples::kTrigFloat, ccm::fast::cos<float>, static_cast<float (*)(float)>(std::cos), kTrigFloatUlp);
+	const auto xs = sweep(-1.0e6F, 1.0e6F, 200000);
+	expect_unary_within(xs, ccm::fast::sin<float>, static_cast<float (*)(float)>(std::sin), kTrigFloatUlp);
+	expect_unary_within(xs, ccm::fast::cos<float>, static_cast<float (*)(float)>(std::cos), kTrigFloatUlp);
+}
+
+TEST(CcmathFastUlpTests, HardInputsForwardToTheAccurateFunctions)
+{
+	constexpr double inf  = std::numeric_limits<double>::infinity();
+	constexpr double qnan = std::numeric_limits<double>::quiet_NaN();
+	constexpr float inf_f = std::numeric_limits<float>::infinity();
+
+	for (const double x : { inf, -inf, qnan, 800.0, -800.0, 709.9, -745.5, 0x1p-60, 0.0 })
+	{
+		expect_forwarded(x, ccm::fast::exp<double>, ccm::exp<double>);
+	}
+	for (const double x : { inf, -inf, qnan, 0.0, -0.0, -1.0, 0x1p-1070 })
+	{
+		expect_forwarded(x, ccm::fast::log<double>, ccm::log<double>);
+	}
+	for (const float x : { inf_f, -inf_f, 0.0F, -2.0F, 0x1p-140F })
+	{
+		expect_forwarded(x, ccm::fast::log<float>, ccm::log<float>);
+	}
+	for (const double x : { inf, -inf, qnan, 0.0, -0.0, 0x1p-30, 1.0e6, -1.0e300 })
+	{
+		expect_forwarded(x, ccm::fast::sin<double>, ccm::sin<double>);
+		expect_forwarded(x, ccm::fast::cos<double>, ccm::cos<double>);
+	}
+	for (const float x : { inf_f, -inf_f, 0.0F, -0.0F, 0x1p-30F, 3.0e6F })
+	{
+		expect_forwarded(x, ccm::fast::sin<float>, ccm::sin<float>);
+		expect_forwarded(x, ccm::fast::cos<float>, ccm::cos<float>);
+	}
+}
+
+TEST(CcmathFastUlpTests, LongDoubleIsEvaluatedInDouble)
+{
+	EXPECT_EQ(ccm::fast::exp(0.75L), static_cast<long double>(ccm::fast::exp(0.75)));
+	EXPECT_EQ(ccm::fast::log(3.5L), static_cast<long double>(ccm::fast::log(3.5)));
+	EXPECT_EQ(ccm::fast::sin(0.75L), static_cast<long double>(ccm::fast::sin(0.75)));
+	EXPECT_EQ(ccm::fast::cos(0.75L), static_cast<long double>(ccm::fast::cos(0.75)));
+}
+
+TEST(CcmathFastUlpTests, Constexpr)
+{
+	static_assert(ccm::fast::exp(0.0) == 1.0);
+	static_assert(ccm::fast::log(1.0) == 0.0);
+	static_assert(ccm::fast::sin(0.5) > 0.479 && ccm::fast::sin(0.5) < 0.480);
+	static_assert(ccm::fast::cos(0.5F) > 0.877F && ccm::fast::cos(0.5F) < 0.878F);
+
+	// Constant evaluation takes the same kernels as run time.
+	constexpr double ct_exp = ccm::fast::exp(1.25);
+	constexpr double ct_sin = ccm::fast::sin(2.5);
+	EXPECT_EQ(ct_exp, ccm::fast::exp(1.25));
+	EXPECT_EQ(ct_sin, ccm::fast::sin(2.5));
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The ccm::batch hyperbolic entry points are contractually bit identical to the scalar generic
+// path element by element, whichever of the vector or scalar paths handled the element. These
+// tests pin that contract for every tail length, in place and through the range overloads. The
+// vector kernels themselves are pinned lane by lane in hyper_simd_test.cpp.
+
+#include "ccmath/internal/math/generic/func/hyper/acosh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/asinh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/atanh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/cosh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/sinh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyper/tanh_gen.hpp"
+#include "ccmath/math/batch/hyper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cerrno>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	// Every branch of the kernels and the boundaries between them, both signs.
+	template <typename T>
+	std::vector<T> hyper_inputs()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  -std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest() };
+
+		for (const double edge : { 0x1p-26, 1.0, 22.0, 0x1.62e42fefa39efp+9, 0x1.633ce8fb9f87dp+9 })
+		{
+			const auto e = static_cast<T>(edge);
+			for (const T v : { std::nextafter(e, T(0)), e, std::nextafter(e, inf) })
+			{
+				xs.push_back(v);
+				xs.push_back(-v);
+			}
+		}
+
+		for (int e = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits; e < 11; ++e)
+		{
+			xs.push_back(std::ldexp(T(1.37), e));
+			xs.push_back(-std::ldexp(T(1.91), e));
+		}
+
+		std::mt19937_64 rng(20260801ULL);
+		std::uniform_real_distribution<T> small(T(-1.5), T(1.5));
+		std::uniform_real_distribution<T> wide(T(-720), T(720));
+		for (int i = 0; i < 20000; ++i) { xs.push_back((i & 1) != 0 ? small(rng) : wide(rng)); }
+		return xs;
+	}
+
+	template <typename T, typename BatchFn, typename RefFn>
+	void expect_batch_matches_reference(const std::vector<T> & xs, BatchFn batch_fn, RefFn ref_fn, const char * tag)
+	{
+		// Every length up to a few native widths, so each tail length is exercised.
+		for (std::size_t n = 0; n <= 40; ++n)
+		{
+			std::vector<T> out(n + 1, T(-12345));
+			batch_fn(xs.data(), out.data(), n);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				EXPECT_TRUE(bit_equal(out[i], ref_fn(xs[i]))) << tag << " n=" << n << " i=" << i << " x=" << xs[i];
+			}
+			EXPECT_EQ(out[n], T(-12345)) << tag << " wrote past the end for n=" << n;
+		}
+
+		std::vector<T> out(xs.size());
+		batch_fn(xs.data(), out.data(), xs.size());
+		for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], ref_fn(xs[i]))) << tag << " x=" << xs[i]; }
+	}
+
+	template <typename T>
+	void expect_hyper_batches_match_scalar()
+	{
+		const std::vector<T> xs = hyper_inputs<T>();
+		expect_batch_matches_reference<T>(
+			xs, [](T const * in, T * out, std::size_t n) { ccm::batch::sinh(in, out, n); }, [](T x) { return ccm::gen::sinh_gen(x); }, "sinh");
+		expect_batch_matches_reference<T>(
+			xs, [](T const * in, T * out, std::size_t n) { ccm::batch::cosh(in, out, n); }, [](T x) { return ccm::gen::cosh_gen(x); }, "cosh");
+		expect_batch_matches_reference<T>(
+			xs, [](T const * in, T * out, std::size_t n) { ccm::batch::tanh(in, out, n); }, [](T x) { return ccm::gen::tanh_gen(x); }, "tanh");
+
+		std::vector<T> sinh_out(xs.size());
+		std::vector<T> cosh_out(xs.size());
+		ccm::batch::sinhcosh(xs, sinh_out, cosh_out);
+		for (std::size_t i = 0; i < xs.size(); ++i)
+		{
+			EXPECT_TRUE(bit_equal(sinh_out[i], ccm::gen::sinh_gen(xs[i]))) << "sinhcosh x=" << xs[i];
+			EXPECT_TRUE(bit_equal(cosh_out[i], ccm::gen::cosh_gen(xs[i]))) << "sinhcosh x=" << xs[i];
+		}
+	}
+
+	template <typename T>
+	void expect_inv_hyper_batches_match_scalar()
+	{
+		std::vector<T> xs = hyper_inputs<T>();
+		for (std::size_t i = 0; i < xs.size(); i += 3) { xs[i] /= T(700); }
+		expect_batch_matches_reference<T>(
+			xs, [](T const * in, T * out, std::size_t n) { ccm::batch::asinh(in, out, n); }, [](T x) { return ccm::gen::asinh_gen(x); }, "asinh");
+		expect_batch_matches_reference<T>(
+			xs, [](T const * in, T * out, std::size_t n) { ccm::batch::acosh(in, out, n); }, [](T x) { return ccm::gen::acosh_gen(x); }, "acosh");
+		expect_batch_matches_reference<T>(
+			xs, [](T const * in, T * out, std::size_t n) { ccm::batch::atanh(in, out, n); }, [](T x) { return ccm::gen::atanh_gen(x); }, "atanh");
+	}
+} // namespace
+
+TEST(CcmathBatchHyper, MatchesScalarFloat)
+{
+	expect_hyper_batches_match_scalar<float>();
+}
+
+TEST(CcmathBatchHyper, MatchesScalarDouble)
+{
+	expect_hyper_batches_match_scalar<double>();
+}
+
+TEST(CcmathBatchHyper, InverseMatchesScalarFloat)
+{
+	expect_inv_hyper_batches_match_scalar<float>();
+}
+
+TEST(CcmathBatchHyper, InverseMatchesScalarDouble)
+{
+	expect_inv_hyper_batches_match_scalar<double>();
+}
+
+TEST(CcmathBatchHyper, RangeOverloadsInPlaceAndPolicies)
+{
+	const std::vector<double> xs = { 0.25, 1.0, -8.0, 3.5, -7.0, 1e-300, 0.0, 30.0, -0.75 };
+	std::vector<double> in_place = xs;
+	ccm::batch::tanh(in_place, in_place);
+	for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(in_place[i], ccm::gen::tanh_gen(xs[i]))); }
+
+	// Only min(size(in), size(out)) elements are written.
+	std::array<double, 4> short_out{};
+	ccm::batch::sinh(xs, short_out);
+	for (std::size_t i = 0; i < short_out.size(); ++i) { EXPECT_TRUE(bit_equal(short_out[i], ccm::gen::sinh_gen(xs[i]))); }
+
+	const std::array<float, 5> clean = { 0.5F, 1.0F, -2.0F, 3.0F, 25.0F };
+	std::array<float, 5> sinh_out{};
+	std::array<float, 5> cosh_out{};
+	EXPECT_EQ(ccm::batch::tanh(clean, sinh_out, ccm::batch::collect_exceptions) & ~FE_INEXACT, 0);
+	EXPECT_EQ(sinh_out[4], 1.0F);
+	EXPECT_EQ(ccm::batch::sinhcosh(clean, sinh_out, cosh_out, ccm::batch::collect_exceptions) & ~FE_INEXACT, 0);
+
+	// cosh(1000) overflows; the policy reports it and leaves the flags alone.
+	const std::array<double, 3> big = { 1.0, 1000.0, 2.0 };
+	std::array<double, 3> big_out{};
+	std::feclearexcept(FE_ALL_EXCEPT);
+	EXPECT_NE(ccm::batch::cosh(big, big_out, ccm::batch::collect_exceptions) & FE_OVERFLOW, 0);
+	EXPECT_EQ(std::fetestexcept(FE_ALL_EXCEPT), 0);
+	EXPECT_EQ(big_out[1], std::numeric_limits<double>::infinity());
+
+	// atanh outside [-1, 1] is a domain error; the policy reports FE_INVALID and leaves errno alone.
+	const std::array<double, 3> rapidity = { 0.5, 1.5, -0.25 };
+	std::array<double, 3> rapidity_out{};
+	errno = 0;
+	EXPECT_NE(ccm::batch::atanh(rapidity, rapidity_out, ccm::batch::collect_exceptions) & FE_INVALID, 0);
+	EXPECT_EQ(errno, 0);
+	EXPECT_TRUE(std::isnan(rapidity_out[1]));
+	EXPECT_TRUE(bit_equal(rapidity_out[2], ccm::gen::atanh_gen(-0.25)));
+}
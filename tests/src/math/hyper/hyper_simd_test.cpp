@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The vectorized sinh, cosh, tanh and sinhcosh kernels are contractually bit identical to the
+// scalar kernels on every lane. These tests pin that contract across several vector widths, with
+// lanes from every branch of the scalar kernels mixed in one vector, and pin the accuracy of the
+// scalar kernels themselves against a long double reference.
+
+#include "ccmath/internal/math/generic/func/hyper/impl/hyper_impl.hpp"
+#include "ccmath/internal/math/generic/func/hyper/impl/hyper_simd_impl.hpp"
+#include "ccmath/internal/math/generic/func/hyper/impl/inv_hyper_impl.hpp"
+#include "ccmath/internal/math/generic/func/hyper/impl/inv_hyper_simd_impl.hpp"
+#include "ccmath/internal/math/runtime/pp/pp.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace ccm::pp;
+
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	// Every branch of the kernels and the boundaries between them, both signs.
+	template <typename T>
+	std::vector<T> hyper_inputs()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  -std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest() };
+
+		for (const double edge : { 0x1p-26, 1.0, 22.0, 0x1.62e42fefa39efp+9, 0x1.633ce8fb9f87dp+9 })
+		{
+			const auto e = static_cast<T>(edge);
+			for (const T v : { std::nextafter(e, T(0)), e, std::nextafter(e, inf) })
+			{
+				xs.push_back(v);
+				xs.push_back(-v);
+			}
+		}
+
+		for (int e = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits; e < 11; ++e)
+		{
+			xs.push_back(std::ldexp(T(1.37), e));
+			xs.push_back(-std::ldexp(T(1.91), e));
+		}
+
+		std::mt19937_64 rng(20260801ULL);
+		std::uniform_real_distribution<T> small(T(-1.5), T(1.5));
+		std::uniform_real_distribution<T> wide(T(-720), T(720));
+		for (int i = 0; i < 20000; ++i) { xs.push_back((i & 1) != 0 ? small(rng) : wide(rng)); }
+		return xs;
+	}
+
+	// The branch points of asinh, acosh and atanh, both signs, plus the domain edges at +-1.
+	template <typename T>
+	std::vector<T> inv_hyper_inputs()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0), T(-0.0), inf, -inf, std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest() };
+
+		for (const double edge : { 0x1p-28, 0.5, 1.0, 2.0, 0x1p28 })
+		{
+			const auto e = static_cast<T>(edge);
+			for (const T v : { std::nextafter(e, T(0)), e, std::nextafter(e, inf) })
+			{
+				xs.push_back(v);
+				xs.push_back(-v);
+			}
+		}
+
+		std::mt19937_64 rng(20260818ULL);
+		std::uniform_real_distribution<T> unit(T(-1), T(1));
+		std::uniform_real_distribution<T> wide(T(-40), T(40));
+		for (int i = 0; i < 20000; ++i) { xs.push_back((i & 1) != 0 ? unit(rng) * T(1.2) : std::exp(wide(rng)) * (unit(rng) < T(0) ? T(-1) : T(1))); }
+		return xs;
+	}
+
+	template <typename V>
+	void expect_inv_kernels_match_scalar(const std::vector<typename V::value_type> & xs, const char * tag)
+	{
+		using T				= typename V::value_type;
+		constexpr int width = static_cast<int>(V::size());
+
+		for (std::size_t base = 0; base < xs.size(); base += width)
+		{
+			alignas(64) T xb[64];
+			const int count = static_cast<int>(std::min<std::size_t>(width, xs.size() - base));
+			for (int i = 0; i < width; ++i) { xb[i] = i < count ? xs[base + static_cast<std::size_t>(i)] : T(1.5); }
+
+			const V x(xb, element_aligned);
+			const V sv = ccm::internal::impl::asinh_simd_impl(x);
+			const V cv = ccm::internal::impl::acosh_simd_impl(x);
+			const V tv = ccm::internal::impl::atanh_simd_impl(x);
+			for (int i = 0; i < count; ++i)
+			{
+				EXPECT_TRUE(bit_equal<T>(sv[i], ccm::internal::impl::asinh_impl(xb[i]))) << tag << " asinh x=" << xb[i];
+				EXPECT_TRUE(bit_equal<T>(cv[i], ccm::internal::impl::acosh_impl(xb[i]))) << tag << " acosh x=" << xb[i];
+				EXPECT_TRUE(bit_equal<T>(tv[i], ccm::internal::impl::atanh_impl(xb[i]))) << tag << " atanh x=" << xb[i];
+			}
+		}
+	}
+
+	template <typename V>
+	void expect_kernels_match_scalar(const std::vector<typename V::value_type> & xs, const char * tag)
+	{
+		using T				= typename V::value_type;
+		constexpr int width = static_cast<int>(V::size());
+
+		for (std::size_t base = 0; base < xs.size(); base += width)
+		{
+			alignas(64) T xb[64];
+			const int count = static_cast<int>(std::min<std::size_t>(width, xs.size() - base));
+			for (int i = 0; i < width; ++i) { xb[i] = i < count ? xs[base + static_cast<std::size_t>(i)] : T(1.5); }
+
+			const V x(xb, element_aligned);
+			const V sv = ccm::internal::impl::sinh_simd_impl(x);
+			const V cv = ccm::internal::impl::cosh_simd_impl(x);
+			const V tv = ccm::internal::impl::tanh_simd_impl(x);
+			V s2;
+			V c2;
+			ccm::internal::impl::sinhcosh_simd_impl(x, s2, c2);
+			for (int i = 0; i < count; ++i)
+			{
+				const T s = ccm::internal::impl::sinh_impl(xb[i]);
+				const T c = ccm::internal::impl::cosh_impl(xb[i]);
+				EXPECT_TRUE(bit_equal<T>(sv[i], s)) << tag << " sinh x=" << xb[i];
+				EXPECT_TRUE(bit_equal<T>(cv[i], c)) << tag << " cosh x=" << xb[i];
+				EXPECT_TRUE(bit_equal<T>(tv[i], ccm::internal::impl::tanh_impl(xb[i]))) << tag << " tanh x=" << xb[i];
+				EXPECT_TRUE(bit_equal<T>(s2[i], s)) << tag << " sinhcosh x=" << xb[i];
+				EXPECT_TRUE(bit_equal<T>(c2[i], c)) << tag << " sinhcosh x=" << xb[i];
+			}
+		}
+	}
+
+	template <typename T>
+	void expect_all_widths(const std::vector<T> & xs)
+	{
+		expect_kernels_match_scalar<native_simd<T>>(xs, "native");
+		expect_kernels_match_scalar<simd<T, 2>>(xs, "w2");
+		expect_kernels_match_scalar<simd<T, 4>>(xs, "w4");
+		if constexpr (VecAbi<8>::template IsValid<T>::value) { expect_kernels_match_scalar<simd<T, 8>>(xs, "w8"); }
+		else { GTEST_SKIP() << "8-wide simd not available on this target"; }
+	}
+
+	template <typename T>
+	void expect_inv_all_widths(const std::vector<T> & xs)
+	{
+		expect_inv_kernels_match_scalar<native_simd<T>>(xs, "native");
+		expect_inv_kernels_match_scalar<simd<T, 2>>(xs, "w2");
+		expect_inv_kernels_match_scalar<simd<T, 4>>(xs, "w4");
+		if constexpr (VecAbi<8>::template IsValid<T>::value) { expect_inv_kernels_match_scalar<simd<T, 8>>(xs, "w8"); }
+		else { GTEST_SKIP() << "8-wide simd not available on this target"; }
+	}
+
+	// Distance in ulps of T between got and a long double reference.
+	template <typename T>
+	long double ulp_error(T got, long double ref)
+	{
+		int exp = 0;
+		static_cast<void>(std::frexp(static_cast<T>(ref), &exp));
+		exp = std::max(exp, std::numeric_limits<T>::min_exponent);
+		return std::fabs(static_cast<long double>(got) - ref) / std::ldexp(1.0L, exp - std::numeric_limits<T>::digits);
+	}
+} // namespace
+
+static_assert(ccm::internal::impl::sinh_impl(0.0) == 0.0);
+static_assert(ccm::internal::impl::cosh_impl(0.0F) == 1.0F);
+static_assert(ccm::internal::impl::tanh_impl(-30.0) == -1.0);
+
+TEST(CcmathHyperSimd, BitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(hyper_inputs<float>());
+}
+
+TEST(CcmathHyperSimd, BitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(hyper_inputs<double>());
+}
+
+TEST(CcmathHyperSimd, PpHyperRoutesThroughKernels)
+{
+	const native_simd<double> xd([](auto i) { return -3.0 + 1.3 * static_cast<double>(i); });
+	const native_simd<float> xf([](auto i) { return -3.0F + 1.3F * static_cast<float>(i); });
+
+	const auto sd = ccm::pp::sinh(xd);
+	const auto cd = ccm::pp::cosh(xd);
+	const auto td = ccm::pp::tanh(xd);
+	const auto tf = ccm::pp::tanh(xf);
+	for (int i = 0; i < static_cast<int>(xd.size()); ++i)
+	{
+		EXPECT_TRUE(bit_equal<double>(sd[i], ccm::internal::impl::sinh_impl(xd[i])));
+		EXPECT_TRUE(bit_equal<double>(cd[i], ccm::internal::impl::cosh_impl(xd[i])));
+		EXPECT_TRUE(bit_equal<double>(td[i], ccm::internal::impl::tanh_impl(xd[i])));
+	}
+	for (int i = 0; i < static_cast<int>(xf.size()); ++i) { EXPECT_TRUE(bit_equal<float>(tf[i], ccm::internal::impl::tanh_impl(xf[i]))); }
+}
+
+TEST(CcmathHyperSimd, SpecialLanesRaiseNothing)
+{
+	using VD = native_simd<double>;
+
+	std::feclearexcept(FE_ALL_EXCEPT);
+	const VD nan_d(std::numeric_limits<double>::quiet_NaN());
+	const VD inf_d(-std::numeric_limits<double>::infinity());
+	const VD tiny_d(1e-300);
+	const VD s = ccm::internal::impl::sinh_simd_impl(nan_d) + ccm::internal::impl::cosh_simd_impl(nan_d) + ccm::internal::impl::tanh_simd_impl(nan_d);
+	const VD i = ccm::internal::impl::sinh_simd_impl(inf_d);
+	const VD t = ccm::internal::impl::tanh_simd_impl(inf_d) + ccm::internal::impl::tanh_simd_impl(tiny_d) + ccm::internal::impl::sinh_simd_impl(tiny_d);
+	const VD c = ccm::internal::impl::cosh_simd_impl(tiny_d);
+	EXPECT_EQ(std::fetestexcept(FE_ALL_EXCEPT & ~FE_INEXACT), 0);
+	EXPECT_TRUE(std::isnan(s[0]));
+	EXPECT_EQ(i[0], -std::numeric_limits<double>::infinity());
+	EXPECT_EQ(t[0], -1.0);
+	EXPECT_EQ(c[0], 1.0);
+
+	// Overflowing lanes raise FE_OVERFLOW, as the scalar kernel does.
+	volatile double big = 711.0;
+	const VD o			= ccm::internal::impl::cosh_simd_impl(VD(big));
+	EXPECT_EQ(o[0], std::numeric_limits<double>::infinity());
+	EXPECT_NE(std::fetestexcept(FE_OVERFLOW), 0);
+	std::feclearexcept(FE_ALL_EXCEPT);
+}
+
+TEST(CcmathHyperSimd, InverseBitIdenticalToScalarKernelFloat)
+{
+	expect_inv_all_widths(inv_hyper_inputs<float>());
+}
+
+TEST(CcmathHyperSimd, InverseBitIdenticalToScalarKernelDouble)
+{
+	expect_inv_all_widths(inv_hyper_inputs<double>());
+}
+
+TEST(CcmathHyperSimd, InverseLanesRaiseOnlyWhatTheScalarKernelRaises)
+{
+	using VD = native_simd<double>;
+
+	std::feclearexcept(FE_ALL_EXCEPT);
+	const VD x([](auto i) { return 1.25 + 0.5 * static_cast<double>(i); });
+	const VD r = ccm::pp::asinh(x) + ccm::pp::acosh(x) + ccm::pp::atanh(x * 0.1) + ccm::pp::asinh(VD(std::numeric_limits<double>::quiet_NaN()));
+	EXPECT_EQ(std::fetestexcept(FE_ALL_EXCEPT & ~FE_INEXACT), 0);
+	EXPECT_TRUE(std::isnan(r[0]));
+	for (int i = 0; i < static_cast<int>(x.size()); ++i)
+	{
+		EXPECT_TRUE(bit_equal<double>(ccm::pp::acosh(x)[i], ccm::internal::impl::acosh_impl(x[i])));
+	}
+
+	// One lane below the domain of acosh raises FE_INVALID; the pole of atanh raises FE_DIVBYZERO.
+	VD mixed(2.0);
+	mixed[0]   = 0.5;
+	const VD a = ccm::internal::impl::acosh_simd_impl(mixed);
+	EXPECT_TRUE(std::isnan(a[0]));
+	EXPECT_NE(std::fetestexcept(FE_INVALID), 0);
+	EXPECT_EQ(std::fetestexcept(FE_DIVBYZERO), 0);
+	const VD p = ccm::internal::impl::atanh_simd_impl(VD(-1.0));
+	EXPECT_EQ(p[0], -std::numeric_limits<double>::infinity());
+	EXPECT_NE(std::fetestexcept(FE_DIVBYZERO), 0);
+	std::feclearexcept(FE_ALL_EXCEPT);
+}
+
+TEST(CcmathHyperSimd, ScalarKernelAccuracy)
+{
+	long double worst_float = 0;
+	for (float x : hyper_inputs<float>())
+	{
+		if (!std::isfinite(x) || std::fabs(x) > 89.0F) { continue; }
+		const auto xl = static_cast<long double>(x);
+		worst_float	  = std::max(worst_float, ulp_error(ccm::internal::impl::sinh_impl(x), std::sinh(xl)));
+		worst_float	  = std::max(worst_float, ulp_error(ccm::internal::impl::cosh_impl(x), std::cosh(xl)));
+		worst_float	  = std::max(worst_float, ulp_error(ccm::internal::impl::tanh_impl(x), std::tanh(xl)));
+	}
+	EXPECT_LE(worst_float, 0.5L + 0x1p-20L);
+
+	if constexpr (std::numeric_limits<long double>::digits > std::numeric_limits<double>::digits)
+	{
+		// sinh and cosh go through the product of two exps past the overflow threshold of exp.
+		long double worst_below = 0;
+		long double worst_above = 0;
+		for (double x : hyper_inputs<double>())
+		{
+			if (!std::isfinite(x) || std::fabs(x) > 710.4) { continue; }
+			const auto xl		= static_cast<long double>(x);
+			long double & worst = std::fabs(x) < 0x1.62e42fefa39efp+9 ? worst_below : worst_above;
+			worst				= std::max({ worst, ulp_error(ccm::internal::impl::sinh_impl(x), std::sinh(xl)), ulp_error(ccm::internal::impl::cosh_impl(x), std::cosh(xl)) });
+
+			worst_below = std::max(worst_below, ulp_error(ccm::internal::impl::tanh_impl(x), std::tanh(xl)));
+		}
+		EXPECT_LE(worst_below, 1.6L);
+		EXPECT_LE(worst_above, 2.0L);
+	}
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include "ccmath/math/hyper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+namespace
+{
+	// Within two ulps of the long double reference, which covers both the libm builtins and the generic kernels.
+	template <typename T>
+	void expect_close(T got, long double ref)
+	{
+		const T r = static_cast<T>(ref);
+		EXPECT_NEAR(got, r, 2 * std::fabs(std::nextafter(r, std::numeric_limits<T>::infinity()) - r)) << "ref=" << r;
+	}
+} // namespace
+
+static_assert(ccm::sinh(0.0) == 0.0);
+static_assert(ccm::cosh(0.0) == 1.0);
+static_assert(ccm::tanh(0.0F) == 0.0F);
+
+TEST(CcmathHyperTests, Sinh)
+{
+	for (const double x : { 1e-9, 0.1, 0.5, 0.99, 1.0, 2.5, 10.0, 21.9, 22.5, 100.0, 709.0, 710.0 })
+	{
+		expect_close(ccm::sinh(x), std::sinh(static_cast<long double>(x)));
+		expect_close(ccm::sinh(-x), -std::sinh(static_cast<long double>(x)));
+		expect_close(ccm::sinhf(static_cast<float>(x / 8)), std::sinh(static_cast<long double>(static_cast<float>(x / 8))));
+	}
+	EXPECT_TRUE(std::signbit(ccm::sinh(-0.0)));
+	EXPECT_EQ(ccm::sinh(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::sinh(-std::numeric_limits<double>::infinity()), -std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::sinh(711.0), std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::sinh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::sinh(2), ccm::sinh(2.0));
+}
+
+TEST(CcmathHyperTests, Cosh)
+{
+	for (const double x : { 1e-9, 0.1, 0.5, 0.99, 1.0, 2.5, 10.0, 21.9, 22.5, 100.0, 709.0, 710.0 })
+	{
+		expect_close(ccm::cosh(x), std::cosh(static_cast<long double>(x)));
+		EXPECT_EQ(ccm::cosh(-x), ccm::cosh(x));
+		expect_close(ccm::coshf(static_cast<float>(x / 8)), std::cosh(static_cast<long double>(static_cast<float>(x / 8))));
+	}
+	EXPECT_EQ(ccm::cosh(-std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::cosh(-711.0), std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::cosh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::cosh(3), ccm::cosh(3.0));
+}
+
+TEST(CcmathHyperTests, Tanh)
+{
+	for (const double x : { 1e-9, 0.1, 0.25, 0.5, 0.99, 1.0, 2.5, 10.0, 21.9 })
+	{
+		expect_close(ccm::tanh(x), std::tanh(static_cast<long double>(x)));
+		expect_close(ccm::tanh(-x), -std::tanh(static_cast<long double>(x)));
+		expect_close(ccm::tanhf(static_cast<float>(x)), std::tanh(static_cast<long double>(static_cast<float>(x))));
+	}
+	EXPECT_EQ(ccm::tanh(30.0), 1.0);
+	EXPECT_EQ(ccm::tanh(-std::numeric_limits<double>::infinity()), -1.0);
+	EXPECT_TRUE(std::signbit(ccm::tanh(-0.0)));
+	EXPECT_TRUE(std::isnan(ccm::tanh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::tanhl(0.5L), ccm::tanh(0.5L));
+}
+
+TEST(CcmathHyperTests, SinhcoshMatchesSinhAndCosh)
+{
+	for (const double x : { -710.0, -30.0, -2.0, -0.5, -1e-12, 0.0, 0.75, 1.0, 5.0, 25.0, 709.5 })
+	{
+		double s = 0.0;
+		double c = 0.0;
+		ccm::sinhcosh(x, &s, &c);
+		EXPECT_EQ(s, ccm::sinh(x)) << "x=" << x;
+		EXPECT_EQ(c, ccm::cosh(x)) << "x=" << x;
+
+		const auto [sf, cf] = ccm::sinhcosh(static_cast<float>(x / 16));
+		EXPECT_EQ(sf, ccm::sinh(static_cast<float>(x / 16)));
+		EXPECT_EQ(cf, ccm::cosh(static_cast<float>(x / 16)));
+	}
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include "ccmath/internal/math/generic/func/hyper/impl/inv_hyper_impl.hpp"
+#include "ccmath/math/hyper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace
+{
+	// Within two ulps of the long double reference, which covers both the libm builtins and the generic kernels.
+	template <typename T>
+	void expect_close(T got, long double ref)
+	{
+		const T r = static_cast<T>(ref);
+		EXPECT_NEAR(got, r, 2 * std::fabs(std::nextafter(r, std::numeric_limits<T>::infinity()) - r)) << "ref=" << r;
+	}
+
+	double ulp_error(double got, long double ref)
+	{
+		int e = 0;
+		std::frexp(static_cast<double>(ref), &e);
+		return static_cast<double>(std::fabs(static_cast<long double>(got) - ref) / std::ldexp(1.0L, e - 53));
+	}
+} // namespace
+
+static_assert(ccm::asinh(0.0) == 0.0);
+static_assert(ccm::acosh(1.0) == 0.0);
+static_assert(ccm::atanh(0.0F) == 0.0F);
+
+TEST(CcmathInvHyperTests, Asinh)
+{
+	for (const double x : { 1e-12, 0.1, 0.35, 0.5, 1.0, 1.9, 2.0, 2.1, 10.0, 1e5, 3e8, 1e30 })
+	{
+		expect_close(ccm::asinh(x), std::asinh(static_cast<long double>(x)));
+		expect_close(ccm::asinh(-x), -std::asinh(static_cast<long double>(x)));
+		expect_close(ccm::asinhf(static_cast<float>(x / 8)), std::asinh(static_cast<long double>(static_cast<float>(x / 8))));
+	}
+	EXPECT_TRUE(std::signbit(ccm::asinh(-0.0)));
+	EXPECT_EQ(ccm::asinh(-std::numeric_limits<double>::infinity()), -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::asinh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::asinh(2), ccm::asinh(2.0));
+}
+
+TEST(CcmathInvHyperTests, Acosh)
+{
+	for (const double x : { 1.0, 1.0 + 1e-12, 1.06, 1.5, 2.0, 2.1, 10.0, 1e5, 3e8, 1e30 })
+	{
+		expect_close(ccm::acosh(x), std::acosh(static_cast<long double>(x)));
+		expect_close(ccm::acoshf(static_cast<float>(x)), std::acosh(static_cast<long double>(static_cast<float>(x))));
+	}
+	EXPECT_EQ(ccm::acosh(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::acosh(0.5)));
+	EXPECT_TRUE(std::isnan(ccm::acosh(-std::numeric_limits<double>::infinity())));
+	EXPECT_TRUE(std::isnan(ccm::acosh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::acoshl(3.0L), ccm::acosh(3.0L));
+}
+
+TEST(CcmathInvHyperTests, Atanh)
+{
+	for (const double x : { 1e-12, 0.1, 0.17, 0.49, 0.5, 0.75, 0.999, 1.0 - 0x1p-40 })
+	{
+		expect_close(ccm::atanh(x), std::atanh(static_cast<long double>(x)));
+		expect_close(ccm::atanh(-x), -std::atanh(static_cast<long double>(x)));
+		expect_close(ccm::atanhf(static_cast<float>(x / 2)), std::atanh(static_cast<long double>(static_cast<float>(x / 2))));
+	}
+	EXPECT_EQ(ccm::atanh(1.0), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::atanh(-1.0), -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::atanh(1.5)));
+	EXPECT_TRUE(std::signbit(ccm::atanh(-0.0)));
+}
+
+TEST(CcmathInvHyperTests, GenericKernelsStayWithinBound)
+{
+	std::mt19937_64 rng(18);
+	std::uniform_real_distribution<double> unit(0.0, 1.0);
+	double worst = 0.0;
+	for (int i = 0; i < 20000; ++i)
+	{
+		const double s = std::ldexp(1.0 + unit(rng), static_cast<int>(unit(rng) * 40.0) - 30);
+		const double c = 1.0 + std::ldexp(unit(rng), static_cast<int>(unit(rng) * 40.0) - 30);
+		const double t = unit(rng);
+		worst		   = std::max(worst, ulp_error(ccm::internal::impl::asinh_double_impl(s), std::asinh(static_cast<long double>(s))));
+		worst		   = std::max(worst, ulp_error(ccm::internal::impl::acosh_double_impl(c), std::acosh(static_cast<long double>(c))));
+		worst		   = std::max(worst, ulp_error(ccm::internal::impl::atanh_double_impl(t), std::atanh(static_cast<long double>(t))));
+	}
+	EXPECT_LT(worst, 2.5);
+}
+
+TEST(CcmathInvHyperTests, DomainAndPoleErrorsSetErrno)
+{
+	if ((math_errhandling & MATH_ERRNO) == 0) { GTEST_SKIP(); }
+	errno = 0;
+	static_cast<void>(ccm::internal::impl::acosh_double_impl(0.5));
+	EXPECT_EQ(errno, EDOM);
+	errno = 0;
+	static_cast<void>(ccm::internal::impl::atanh_double_impl(2.0));
+	EXPECT_EQ(errno, EDOM);
+	errno = 0;
+	static_cast<void>(ccm::internal::impl::atanh_double_impl(-1.0));
+	EXPECT_EQ(errno, ERANGE);
+}
@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// Cross-ABI equivalence of the vector kernels. Every lane kernel is run at every pp width the
+// element type supports, through the runtime-dispatched ccm::batch entry points and, in a
+// deterministic build, through the scalar public functions, and each result must carry the same
+// bits as the generic scalar kernel. tests/unit/CMakeLists.txt compiles this file once more per
+// instruction set with CCM_CONFIG_DETERMINISTIC defined; those builds also check a digest of the
+// scalar results against a fixed value, so every instruction set is pinned to the same bits.
+
+#include "ccmath/ccmath.hpp"
+#include "ccmath/internal/math/generic/func/expo/exp2_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/exp_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log10_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log2_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/pow_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/pow_impl/pow_simd_impl.hpp"
+#include "ccmath/internal/math/generic/func/trig/acos_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/asin_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/atan2_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/atan_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/cos_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/sin_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/tan_gen.hpp"
+#include "ccmath/internal/math/runtime/batch/batch_dispatch.hpp"
+#include "ccmath/math/expo/impl/exp2_simd_impl.hpp"
+#include "ccmath/math/expo/impl/exp_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log10_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log2_simd_impl.hpp"
+#include "ccmath/math/expo/impl/log_domain_impl.hpp"
+#include "ccmath/math/expo/impl/log_simd_impl.hpp"
+#include "ccmath/math/trig/impl/inv_trig_simd_impl.hpp"
+#include "ccmath/math/trig/impl/sincos_simd_impl.hpp"
+#include "ccmath/math/trig/impl/tan_simd_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	namespace bi   = ccm::rt::batch_impl;
+	namespace impl = ccm::internal::impl;
+
+	template <typename T>
+	using bits_t = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
+	template <typename T>
+	bits_t<T> float_bits(T value)
+	{
+		bits_t<T> out{};
+		std::memcpy(&out, &value, sizeof(out));
+		return out;
+	}
+
+	template <typename T>
+	T from_bits(bits_t<T> bits)
+	{
+		T out{};
+		std::memcpy(&out, &bits, sizeof(out));
+		return out;
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	// splitmix64. The standard distributions are implementation defined, so the inputs are built
+	// from raw generator output with exact integer arithmetic and identical on every host.
+	struct input_source
+	{
+		std::uint64_t state;
+
+		std::uint64_t next()
+		{
+			std::uint64_t z = (state += 0x9e37'79b9'7f4a'7c15ULL);
+			z				= (z ^ (z >> 30)) * 0xbf58'476d'1ce4'e5b9ULL;
+			z				= (z ^ (z >> 27)) * 0x94d0'49bb'1331'11ebULL;
+			return z ^ (z >> 31);
+		}
+
+		// Uniform in [lo, hi): a 53-bit fraction scaled in double, then rounded once to T.
+		template <typename T>
+		T uniform(double lo, double hi)
+		{
+			const double u = static_cast<double>(next() >> 11) * 0x1.0p-53;
+			return static_cast<T>(lo + (hi - lo) * u);
+		}
+
+		// Any bit pattern, so subnormals, huge magnitudes, infinities and NaN all show up.
+		template <typename T>
+		T any()
+		{ return from_bits<T>(static_cast<bits_t<T>>(next())); }
+	};
+
+	// Special values, a dense range where the main path of the kernel lives, and raw bit patterns.
+	// The count is not a multiple of any vector width, so every loop also runs a scalar tail.
+	template <typename T>
+	std::vector<T> build_inputs(std::uint64_t seed, double lo, double hi)
+	{
+		constexpr T inf = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0), T(-0.0), T(1), T(-1), T(0.5), inf, -inf, std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), T(1e-30), T(100), T(-100), T(1e6), T(-1e6) };
+
+		input_source source{ seed };
+		for (int i = 0; i < 3000; ++i) { xs.push_back(source.uniform<T>(lo, hi)); }
+		for (int i = 0; i < 1001; ++i) { xs.push_back(source.any<T>()); }
+		return xs;
+	}
+
+	// FNV-1a over the result bits, with every NaN folded to one value.
+	template <typename T>
+	std::uint64_t digest(std::vector<T> const & values)
+	{
+		std::uint64_t hash = 0xcbf2'9ce4'8422'2325ULL;
+		for (const T v : values)
+		{
+			const std::uint64_t word = std::isnan(v) ? 0x7ff8'0000'0000'0000ULL : static_cast<std::uint64_t>(float_bits(v));
+			for (int byte = 0; byte < 8; ++byte)
+			{
+				hash ^= (word >> (8 * byte)) & 0xffU;
+				hash *= 0x100'0000'01b3ULL;
+			}
+		}
+		return hash;
+	}
+
+	// Runs the block loop at lane count N when the element type supports it.
+	template <typename T, int N, typename VectorOp, typename ScalarFn>
+	void expect_unary_width(std::vector<T> const & xs, std::vector<T> const & expected, VectorOp vector_op, ScalarFn scalar_fn, const char * tag)
+	{
+		if constexpr (ccm::pp::VecAbi<N>::template IsValid<T>::value)
+		{
+			using V = ccm::pp::basic_simd<T, ccm::pp::VecAbi<N>>;
+			std::vector<T> out(xs.size());
+			bi::unary_blocks<V>(xs.data(), out.data(), xs.size(), vector_op, scalar_fn);
+			for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], expected[i])) << tag << " lanes=" << N << " x=" << xs[i]; }
+		}
+	}
+
+	template <typename T, int N, typename VectorOp, typename ScalarFn>
+	void expect_binary_width(std::vector<T> const & as, std::vector<T> const & bs, std::vector<T> const & expected, VectorOp vector_op, ScalarFn scalar_fn,
+							 const char * tag)
+	{
+		if constexpr (ccm::pp::VecAbi<N>::template IsValid<T>::value)
+		{
+			using V = ccm::pp::basic_simd<T, ccm::pp::VecAbi<N>>;
+			std::vector<T> out(as.size());
+			bi::binary_blocks<V>(as.data(), bs.data(), out.data(), as.size(), vector_op, scalar_fn);
+			for (std::size_t i = 0; i < as.size(); ++i)
+			{
+				EXPECT_TRUE(bit_equal(out[i], expected[i])) << tag << " lanes=" << N << " a=" << as[i] << " b=" << bs[i];
+			}
+		}
+	}
+
+	// Checks one unary kernel everywhere it can run and returns the digest of the scalar results.
+	template <typename T, typename VectorOp, typename ScalarFn, typename BatchFn, typename PublicFn>
+	std::uint64_t expect_unary_everywhere(std::vector<T> const & xs, VectorOp vector_op, ScalarFn scalar_fn, BatchFn batch_fn, PublicFn public_fn,
+										  const char * tag)
+	{
+		std::vector<T> expected(xs.size());
+		for (std::size_t i = 0; i < xs.size(); ++i) { expected[i] = scalar_fn(xs[i]); }
+
+		expect_unary_width<T, 2>(xs, expected, vector_op, scalar_fn, tag);
+		expect_unary_width<T, 4>(xs, expected, vector_op, scalar_fn, tag);
+		expect_unary_width<T, 8>(xs, expected, vector_op, scalar_fn, tag);
+		expect_unary_width<T, 16>(xs, expected, vector_op, scalar_fn, tag);
+
+		// Whichever tier the running CPU selects.
+		std::vector<T> out(xs.size());
+		batch_fn(xs.data(), out.data(), xs.size());
+		for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], expected[i])) << tag << " batch x=" << xs[i]; }
+
+#ifdef CCM_CONFIG_DETERMINISTIC
+		// Deterministic builds keep libm out of the runtime entry points, so they land on the same bits too.
+		for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(public_fn(xs[i]), expected[i])) << tag << " public x=" << xs[i]; }
+#else
+		static_cast<void>(public_fn);
+#endif
+		return digest(expected);
+	}
+
+	template <typename T>
+	struct family_digests
+	{
+		std::uint64_t exp;
+		std::uint64_t exp2;
+		std::uint64_t log;
+		std::uint64_t log2;
+		std::uint64_t log10;
+		std::uint64_t sin;
+		std::uint64_t cos;
+		std::uint64_t tan;
+		std::uint64_t asin;
+		std::uint64_t acos;
+		std::uint64_t atan;
+		std::uint64_t atan2;
+		std::uint64_t pow;
+	};
+
+	template <typename T>
+	family_digests<T> expect_family_everywhere()
+	{
+		family_digests<T> d{};
+
+		const std::vector<T> exp_in	  = build_inputs<T>(1, -110.0, 110.0);
+		const std::vector<T> log_in	  = build_inputs<T>(2, 0.0, 8.0);
+		const std::vector<T> trig_in  = build_inputs<T>(3, -200.0, 200.0);
+		const std::vector<T> unit_in  = build_inputs<T>(4, -1.125, 1.125);
+		const std::vector<T> atan_in  = build_inputs<T>(5, -20.0, 20.0);
+		const std::vector<T> base_in  = build_inputs<T>(6, 0.0, 16.0);
+		const std::vector<T> power_in = build_inputs<T>(7, -40.0, 40.0);
+
+		d.exp = expect_unary_everywhere(
+			exp_in, [](auto const & v) { return impl::exp_simd_impl(v); }, [](T x) { return ccm::gen::exp_gen(x); },
+			[](T const * in, T * out, std::size_t n) { ccm::batch::exp(in, out, n); }, [](T x) { return ccm::exp(x); }, "exp");
+		d.exp2 = expect_unary_everywhere(
+			exp_in, [](auto const & v) { return impl::exp2_simd_impl(v); }, [](T x) { return ccm::gen::exp2_gen(x); },
+			[](T const * in, T * out, std::size_t n) { ccm::batch::exp2(in, out, n); }, [](T x) { return ccm::exp2(x); }, "exp2");
+
+		constexpr auto log_kernel	= [](T v) { return ccm::gen::log_gen(v); };
+		constexpr auto log2_kernel	= [](T v) { return ccm::gen::log2_gen(v); };
+		constexpr auto log10_kernel = [](T v) { return ccm::gen::log10_gen(v); };
+		d.log = expect_unary_everywhere(
+			log_in, [=](auto const & v) { return impl::log_domain_or(v, [](auto const & w) { return impl::log_simd_impl(w); }, log_kernel); },
+			[=](T x) { return impl::log_domain_or(x, log_kernel); }, [](T const * in, T * out, std::size_t n) { ccm::batch::log(in, out, n); },
+			[](T x) { return ccm::log(x); }, "log");
+		d.log2 = expect_unary_everywhere(
+			log_in, [=](auto const & v) { return impl::log_domain_or(v, [](auto const & w) { return impl::log2_simd_impl(w); }, log2_kernel); },
+			[=](T x) { return impl::log_domain_or(x, log2_kernel); }, [](T const * in, T * out, std::size_t n) { ccm::batch::log2(in, out, n); },
+			[](T x) { return ccm::log2(x); }, "log2");
+		d.log10 = expect_unary_everywhere(
+			log_in, [=](auto const & v) { return impl::log_domain_or(v, [](auto const & w) { return impl::log10_simd_impl(w); }, log10_kernel); },
+			[=](T x) { return impl::log_domain_or(x, log10_kernel); }, [](T const * in, T * out, std::size_t n) { ccm::batch::log10(in, out, n); },
+			[](T x) { return ccm::log10(x); }, "log10");
+
+		d.sin = expect_unary_everywhere(
+			trig_in, [](auto const & v) { return impl::sin_simd_impl(v); }, [](T x) { return ccm::gen::sin_gen(x); },
+			[](T const * in, T * out, std::size_t n) { ccm::batch::sin(in, out, n); }, [](T x) { return ccm::sin(x); }, "sin");
+		d.cos = expect_unary_everywhere(
+			trig_in, [](auto const & v) { return impl::cos_simd_impl(v); }, [](T x) { return ccm::gen::cos_gen(x); },
+			[](T const * in, T * out, std::size_t n) { ccm::batch::cos(in, out, n); }, [](T x) { return ccm::cos(x); }, "cos");
+		d.tan = expect_unary_everywhere(
+			trig_in, [](auto const & v) { return impl::tan_simd_impl(v); }, [](T x) { return ccm::gen::tan_gen(x); },
+			[](T const * in, T * out, std::size_t n) { ccm::batch::tan(in, out, n); }, [](T x) { return ccm::tan(x); }, "tan");
+		d.asin = expect_unary_everywhere(
+			unit_in, [](auto const & v) { return impl::asin_simd_impl(v); }, [](T x) { return ccm::gen::asin_gen(x); },
+			[](T const * in, T * out, std::size_t n) { ccm::batch::asin(in, out, n); }, [](T x) { return ccm::asin(x); }, "asin");
+		d.acos = expect_unary_everywhere(
+			unit_in, [](auto const & v) { return impl::acos_simd_impl(v); }, [](T x) { return ccm::gen::acos_gen(x); },
+			[](T const * in, T * out, std::size_t n) { ccm::batch::acos(in, out, n); }, [](T x) { return ccm::acos(x); }, "acos");
+		d.atan = expect_unary_everywhere(
+			atan_in, [](auto const & v) { return impl::atan_simd_impl(v); }, [](T x) { return ccm::gen::atan_gen(x); },
+			[](T const * in, T * out, std::size_t n) { ccm::batch::atan(in, out, n); }, [](T x) { return ccm::atan(x); }, "atan");
+
+		// atan2 pairs the trig inputs with a shuffled copy of the atan inputs.
+		{
+			const auto atan2_op = [](auto const & y, auto const & x) { return impl::atan2_simd_impl(y, x); };
+			const auto atan2_fn = [](T y, T x) { return ccm::gen::atan2_gen(y, x); };
+			std::vector<T> expected(trig_in.size());
+			for (std::size_t i = 0; i < trig_in.size(); ++i) { expected[i] = atan2_fn(trig_in[i], atan_in[atan_in.size() - 1 - i]); }
+			const std::vector<T> xs(atan_in.rbegin(), atan_in.rend());
+
+			expect_binary_width<T, 2>(trig_in, xs, expected, atan2_op, atan2_fn, "atan2");
+			expect_binary_width<T, 4>(trig_in, xs, expected, atan2_op, atan2_fn, "atan2");
+			expect_binary_width<T, 8>(trig_in, xs, expected, atan2_op, atan2_fn, "atan2");
+			expect_binary_width<T, 16>(trig_in, xs, expected, atan2_op, atan2_fn, "atan2");
+
+			std::vector<T> out(trig_in.size());
+			ccm::batch::atan2(trig_in.data(), xs.data(), out.data(), out.size());
+			for (std::size_t i = 0; i < out.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], expected[i])) << "atan2 batch y=" << trig_in[i] << " x=" << xs[i]; }
+#ifdef CCM_CONFIG_DETERMINISTIC
+			for (std::size_t i = 0; i < out.size(); ++i) { EXPECT_TRUE(bit_equal(ccm::atan2(trig_in[i], xs[i]), expected[i])) << "atan2 public y=" << trig_in[i]; }
+#endif
+			d.atan2 = digest(expected);
+		}
+
+		// pow has no batch entry point; its lane kernel backs ccm::pow at run time.
+		{
+			const auto pow_op = [](auto const & b, auto const & e)
+			{
+				if constexpr (std::is_same_v<T, float>) { return ccm::gen::impl::powf_simd(b, e); }
+				else
+				{
+					return ccm::gen::impl::pow_simd(b, e);
+				}
+			};
+			const auto pow_fn = [](T b, T e) { return ccm::gen::pow_gen(b, e); };
+			std::vector<T> expected(base_in.size());
+			for (std::size_t i = 0; i < base_in.size(); ++i) { expected[i] = pow_fn(base_in[i], power_in[i]); }
+
+			expect_binary_width<T, 2>(base_in, power_in, expected, pow_op, pow_fn, "pow");
+			expect_binary_width<T, 4>(base_in, power_in, expected, pow_op, pow_fn, "pow");
+			expect_binary_width<T, 8>(base_in, power_in, expected, pow_op, pow_fn, "pow");
+			expect_binary_width<T, 16>(base_in, power_in, expected, pow_op, pow_fn, "pow");
+#ifdef CCM_CONFIG_DETERMINISTIC
+			for (std::size_t i = 0; i < base_in.size(); ++i)
+			{
+				EXPECT_TRUE(bit_equal(ccm::pow(base_in[i], power_in[i]), expected[i])) << "pow public base=" << base_in[i] << " exp=" << power_in[i];
+			}
+#endif
+			d.pow = digest(expected);
+		}
+		return d;
+	}
+
+#ifdef CCM_CONFIG_DETERMINISTIC
+	template <typename T>
+	void expect_digests(family_digests<T> const & got, family_digests<T> const & want)
+	{
+		// On a mismatch the printed value is what this build computes; a change that is meant to
+		// alter results updates the table below in the same commit.
+		EXPECT_EQ(got.exp, want.exp) << std::hex << "exp 0x" << got.exp;
+		EXPECT_EQ(got.exp2, want.exp2) << std::hex << "exp2 0x" << got.exp2;
+		EXPECT_EQ(got.log, want.log) << std::hex << "log 0x" << got.log;
+		EXPECT_EQ(got.log2, want.log2) << std::hex << "log2 0x" << got.log2;
+		EXPECT_EQ(got.log10, want.log10) << std::hex << "log10 0x" << got.log10;
+		EXPECT_EQ(got.sin, want.sin) << std::hex << "sin 0x" << got.sin;
+		EXPECT_EQ(got.cos, want.cos) << std::hex << "cos 0x" << got.cos;
+		EXPECT_EQ(got.tan, want.tan) << std::hex << "tan 0x" << got.tan;
+		EXPECT_EQ(got.asin, want.asin) << std::hex << "asin 0x" << got.asin;
+		EXPECT_EQ(got.acos, want.acos) << std::hex << "acos 0x" << got.acos;
+		EXPECT_EQ(got.atan, want.atan) << std::hex << "atan 0x" << got.atan;
+		EXPECT_EQ(got.atan2, want.atan2) << std::hex << "atan2 0x" << got.atan2;
+		EXPECT_EQ(got.pow, want.pow) << std::hex << "pow 0x" << got.pow;
+	}
+
+	// Digests of the scalar generic kernels over build_inputs, recorded once and shared by every
+	// instruction set and host. Deterministic builds route multiply_add through a correctly rounded
+	// fma and keep libm out, so the scalar kernels must reproduce them exactly.
+	constexpr family_digests<float> kFloatDigests = {
+		0xe53f'2c1a'a56c'3a62ULL, // exp
+		0x401c'b379'1b1a'72f1ULL, // exp2
+		0xf85a'31df'66ae'dc79ULL, // log
+		0xa5eb'6ee9'1ea1'b322ULL, // log2
+		0x1582'e8ec'4bbb'cb3cULL, // log10
+		0x14ce'92e6'f615'6dfdULL, // sin
+		0x5bc2'6817'5535'7677ULL, // cos
+		0x3d7d'c172'06a7'3d7dULL, // tan
+		0xfeff'087c'87f3'c959ULL, // asin
+		0xe28b'd2a5'1a1d'35b5ULL, // acos
+		0xdcab'c410'b139'3c96ULL, // atan
+		0x94fe'43cc'58e0'965aULL, // atan2
+		0x9eb6'3d25'8b01'31f5ULL, // pow
+	};
+	constexpr family_digests<double> kDoubleDigests = {
+		0xfd93'9a83'5af3'1cbdULL, // exp
+		0x1d8f'ff37'1157'a9e5ULL, // exp2
+		0x7d57'0c33'cd9f'df95ULL, // log
+		0x6cae'9543'f16a'360fULL, // log2
+		0x3cca'1013'5c9e'10d9ULL, // log10
+		0x7aec'd707'6fa0'5adcULL, // sin
+		0xe925'8e02'274f'bf73ULL, // cos
+		0x7771'ba75'c545'cbb3ULL, // tan
+		0xa7bb'dfea'04a1'c4b0ULL, // asin
+		0x1261'fa40'ff80'f6c3ULL, // acos
+		0x9735'26b6'1f17'f6deULL, // atan
+		0xdab8'9371'666f'b615ULL, // atan2
+		0x5504'6895'bb9d'30f8ULL, // pow
+	};
+#endif
+} // namespace
+
+TEST(CcmathDeterministicAbi, FloatKernelsMatchScalarAtEveryWidth)
+{
+	const family_digests<float> digests = expect_family_everywhere<float>();
+#ifdef CCM_CONFIG_DETERMINISTIC
+	expect_digests(digests, kFloatDigests);
+#else
+	static_cast<void>(digests);
+#endif
+}
+
+TEST(CcmathDeterministicAbi, DoubleKernelsMatchScalarAtEveryWidth)
+{
+	const family_digests<double> digests = expect_family_everywhere<double>();
+#ifdef CCM_CONFIG_DETERMINISTIC
+	expect_digests(digests, kDoubleDigests);
+#else
+	static_cast<void>(digests);
+#endif
+}
+
+TEST(CcmathDeterministicAbi, DeterministicBuildsKeepRuntimeSimd)
+{
+#if defined(CCM_CONFIG_DETERMINISTIC) && defined(CCM_CONFIG_USE_RT_SIMD)
+	// Vendor vector math libraries are not bit identical to the generic kernels.
+	#ifdef CCMATH_HAS_SIMD_SVML
+	ADD_FAILURE() << "SVML must stay off in deterministic builds";
+	#endif
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(__ARM_NEON) && defined(__aarch64__))
+		#ifndef CCMATH_HAS_SIMD
+	ADD_FAILURE() << "runtime SIMD should stay on in deterministic builds";
+		#endif
+	#endif
+#else
+	GTEST_SKIP() << "not a deterministic build with runtime SIMD";
+#endif
+}
+
+TEST(CcmathDeterministicAbi, UnoptimizedBuildsKeepCompileTimeSelection)
+{
+#if defined(__GNUC__) && !defined(__OPTIMIZE__)
+	// Without flattening, the AVX2 and AVX-512 copies would pass 256-bit vectors to kernels compiled
+	// for the baseline instruction set.
+	#if defined(CCMATH_HAS_RUNTIME_DISPATCH) || defined(CCMATH_HAS_RUNTIME_DISPATCH_AVX512)
+	ADD_FAILURE() << "runtime dispatch must stay off in unoptimized builds";
+	#endif
+	EXPECT_EQ(bi::selected_tier<float>(), bi::isa_tier::baseline);
+	EXPECT_EQ(bi::selected_tier<double>(), bi::isa_tier::baseline);
+#else
+	GTEST_SKIP() << "not an unoptimized GCC or Clang build";
+#endif
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// ccm::intrin::abi::avx512 only exists when the build targets AVX-512F. These tests pin its
+// k-register masks, the masked tail loads and stores, and the sqrt and pow ports.
+
+#include "ccmath/internal/math/runtime/simd/func/catalog.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+
+#ifdef CCMATH_HAS_SIMD_AVX512F
+namespace
+{
+	namespace ci = ccm::intrin;
+
+	template <typename T>
+	void expect_masks_and_tails()
+	{
+		using V					= ci::simd<T, ci::abi::avx512>;
+		using M					= typename V::mask_type;
+		constexpr int width		= V::size();
+		std::array<T, 32> input = {};
+		for (int i = 0; i < 32; ++i) { input[i] = static_cast<T>(i + 1); }
+
+		const V v(input.data(), ci::element_aligned_tag());
+		EXPECT_TRUE(ci::all_of(V(T(0)) < v));
+		EXPECT_FALSE(ci::any_of(v < V(T(0))));
+		EXPECT_TRUE(ci::any_of(v == V(T(3))));
+		EXPECT_FALSE(ci::all_of(v == V(T(3))));
+		EXPECT_TRUE(ci::all_of(!(v < V(T(1)))));
+		EXPECT_TRUE(ci::all_of(M(true) && M(true)));
+		EXPECT_FALSE(ci::any_of(M(false) || M(false)));
+
+		// choose takes b where the mask is set and c elsewhere.
+		std::array<T, 32> chosen = {};
+		ci::choose(v < V(T(3)), V(T(-1)), v).copy_to(chosen.data(), ci::element_aligned_tag());
+		for (int i = 0; i < width; ++i) { EXPECT_EQ(chosen[i], i < 2 ? T(-1) : input[i]); }
+
+		// A masked load reads only the first count lanes and a masked store writes only those.
+		for (int count = 0; count <= width; ++count)
+		{
+			V tail;
+			tail.copy_from(input.data(), M::first_n(count));
+			std::array<T, 32> out;
+			out.fill(T(-7));
+			tail.copy_to(out.data(), M::first_n(count));
+			for (int i = 0; i < 32; ++i) { EXPECT_EQ(out[i], i < count ? input[i] : T(-7)) << "count=" << count << " i=" << i; }
+		}
+
+		// Strided construction.
+		const V strided(input.data(), 2);
+		std::array<T, 32> out = {};
+		strided.copy_to(out.data(), ci::element_aligned_tag());
+		for (int i = 0; i < width; ++i) { EXPECT_EQ(out[i], input[2 * i]); }
+	}
+
+	template <typename T>
+	void expect_sqrt_and_pow()
+	{
+		using V = ci::simd<T, ci::abi::avx512>;
+
+		std::array<T, 16> out = {};
+		ci::sqrt(V(T(2))).copy_to(out.data(), ci::element_aligned_tag());
+		for (int i = 0; i < V::size(); ++i) { EXPECT_EQ(out[i], std::sqrt(T(2))); }
+
+		EXPECT_EQ(ci::pow(V(T(2)), V(T(10))).convert(), T(1024));
+	}
+} // namespace
+
+TEST(CcmathIntrinAvx512, MasksAndTailsFloat)
+{
+	expect_masks_and_tails<float>();
+}
+
+TEST(CcmathIntrinAvx512, MasksAndTailsDouble)
+{
+	expect_masks_and_tails<double>();
+}
+
+TEST(CcmathIntrinAvx512, SqrtAndPow)
+{
+	expect_sqrt_and_pow<float>();
+	expect_sqrt_and_pow<double>();
+}
+#else
+TEST(CcmathIntrinAvx512, Unavailable)
+{
+	GTEST_SKIP() << "the build does not target AVX-512F";
+}
+#endif
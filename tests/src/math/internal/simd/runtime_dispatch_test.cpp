@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The batch drivers pick an instruction set tier at runtime. These tests pin that the host query
+// agrees with what the compiler was allowed to assume, that the tier choice follows the query, and
+// that the AVX2 and AVX-512 copies of the block loop are bit identical to the compile-time
+// native_simd loop, including the masked AVX-512VL tail.
+
+#include "ccmath/internal/math/generic/func/expo/exp_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/atan_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/sin_gen.hpp"
+#include "ccmath/internal/math/runtime/batch/batch_dispatch.hpp"
+#include "ccmath/internal/support/cpu_features.hpp"
+#include "ccmath/math/expo/impl/exp_simd_impl.hpp"
+#include "ccmath/math/trig/impl/inv_trig_simd_impl.hpp"
+#include "ccmath/math/trig/impl/sincos_simd_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	namespace bi = ccm::rt::batch_impl;
+
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	template <typename T>
+	std::vector<T> build_inputs()
+	{
+		std::vector<T> xs = { T(0), T(-0.0), T(1e-30), T(0.5), T(-3), std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN(), T(1e6) };
+
+		std::mt19937_64 rng(20260710ULL);
+		std::uniform_real_distribution<T> dist(T(-80), T(80));
+		for (int i = 0; i < 4000; ++i) { xs.push_back(dist(rng)); }
+		return xs;
+	}
+
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH
+	template <typename T, typename WideLoop, typename VectorOp, typename ScalarFn>
+	void expect_wide_matches_baseline(WideLoop wide_loop, VectorOp vector_op, ScalarFn scalar_fn, const char * tag)
+	{
+		const std::vector<T> xs = build_inputs<T>();
+
+		// Every length up to a few vector widths, so each tail length is exercised. The sentinel
+		// past the end catches a masked store that writes too many lanes.
+		for (std::size_t n = 0; n <= 40; ++n)
+		{
+			std::vector<T> wide(n + 1, T(-12345));
+			std::vector<T> base(n);
+			wide_loop(xs.data(), wide.data(), n, vector_op, scalar_fn);
+			bi::unary_blocks<ccm::pp::native_simd<T>>(xs.data(), base.data(), n, vector_op, scalar_fn);
+			for (std::size_t i = 0; i < n; ++i) { EXPECT_TRUE(bit_equal(wide[i], base[i])) << tag << " n=" << n << " x=" << xs[i]; }
+			EXPECT_EQ(wide[n], T(-12345)) << tag << " wrote past the end for n=" << n;
+		}
+
+		std::vector<T> wide(xs.size());
+		std::vector<T> base(xs.size());
+		wide_loop(xs.data(), wide.data(), xs.size(), vector_op, scalar_fn);
+		bi::unary_blocks<ccm::pp::native_simd<T>>(xs.data(), base.data(), xs.size(), vector_op, scalar_fn);
+		for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(wide[i], base[i])) << tag << " x=" << xs[i]; }
+	}
+
+	template <typename T, typename WideLoop>
+	void expect_wide_family(WideLoop wide_loop)
+	{
+		expect_wide_matches_baseline<T>(wide_loop, [](auto const & v) { return ccm::internal::impl::sin_simd_impl(v); }, [](T x) { return ccm::gen::sin_gen(x); }, "sin");
+		expect_wide_matches_baseline<T>(wide_loop, [](auto const & v) { return ccm::internal::impl::exp_simd_impl(v); }, [](T x) { return ccm::gen::exp_gen(x); }, "exp");
+		expect_wide_matches_baseline<T>(wide_loop, [](auto const & v) { return ccm::internal::impl::atan_simd_impl(v); }, [](T x) { return ccm::gen::atan_gen(x); },
+										"atan");
+	}
+
+	template <typename T>
+	void expect_avx2_family()
+	{
+		expect_wide_family<T>([](T const * in, T * out, std::size_t n, auto op, auto fn) { bi::unary_avx2(in, out, n, op, fn); });
+	}
+
+#endif
+
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH_AVX512
+	template <typename T>
+	void expect_avx512_family()
+	{
+		expect_wide_family<T>([](T const * in, T * out, std::size_t n, auto op, auto fn) { bi::unary_avx512(in, out, n, op, fn); });
+	}
+#endif
+} // namespace
+
+TEST(CcmathRuntimeDispatch, HostFeaturesCoverCompileTimeAssumptions)
+{
+	const ccm::support::cpu_features & features = ccm::support::host_cpu_features();
+
+	// The binary is running, so whatever the compiler assumed is present.
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+	EXPECT_TRUE(features.sse2);
+#endif
+#if defined(__AVX2__) && (defined(__GNUC__) || defined(__clang__))
+	EXPECT_TRUE(features.avx2);
+#endif
+#if defined(__AVX512F__) && (defined(__GNUC__) || defined(__clang__))
+	EXPECT_TRUE(features.avx512f);
+#endif
+
+	// Each extension implies the one it builds on.
+	if (features.avx2) { EXPECT_TRUE(features.avx); }
+	if (features.avx) { EXPECT_TRUE(features.sse4_2); }
+	if (features.sse4_2) { EXPECT_TRUE(features.sse4_1); }
+	if (features.avx512dq || features.avx512bw || features.avx512vl) { EXPECT_TRUE(features.avx512f); }
+
+	// The query is cached: every call returns the same object.
+	EXPECT_EQ(&features, &ccm::support::host_cpu_features());
+}
+
+TEST(CcmathRuntimeDispatch, TierFollowsHostFeatures)
+{
+	// Only float and double have vector kernels.
+	EXPECT_EQ(bi::selected_tier<long double>(), bi::isa_tier::baseline);
+	EXPECT_EQ(bi::selected_tier<int>(), bi::isa_tier::baseline);
+
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH
+	// The widest tier the host runs that is wider than the compile-time native_simd.
+	const ccm::support::cpu_features & features = ccm::support::host_cpu_features();
+	const std::size_t native_bytes				= ccm::pp::native_simd<float>::size() * sizeof(float);
+	bi::isa_tier expected						= bi::isa_tier::baseline;
+	if (native_bytes < 32 && features.avx2) { expected = bi::isa_tier::avx2; }
+	#ifdef CCMATH_HAS_RUNTIME_DISPATCH_AVX512
+	if (native_bytes < 64 && features.avx512f && features.avx512dq && features.avx512bw && features.avx512vl) { expected = bi::isa_tier::avx512; }
+	#endif
+	EXPECT_EQ(bi::selected_tier<float>(), expected);
+	EXPECT_EQ(bi::selected_tier<double>(), expected);
+#else
+	EXPECT_EQ(bi::selected_tier<float>(), bi::isa_tier::baseline);
+	EXPECT_EQ(bi::selected_tier<double>(), bi::isa_tier::baseline);
+#endif
+}
+
+TEST(CcmathRuntimeDispatch, Avx2LoopMatchesBaselineLoop)
+{
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH
+	if (!ccm::support::host_cpu_features().avx2) { GTEST_SKIP() << "the running CPU does not report AVX2"; }
+	expect_avx2_family<float>();
+	expect_avx2_family<double>();
+#else
+	GTEST_SKIP() << "runtime dispatch is not available in this build";
+#endif
+}
+
+TEST(CcmathRuntimeDispatch, Avx512LoopMatchesBaselineLoop)
+{
+#ifdef CCMATH_HAS_RUNTIME_DISPATCH_AVX512
+	const ccm::support::cpu_features & features = ccm::support::host_cpu_features();
+	if (!(features.avx512f && features.avx512dq && features.avx512bw && features.avx512vl)) { GTEST_SKIP() << "the running CPU does not report AVX-512F/DQ/BW/VL"; }
+	expect_avx512_family<float>();
+	expect_avx512_family<double>();
+#else
+	GTEST_SKIP() << "the AVX-512 tier is not available in this build";
+#endif
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include <ccmath/ccmath.hpp>
+#include <ccmath/math/misc/assume_round_to_nearest.hpp>
+
+#include <cfenv>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	namespace fenv = ccm::support::fenv;
+
+	// Restores the rounding mode the test started in, whatever the test body did.
+	class RoundingModeRestorer
+	{
+	public:
+		RoundingModeRestorer() : m_saved(std::fegetround()) {}
+		~RoundingModeRestorer() { std::fesetround(m_saved); }
+		RoundingModeRestorer(RoundingModeRestorer const &)			   = delete;
+		RoundingModeRestorer & operator=(RoundingModeRestorer const &) = delete;
+
+	private:
+		int m_saved;
+	};
+} // namespace
+
+TEST(CcmathAssumeRoundToNearest, OutsideAScopeTheModeIsReadEveryCall)
+{
+	const RoundingModeRestorer restorer;
+	EXPECT_EQ(fenv::internal::cached_rounding_mode, fenv::internal::unknown_rounding_mode);
+
+	ASSERT_EQ(std::fesetround(FE_UPWARD), 0);
+	EXPECT_EQ(fenv::get_rounding_mode(), FE_UPWARD);
+	EXPECT_TRUE(fenv::rounding_mode_is_round_up());
+
+	// The fenv wrapper does not start tracking the mode on its own.
+	ASSERT_EQ(fenv::internal::set_round(FE_TOWARDZERO), 0);
+	EXPECT_EQ(fenv::internal::cached_rounding_mode, fenv::internal::unknown_rounding_mode);
+	EXPECT_EQ(fenv::get_rounding_mode(), FE_TOWARDZERO);
+}
+
+TEST(CcmathAssumeRoundToNearest, ScopeSuppliesTheModeWithoutQueryingIt)
+{
+	const RoundingModeRestorer restorer;
+	ASSERT_EQ(std::fesetround(FE_TONEAREST), 0);
+	{
+		const ccm::assume_round_to_nearest scope;
+		EXPECT_EQ(fenv::get_rounding_mode(), FE_TONEAREST);
+
+		// A direct fesetround breaks the scope's precondition; the cached value shows it is not re-read.
+		ASSERT_EQ(std::fesetround(FE_DOWNWARD), 0);
+		EXPECT_EQ(fenv::get_rounding_mode(), FE_TONEAREST);
+		ASSERT_EQ(std::fesetround(FE_TONEAREST), 0);
+	}
+	EXPECT_EQ(fenv::internal::cached_rounding_mode, fenv::internal::unknown_rounding_mode);
+}
+
+TEST(CcmathAssumeRoundToNearest, FenvWrapperKeepsTheCacheCurrent)
+{
+	const RoundingModeRestorer restorer;
+
+	// Computed with the mode queried on every call.
+	ASSERT_EQ(std::fesetround(FE_UPWARD), 0);
+	const double queried = ccm::exp(0.3);
+	ASSERT_EQ(std::fesetround(FE_TONEAREST), 0);
+
+	const ccm::assume_round_to_nearest scope;
+	ASSERT_EQ(fenv::internal::set_round(FE_UPWARD), 0);
+	EXPECT_EQ(std::fegetround(), FE_UPWARD);
+	EXPECT_EQ(fenv::get_rounding_mode(), FE_UPWARD);
+	EXPECT_TRUE(fenv::rounding_mode_is_round_up());
+	EXPECT_EQ(ccm::exp(0.3), queried);
+
+	ASSERT_EQ(fenv::internal::set_round(FE_TONEAREST), 0);
+	EXPECT_EQ(fenv::get_rounding_mode(), FE_TONEAREST);
+}
+
+TEST(CcmathAssumeRoundToNearest, ScopesNestAndRestore)
+{
+	const RoundingModeRestorer restorer;
+	ASSERT_EQ(std::fesetround(FE_TONEAREST), 0);
+	{
+		const ccm::assume_round_to_nearest outer;
+		ASSERT_EQ(fenv::internal::set_round(FE_TOWARDZERO), 0);
+		ASSERT_EQ(fenv::internal::set_round(FE_TONEAREST), 0);
+		{
+			const ccm::assume_round_to_nearest inner;
+			EXPECT_EQ(fenv::internal::cached_rounding_mode, FE_TONEAREST);
+		}
+		EXPECT_EQ(fenv::internal::cached_rounding_mode, FE_TONEAREST);
+	}
+	EXPECT_EQ(fenv::internal::cached_rounding_mode, fenv::internal::unknown_rounding_mode);
+}
+
+TEST(CcmathAssumeRoundToNearest, ScopeIsPerThread)
+{
+	const ccm::assume_round_to_nearest scope;
+	int seen = FE_TONEAREST;
+	std::thread worker([&seen] { seen = fenv::internal::cached_rounding_mode; });
+	worker.join();
+	EXPECT_EQ(seen, fenv::internal::unknown_rounding_mode);
+}
+
+TEST(CcmathAssumeRoundToNearest, RuntimeResultsAreUnchanged)
+{
+	std::vector<double> inputs;
+	for (int i = -40; i <= 40; ++i) { inputs.push_back(0.37 * i); }
+
+	std::vector<double> expected;
+	std::vector<float> expected_f;
+	for (const double x : inputs)
+	{
+		expected.push_back(ccm::exp(x) + ccm::log(1.0 + x * x) + ccm::pow(1.5, x) + ccm::sin(x));
+		expected_f.push_back(ccm::expf(static_cast<float>(x)) + ccm::sqrt(static_cast<float>(x * x)));
+	}
+
+	const ccm::assume_round_to_nearest scope;
+	for (std::size_t i = 0; i < inputs.size(); ++i)
+	{
+		const double x = inputs[i];
+		EXPECT_EQ(ccm::exp(x) + ccm::log(1.0 + x * x) + ccm::pow(1.5, x) + ccm::sin(x), expected[i]) << "x=" << x;
+		EXPECT_EQ(ccm::expf(static_cast<float>(x)) + ccm::sqrt(static_cast<float>(x * x)), expected_f[i]) << "x=" << x;
+	}
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// Runs in the misc suite, where path stats are compiled out, and again as
+// ccmath-simple-path-stats with CCM_CONFIG_ENABLE_PATH_STATS defined.
+
+#include <gtest/gtest.h>
+
+#include <ccmath/internal/math/generic/func/power/pow_impl/pow_impl.hpp>
+#include <ccmath/internal/math/runtime/pp/pp.hpp>
+#include <ccmath/math/expo/impl/log_double_impl.hpp>
+#include <ccmath/math/expo/impl/log_simd_impl.hpp>
+#include <ccmath/math/misc/path_stats.hpp>
+#include <ccmath/math/trig/impl/sincos_double_impl.hpp>
+#include <ccmath/math/trig/impl/sincos_simd_impl.hpp>
+
+#include <iterator>
+#include <limits>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using ccm::path_stats::path;
+
+	// Expected count when the build counts, zero otherwise.
+	constexpr std::uint64_t counted(std::uint64_t n)
+	{ return ccm::path_stats::enabled ? n : 0; }
+
+	// Constant evaluation must not touch the counters, and must still compile with them on.
+	constexpr double kConstexprPow = ccm::gen::impl::pow_impl(2.0, 0.75);
+	constexpr double kConstexprLog = ccm::internal::log_double(3.0);
+} // namespace
+
+TEST(CcmathPathStats, NamesAreUniqueAndQualified)
+{
+	std::set<std::string> seen;
+	for (std::size_t i = 0; i < ccm::path_stats::path_count; ++i)
+	{
+		const std::string name = ccm::path_stats::name(static_cast<path>(i));
+		EXPECT_NE(name.find('.'), std::string::npos) << name;
+		EXPECT_TRUE(seen.insert(name).second) << name;
+	}
+	EXPECT_STREQ(ccm::path_stats::name(path::pow_double_double), "pow.double_double");
+	EXPECT_STREQ(ccm::path_stats::name(path::log_lane_scalar_fallback), "log.lane_scalar_fallback");
+}
+
+TEST(CcmathPathStats, PowBranchesAreCounted)
+{
+	ccm::path_stats::reset();
+	volatile double base = 2.0;
+	volatile double tiny = 0x1.0p-1060;
+	static_cast<void>(ccm::gen::impl::pow_impl(base, 0.75));	   // double-double
+	static_cast<void>(ccm::gen::impl::pow_impl(base, 3.0));	   // integer exponent
+	static_cast<void>(ccm::gen::impl::pow_impl(base, 2.5));	   // half-integer exponent
+	static_cast<void>(ccm::gen::impl::pow_impl(base, 0.0));	   // special operand
+	static_cast<void>(ccm::gen::impl::pow_impl(base, 700.3));	   // 2^+512 scaled range
+	static_cast<void>(ccm::gen::impl::pow_impl(base, 0x1.0p100)); // clamped overflow
+	static_cast<void>(ccm::gen::impl::pow_impl(tiny, 0.25));	   // subnormal base
+
+	const auto s = ccm::path_stats::snapshot();
+	EXPECT_EQ(s[path::pow_double_double], counted(1));
+	EXPECT_EQ(s[path::pow_integer_exponent], counted(1));
+	EXPECT_EQ(s[path::pow_half_integer_exponent], counted(1));
+	EXPECT_EQ(s[path::pow_special_operand], counted(1));
+	EXPECT_EQ(s[path::pow_scaled_range], counted(1));
+	EXPECT_EQ(s[path::pow_clamped], counted(1));
+	EXPECT_EQ(s[path::pow_subnormal_base], counted(1));
+}
+
+TEST(CcmathPathStats, SincosReductionsAreCounted)
+{
+	ccm::path_stats::reset();
+	volatile double small = 0.5;
+	volatile double huge  = 1.0e300;
+	static_cast<void>(ccm::internal::sin_double(small));
+	static_cast<void>(ccm::internal::cos_double(huge));
+	double s{};
+	double c{};
+	ccm::internal::sincos_double(huge, s, c);
+	ccm::internal::sincos_double(0.0, s, c);
+	static_cast<void>(ccm::internal::sin_double(std::numeric_limits<double>::quiet_NaN()));
+
+	const auto snap = ccm::path_stats::snapshot();
+	EXPECT_EQ(snap[path::sincos_small_reduction], counted(1));
+	EXPECT_EQ(snap[path::sincos_payne_hanek], counted(2));
+	EXPECT_EQ(snap[path::sincos_zero], counted(1));
+	EXPECT_EQ(snap[path::sincos_non_finite], counted(1));
+}
+
+TEST(CcmathPathStats, LogBranchesAreCounted)
+{
+	ccm::path_stats::reset();
+	volatile double near_one = 1.01;
+	volatile double table	 = 10.0;
+	volatile double tiny	 = 0x1.0p-1060;
+	static_cast<void>(ccm::internal::log_double(near_one));
+	static_cast<void>(ccm::internal::log_double(table));
+	static_cast<void>(ccm::internal::log_double(tiny));
+
+	const auto s = ccm::path_stats::snapshot();
+	EXPECT_EQ(s[path::log_near_one], counted(1));
+	EXPECT_EQ(s[path::log_subnormal], counted(1));
+	EXPECT_EQ(s[path::log_table], counted(1));
+}
+
+TEST(CcmathPathStats, EachScalarCallCountsOnePath)
+{
+	volatile double tiny = 0x1.0p-1060;
+	const double bases[] = { 2.0, tiny, 0.0, -3.0 };
+	const double exps[]	 = { 0.75, 3.0, 2.5, 700.3, 0x1.0p100, -0x1.0p100, 0.25 };
+	ccm::path_stats::reset();
+	for (const double b : bases)
+	{
+		for (const double e : exps) { static_cast<void>(ccm::gen::impl::pow_impl(b, e)); }
+	}
+	for (const double x : { 1.01, 10.0, 0x1.0p-1060, 0x1.0p-1030, 1.0e300 }) { static_cast<void>(ccm::internal::log_double(x)); }
+
+	const auto s		   = ccm::path_stats::snapshot();
+	std::uint64_t pow_hits = 0;
+	for (path p = path::pow_special_operand; p <= path::pow_clamped; p = static_cast<path>(static_cast<int>(p) + 1)) { pow_hits += s[p]; }
+	EXPECT_EQ(pow_hits, counted(std::size(bases) * std::size(exps)));
+	EXPECT_EQ(s[path::log_near_one] + s[path::log_subnormal] + s[path::log_table], counted(5));
+}
+
+TEST(CcmathPathStats, VectorKernelsCountLanes)
+{
+	using V			 = ccm::pp::simd<double, 4>;
+	constexpr auto N = static_cast<std::uint64_t>(V::size());
+	ccm::path_stats::reset();
+
+	// Lane 0 is near one, lane 1 is subnormal and goes to the scalar kernel, the rest take the table.
+	V x(10.0);
+	x[0] = 1.01;
+	x[1] = 0x1.0p-1060;
+	static_cast<void>(ccm::internal::impl::log_simd_impl(x));
+
+	// Lane 0 is Payne-Hanek, lane 1 is NaN and goes to the scalar kernel, the rest reduce directly.
+	V t(0.5);
+	t[0] = 1.0e300;
+	t[1] = std::numeric_limits<double>::quiet_NaN();
+	static_cast<void>(ccm::internal::impl::sin_simd_impl(t));
+
+	const auto s = ccm::path_stats::snapshot();
+	EXPECT_EQ(s[path::log_lane_near_one], counted(1));
+	EXPECT_EQ(s[path::log_lane_table], counted(N - 2));
+	EXPECT_EQ(s[path::log_lane_scalar_fallback], counted(1));
+	EXPECT_EQ(s[path::log_subnormal], counted(1)); // the fallback lane on the scalar kernel
+	EXPECT_EQ(s[path::sincos_lane_payne_hanek], counted(1));
+	EXPECT_EQ(s[path::sincos_lane_small_reduction], counted(N - 2));
+	EXPECT_EQ(s[path::sincos_lane_scalar_fallback], counted(1));
+	EXPECT_EQ(s[path::sincos_non_finite], counted(1));
+}
+
+TEST(CcmathPathStats, ConstantEvaluationIsNotCounted)
+{
+	ccm::path_stats::reset();
+	static_assert(kConstexprPow > 1.68 && kConstexprPow < 1.69);
+	static_assert(kConstexprLog > 1.09 && kConstexprLog < 1.1);
+	volatile double copy = kConstexprPow + kConstexprLog;
+	static_cast<void>(copy);
+
+	const auto s = ccm::path_stats::snapshot();
+	for (std::size_t i = 0; i < ccm::path_stats::path_count; ++i) { EXPECT_EQ(s.hits[i], 0U) << ccm::path_stats::name(static_cast<path>(i)); }
+}
+
+TEST(CcmathPathStats, CountsFromEveryThreadAndReset)
+{
+	ccm::path_stats::reset();
+	constexpr int kThreads = 4;
+	constexpr int kCalls   = 1000;
+	std::vector<std::thread> threads;
+	for (int t = 0; t < kThreads; ++t)
+	{
+		threads.emplace_back(
+			[]
+			{
+				volatile double x = 3.0;
+				for (int i = 0; i < kCalls; ++i) { static_cast<void>(ccm::internal::log_double(x)); }
+			});
+	}
+	for (auto & th : threads) { th.join(); }
+
+	EXPECT_EQ(ccm::path_stats::snapshot()[path::log_table], counted(kThreads * kCalls));
+	ccm::path_stats::reset();
+	EXPECT_EQ(ccm::path_stats::snapshot()[path::log_table], 0U);
+}
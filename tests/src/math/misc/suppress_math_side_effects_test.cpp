@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include <ccmath/ccmath.hpp>
+#include <ccmath/math/batch/expo.hpp>
+#include <ccmath/math/batch/trig.hpp>
+#include <ccmath/math/misc/suppress_math_side_effects.hpp>
+
+#include <array>
+#include <cerrno>
+#include <cfenv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	namespace fenv = ccm::support::fenv;
+
+	constexpr bool kReportsErrno  = (fenv::ccm_math_err_handling() & fenv::get_mode(fenv::ccm_math_err_mode::eErrno)) != 0;
+	constexpr bool kRaisesExcepts = (fenv::ccm_math_err_handling() & fenv::get_mode(fenv::ccm_math_err_mode::eErrnoExcept)) != 0;
+
+	bool same_bits(double a, double b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return std::memcmp(&a, &b, sizeof(a)) == 0;
+	}
+
+	// Both of the log family's domain errors, between ordinary elements.
+	const std::vector<double> kLogInputs = { 4.0, 2.0, 0.0, 8.0, 16.0, -1.0, 32.0, 64.0, 128.0, 3.0, 0.5 };
+} // namespace
+
+TEST(CcmathSuppressMathSideEffects, ScalarCallsReportNothingInsideTheScope)
+{
+	std::feclearexcept(FE_ALL_EXCEPT);
+	errno			   = 0;
+	const double pole  = ccm::log(0.0);
+	const double nan_v = ccm::log(-1.0);
+	if (kReportsErrno) { EXPECT_NE(errno, 0); }
+	if (kRaisesExcepts) { EXPECT_NE(std::fetestexcept(FE_DIVBYZERO | FE_INVALID), 0); }
+
+	std::feclearexcept(FE_ALL_EXCEPT);
+	errno = 0;
+	{
+		const ccm::suppress_math_side_effects scope;
+		EXPECT_TRUE(same_bits(ccm::log(0.0), pole));
+		EXPECT_TRUE(same_bits(ccm::log(-1.0), nan_v));
+		EXPECT_TRUE(same_bits(ccm::log2(0.0), -std::numeric_limits<double>::infinity()));
+	}
+	EXPECT_EQ(errno, 0);
+	EXPECT_EQ(std::fetestexcept(FE_DIVBYZERO | FE_INVALID), 0);
+}
+
+TEST(CcmathSuppressMathSideEffects, ScopesNestAndRestore)
+{
+	EXPECT_EQ(fenv::internal::current_side_effect_mode, fenv::internal::side_effect_mode::eReport);
+	{
+		const ccm::suppress_math_side_effects outer;
+		{
+			const ccm::suppress_math_side_effects inner;
+			EXPECT_FALSE(fenv::internal::side_effects_reported());
+		}
+		EXPECT_FALSE(fenv::internal::side_effects_reported());
+	}
+	EXPECT_TRUE(fenv::internal::side_effects_reported());
+
+	std::feclearexcept(FE_ALL_EXCEPT);
+	errno = 0;
+	static_cast<void>(ccm::log(0.0));
+	if (kReportsErrno) { EXPECT_EQ(errno, ERANGE); }
+	if (kRaisesExcepts) { EXPECT_NE(std::fetestexcept(FE_DIVBYZERO), 0); }
+}
+
+TEST(CcmathSuppressMathSideEffects, CollectingScopesPassTheirMaskOutward)
+{
+	using fenv::internal::side_effect_mode;
+	using fenv::internal::side_effect_scope;
+	{
+		const side_effect_scope outer(side_effect_mode::eCollect);
+		{
+			const side_effect_scope inner(side_effect_mode::eCollect);
+			fenv::raise_except_if_required(FE_INVALID);
+			if (kRaisesExcepts) { EXPECT_EQ(fenv::internal::collected_excepts, FE_INVALID); }
+		}
+		{
+			const side_effect_scope discard(side_effect_mode::eDiscard);
+			fenv::raise_except_if_required(FE_OVERFLOW);
+		}
+		if (kRaisesExcepts) { EXPECT_EQ(fenv::internal::collected_excepts, FE_INVALID); }
+	}
+	EXPECT_EQ(fenv::internal::collected_excepts, 0);
+}
+
+TEST(CcmathSuppressMathSideEffects, ScopeIsPerThread)
+{
+	const ccm::suppress_math_side_effects scope;
+	bool reported = false;
+	std::thread worker([&reported] { reported = fenv::internal::side_effects_reported(); });
+	worker.join();
+	EXPECT_TRUE(reported);
+}
+
+TEST(CcmathSuppressMathSideEffects, BatchWithoutSideEffectsLeavesErrnoAndFlagsAlone)
+{
+	std::vector<double> expected(kLogInputs.size());
+	ccm::batch::log(kLogInputs.data(), expected.data(), kLogInputs.size());
+
+	std::feclearexcept(FE_ALL_EXCEPT);
+	std::feraiseexcept(FE_UNDERFLOW);
+	errno = 0;
+	std::vector<double> out(kLogInputs.size());
+	ccm::batch::log(kLogInputs.data(), out.data(), kLogInputs.size(), ccm::batch::no_side_effects);
+	EXPECT_EQ(errno, 0);
+	EXPECT_EQ(std::fetestexcept(FE_ALL_EXCEPT), FE_UNDERFLOW);
+	for (std::size_t i = 0; i < out.size(); ++i) { EXPECT_TRUE(same_bits(out[i], expected[i])) << "x=" << kLogInputs[i]; }
+
+	// Flags raised by the arithmetic itself are rolled back as well.
+	const std::array<double, 3> big = { 1.0, 1000.0, 2.0 };
+	std::array<double, 3> big_out{};
+	ccm::batch::exp(big, big_out, ccm::batch::no_side_effects);
+	EXPECT_EQ(big_out[1], std::numeric_limits<double>::infinity());
+	EXPECT_EQ(std::fetestexcept(FE_ALL_EXCEPT), FE_UNDERFLOW);
+	std::feclearexcept(FE_ALL_EXCEPT);
+}
+
+TEST(CcmathSuppressMathSideEffects, BatchCollectsOneExceptionMaskPerCall)
+{
+	std::feclearexcept(FE_ALL_EXCEPT);
+	errno = 0;
+
+	std::vector<double> out(kLogInputs.size());
+	const int log_mask = ccm::batch::log(kLogInputs.data(), out.data(), kLogInputs.size(), ccm::batch::collect_exceptions);
+	EXPECT_EQ(errno, 0);
+	EXPECT_EQ(std::fetestexcept(FE_ALL_EXCEPT), 0);
+	EXPECT_EQ(out[2], -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(out[5]));
+	if (kRaisesExcepts)
+	{
+		EXPECT_NE(log_mask & FE_DIVBYZERO, 0);
+		EXPECT_NE(log_mask & FE_INVALID, 0);
+	}
+	EXPECT_EQ(log_mask & FE_OVERFLOW, 0);
+	ccm::batch::log(kLogInputs.data(), out.data(), kLogInputs.size());
+	EXPECT_EQ(log_mask, std::fetestexcept(FE_ALL_EXCEPT));
+	std::feclearexcept(FE_ALL_EXCEPT);
+	errno = 0;
+
+	// In-domain inputs raise at most FE_INEXACT.
+	const std::array<float, 5> clean = { 0.5F, 1.0F, 2.0F, 3.0F, 4.0F };
+	std::array<float, 5> clean_out{};
+	EXPECT_EQ(ccm::batch::log2(clean, clean_out, ccm::batch::collect_exceptions) & ~FE_INEXACT, 0);
+	std::array<float, 5> sin_out{};
+	std::array<float, 5> cos_out{};
+	EXPECT_EQ(ccm::batch::sincos(clean, sin_out, cos_out, ccm::batch::collect_exceptions) & ~FE_INEXACT, 0);
+	EXPECT_EQ(ccm::batch::atan2(clean, clean, clean_out, ccm::batch::collect_exceptions) & ~FE_INEXACT, 0);
+
+	// The mask is what the same call without a policy leaves in the flags.
+	const std::array<double, 4> big = { 1.0, 1000.0, -1000.0, 2.0 };
+	std::array<double, 4> big_out{};
+	ccm::batch::exp(big, big_out);
+	const int plain = std::fetestexcept(FE_ALL_EXCEPT);
+	std::feclearexcept(FE_ALL_EXCEPT);
+	EXPECT_EQ(ccm::batch::exp(big, big_out, ccm::batch::collect_exceptions), plain);
+	EXPECT_EQ(std::fetestexcept(FE_ALL_EXCEPT), 0);
+}
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The ccm::batch power entry points are contractually bit identical to the scalar generic path
+// element by element, whichever of the vector or scalar paths handled the element. These tests
+// pin that contract for every tail length, in place, through the range overloads and under
+// directed rounding. The vector kernels themselves are pinned lane by lane in cbrt_simd_test.cpp
+// and hypot_simd_test.cpp.
+
+#include "ccmath/internal/math/generic/func/power/cbrt_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/hypot_gen.hpp"
+#include "ccmath/math/batch/power.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	template <typename T>
+	std::vector<T> build_cbrt_inputs()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  T(1),
+							  T(-1),
+							  T(27),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  -std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest() };
+
+		for (int e = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits; e < std::numeric_limits<T>::max_exponent; e += 3)
+		{
+			xs.push_back(std::ldexp(T(1.3), e));
+			xs.push_back(-std::ldexp(T(1.7), e));
+		}
+
+		std::mt19937_64 rng(20260716ULL);
+		std::uniform_real_distribution<T> dist(T(-1000), T(1000));
+		for (int i = 0; i < 20000; ++i) { xs.push_back(dist(rng)); }
+		return xs;
+	}
+
+	template <typename T, typename BatchFn, typename RefFn>
+	void expect_batch_matches_reference(const std::vector<T> & xs, BatchFn batch_fn, RefFn ref_fn, const char * tag)
+	{
+		// Every length up to a few native widths, so each tail length is exercised.
+		for (std::size_t n = 0; n <= 40; ++n)
+		{
+			std::vector<T> out(n + 1, T(-12345));
+			batch_fn(xs.data(), out.data(), n);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				EXPECT_TRUE(bit_equal(out[i], ref_fn(xs[i]))) << tag << " n=" << n << " i=" << i << " x=" << xs[i];
+			}
+			EXPECT_EQ(out[n], T(-12345)) << tag << " wrote past the end for n=" << n;
+		}
+
+		std::vector<T> out(xs.size());
+		batch_fn(xs.data(), out.data(), xs.size());
+		for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], ref_fn(xs[i]))) << tag << " x=" << xs[i]; }
+	}
+
+	// Structure-of-arrays coordinates: x from the cbrt inputs, y and z mostly of nearby magnitude.
+	template <typename T>
+	struct coordinates
+	{
+		std::vector<T> x;
+		std::vector<T> y;
+		std::vector<T> z;
+	};
+
+	template <typename T>
+	coordinates<T> build_coordinates()
+	{
+		coordinates<T> c;
+		c.x = build_cbrt_inputs<T>();
+		std::mt19937_64 rng(20260720ULL);
+		std::uniform_int_distribution<int> nearby(-20, 20);
+		std::uniform_int_distribution<std::size_t> pick(0, c.x.size() - 1);
+		for (std::size_t i = 0; i < c.x.size(); ++i)
+		{
+			c.y.push_back((i % 5) == 0 ? c.x[pick(rng)] : std::ldexp(c.x[pick(rng)] * T(0.75), nearby(rng)));
+			c.z.push_back((i % 7) == 0 ? c.x[pick(rng)] : std::ldexp(c.x[i] * T(1.5), nearby(rng)));
+		}
+		return c;
+	}
+
+	template <typename T>
+	void expect_hypot_batches_match_scalar()
+	{
+		const coordinates<T> c = build_coordinates<T>();
+		for (std::size_t n = 0; n <= 40; ++n)
+		{
+			std::vector<T> out2(n + 1, T(-12345));
+			std::vector<T> out3(n + 1, T(-12345));
+			ccm::batch::hypot(c.x.data(), c.y.data(), out2.data(), n);
+			ccm::batch::hypot(c.x.data(), c.y.data(), c.z.data(), out3.data(), n);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				EXPECT_TRUE(bit_equal(out2[i], ccm::gen::hypot_gen(c.x[i], c.y[i]))) << "n=" << n << " i=" << i;
+				EXPECT_TRUE(bit_equal(out3[i], ccm::gen::hypot_gen(c.x[i], c.y[i], c.z[i]))) << "n=" << n << " i=" << i;
+			}
+			EXPECT_EQ(out2[n], T(-12345)) << "hypot wrote past the end for n=" << n;
+			EXPECT_EQ(out3[n], T(-12345)) << "hypot wrote past the end for n=" << n;
+		}
+
+		std::vector<T> out2(c.x.size());
+		std::vector<T> out3(c.x.size());
+		ccm::batch::hypot(c.x, c.y, out2);
+		ccm::batch::hypot(c.x, c.y, c.z, out3);
+		for (std::size_t i = 0; i < c.x.size(); ++i)
+		{
+			EXPECT_TRUE(bit_equal(out2[i], ccm::gen::hypot_gen(c.x[i], c.y[i]))) << "x=" << c.x[i] << " y=" << c.y[i];
+			EXPECT_TRUE(bit_equal(out3[i], ccm::gen::hypot_gen(c.x[i], c.y[i], c.z[i]))) << "x=" << c.x[i] << " y=" << c.y[i] << " z=" << c.z[i];
+		}
+	}
+} // namespace
+
+TEST(CcmathBatchPower, CbrtMatchesScalarFloat)
+{
+	expect_batch_matches_reference<float>(build_cbrt_inputs<float>(), [](float const * in, float * out, std::size_t n) { ccm::batch::cbrt(in, out, n); },
+										  [](float x) { return ccm::gen::cbrt_gen(x); }, "cbrt");
+}
+
+TEST(CcmathBatchPower, CbrtMatchesScalarDouble)
+{
+	expect_batch_matches_reference<double>(build_cbrt_inputs<double>(), [](double const * in, double * out, std::size_t n) { ccm::batch::cbrt(in, out, n); },
+										   [](double x) { return ccm::gen::cbrt_gen(x); }, "cbrt");
+}
+
+TEST(CcmathBatchPower, RangeOverloadsAndInPlace)
+{
+	std::vector<double> xs = { 0.25, 1.0, -8.0, 3.5, -7.0, 1e300, 0.0, 1e-310, 42.0 };
+	std::array<double, 9> out{};
+	ccm::batch::cbrt(xs, out);
+	for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], ccm::gen::cbrt_gen(xs[i]))); }
+
+	// Only min(size(in), size(out)) elements are written.
+	std::array<double, 4> short_out{};
+	ccm::batch::cbrt(xs, short_out);
+	for (std::size_t i = 0; i < short_out.size(); ++i) { EXPECT_TRUE(bit_equal(short_out[i], ccm::gen::cbrt_gen(xs[i]))); }
+
+	std::vector<double> in_place = xs;
+	ccm::batch::cbrt(in_place, in_place);
+	for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(in_place[i], ccm::gen::cbrt_gen(xs[i]))); }
+
+	std::array<float, 5> clean = { 0.5F, 1.0F, 8.0F, -27.0F, 64.0F };
+	std::array<float, 5> clean_out{};
+	EXPECT_EQ(ccm::batch::cbrt(clean, clean_out, ccm::batch::collect_exceptions) & ~FE_INEXACT, 0);
+	EXPECT_EQ(clean_out[3], -3.0F);
+}
+
+TEST(CcmathBatchPower, DirectedRoundingMatchesScalarKernel)
+{
+	const std::vector<double> xs = build_cbrt_inputs<double>();
+	const int saved				 = std::fegetround();
+	for (int mode : { FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO })
+	{
+		ASSERT_EQ(std::fesetround(mode), 0);
+		std::vector<double> out(xs.size());
+		ccm::batch::cbrt(xs.data(), out.data(), xs.size());
+		for (std::size_t i = 0; i < xs.size(); ++i)
+		{
+			const double ref = ccm::gen::cbrt_gen(xs[i]);
+			EXPECT_TRUE(bit_equal(out[i], ref)) << "mode=" << mode << " x=" << xs[i];
+		}
+	}
+	std::fesetround(saved);
+}
+
+TEST(CcmathBatchPower, HypotMatchesScalarFloat)
+{
+	expect_hypot_batches_match_scalar<float>();
+}
+
+TEST(CcmathBatchPower, HypotMatchesScalarDouble)
+{
+	expect_hypot_batches_match_scalar<double>();
+}
+
+TEST(CcmathBatchPower, HypotRangesInPlaceAndPolicies)
+{
+	const std::vector<double> x = { 3.0, 1e300, 0.0, -5.0, std::numeric_limits<double>::infinity(), 1e-310, 2.0 };
+	const std::vector<double> y = { 4.0, 1e300, -0.0, 12.0, std::numeric_limits<double>::quiet_NaN(), 1e-310, 3.0 };
+	const std::vector<double> z = { 12.0, 1e300, 0.0, 84.0, 1.0, 1e-310, 6.0 };
+
+	// Only min(size(x), size(y), size(z), size(out)) elements are written.
+	std::array<double, 5> short_out{};
+	ccm::batch::hypot(x, y, z, short_out);
+	for (std::size_t i = 0; i < short_out.size(); ++i) { EXPECT_TRUE(bit_equal(short_out[i], ccm::gen::hypot_gen(x[i], y[i], z[i]))); }
+	EXPECT_EQ(short_out[0], 13.0);
+	EXPECT_EQ(short_out[3], 85.0);
+	EXPECT_EQ(short_out[4], std::numeric_limits<double>::infinity());
+
+	std::vector<double> in_place = z;
+	ccm::batch::hypot(x, y, in_place, in_place);
+	for (std::size_t i = 0; i < z.size(); ++i) { EXPECT_TRUE(bit_equal(in_place[i], ccm::gen::hypot_gen(x[i], y[i], z[i]))); }
+
+	std::vector<double> pair_out(x.size());
+	// The subnormal element has a subnormal, inexact result, so it underflows; nothing else is raised.
+	EXPECT_EQ(ccm::batch::hypot(x, y, pair_out, ccm::batch::collect_exceptions) & ~(FE_INEXACT | FE_UNDERFLOW), 0);
+	EXPECT_EQ(ccm::batch::hypot(x, y, z, pair_out, ccm::batch::collect_exceptions) & ~(FE_INEXACT | FE_UNDERFLOW), 0);
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_TRUE(bit_equal(pair_out[i], ccm::gen::hypot_gen(x[i], y[i], z[i]))); }
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The vectorized cbrt kernels are contractually bit identical to the scalar kernels on every lane.
+// These tests pin that contract across several vector widths, including subnormal lanes mixed
+// with normal ones and the NaN, infinite and zero lanes the kernels pass through. They also pin
+// the accuracy of the scalar kernels themselves against a long double reference.
+
+#include "ccmath/internal/math/generic/func/power/impl/cbrt_impl.hpp"
+#include "ccmath/internal/math/generic/func/power/impl/cbrt_simd_impl.hpp"
+#include "ccmath/internal/math/runtime/pp/pp.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace ccm::pp;
+
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	template <typename T>
+	std::vector<T> cbrt_inputs()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  T(1),
+							  T(-1),
+							  T(8),
+							  T(-27),
+							  T(0.125),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  -std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::nextafter(std::numeric_limits<T>::min(), T(0)),
+							  std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest(),
+							  std::numeric_limits<T>::epsilon() };
+
+		// Every binade, subnormals included, both signs.
+		for (int e = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits; e < std::numeric_limits<T>::max_exponent; ++e)
+		{
+			xs.push_back(std::ldexp(T(1.37), e));
+			xs.push_back(-std::ldexp(T(1.91), e));
+		}
+
+		// Perfect cubes and their neighbours.
+		for (int k = 1; k <= 200; ++k)
+		{
+			const T cube = static_cast<T>(k) * static_cast<T>(k) * static_cast<T>(k);
+			xs.push_back(cube);
+			xs.push_back(std::nextafter(cube, inf));
+			xs.push_back(-std::nextafter(cube, T(0)));
+		}
+
+		std::mt19937_64 rng(20260715ULL);
+		std::uniform_real_distribution<T> mantissa(T(1), T(2));
+		std::uniform_int_distribution<int> exponent(std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits,
+													std::numeric_limits<T>::max_exponent - 1);
+		for (int i = 0; i < 20000; ++i)
+		{
+			const T v = std::ldexp(mantissa(rng), exponent(rng));
+			xs.push_back((i & 1) != 0 ? -v : v);
+		}
+		return xs;
+	}
+
+	template <typename V>
+	void expect_kernel_matches_scalar(const std::vector<typename V::value_type> & xs, const char * tag)
+	{
+		using T				= typename V::value_type;
+		constexpr int width = static_cast<int>(V::size());
+
+		for (std::size_t base = 0; base < xs.size(); base += width)
+		{
+			alignas(64) T xb[64];
+			const int count = static_cast<int>(std::min<std::size_t>(width, xs.size() - base));
+			for (int i = 0; i < width; ++i) { xb[i] = i < count ? xs[base + static_cast<std::size_t>(i)] : T(1.5); }
+
+			const V rv = ccm::internal::impl::cbrt_simd_impl(V(xb, element_aligned));
+			for (int i = 0; i < count; ++i)
+			{
+				const T got = rv[i];
+				const T ref = ccm::internal::impl::cbrt_impl(xb[i]);
+				EXPECT_TRUE(bit_equal(got, ref)) << tag << " x=" << xb[i] << " got=0x" << std::hex << float_bits(got) << " ref=0x" << float_bits(ref);
+			}
+		}
+	}
+
+	template <typename T>
+	void expect_all_widths(const std::vector<T> & xs)
+	{
+		expect_kernel_matches_scalar<native_simd<T>>(xs, "native");
+		expect_kernel_matches_scalar<simd<T, 2>>(xs, "w2");
+		expect_kernel_matches_scalar<simd<T, 4>>(xs, "w4");
+		if constexpr (VecAbi<8>::template IsValid<T>::value) { expect_kernel_matches_scalar<simd<T, 8>>(xs, "w8"); }
+		else { GTEST_SKIP() << "8-wide simd not available on this target"; }
+	}
+
+	// Distance in ulps of T between got and a long double reference.
+	template <typename T>
+	long double ulp_error(T got, long double ref)
+	{
+		int exp = 0;
+		static_cast<void>(std::frexp(static_cast<T>(ref), &exp));
+		exp = std::max(exp, std::numeric_limits<T>::min_exponent);
+		return std::fabs(static_cast<long double>(got) - ref) / std::ldexp(1.0L, exp - std::numeric_limits<T>::digits);
+	}
+} // namespace
+
+static_assert(ccm::internal::impl::cbrt_impl(27.0) == 3.0);
+static_assert(ccm::internal::impl::cbrt_impl(-8.0F) == -2.0F);
+
+TEST(CcmathCbrtSimd, BitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(cbrt_inputs<float>());
+}
+
+TEST(CcmathCbrtSimd, BitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(cbrt_inputs<double>());
+}
+
+TEST(CcmathCbrtSimd, PpCbrtRoutesThroughKernels)
+{
+	const native_simd<double> xd([](auto i) { return -30.0 + 17.3 * static_cast<double>(i); });
+	const native_simd<float> xf([](auto i) { return -30.0F + 17.3F * static_cast<float>(i); });
+
+	const auto cd = ccm::pp::cbrt(xd);
+	const auto cf = ccm::pp::cbrt(xf);
+	for (int i = 0; i < static_cast<int>(xd.size()); ++i) { EXPECT_TRUE(bit_equal(cd[i], ccm::internal::impl::cbrt_impl(xd[i]))); }
+	for (int i = 0; i < static_cast<int>(xf.size()); ++i) { EXPECT_TRUE(bit_equal(cf[i], ccm::internal::impl::cbrt_impl(xf[i]))); }
+}
+
+TEST(CcmathCbrtSimd, SpecialLanesRaiseNothing)
+{
+	using VD = native_simd<double>;
+	using VF = native_simd<float>;
+
+	std::feclearexcept(FE_ALL_EXCEPT);
+	const VD nan_d(std::numeric_limits<double>::quiet_NaN());
+	const VD inf_d(-std::numeric_limits<double>::infinity());
+	const VD zero_d(-0.0);
+	const VF nan_f(std::numeric_limits<float>::quiet_NaN());
+	const VF inf_f(std::numeric_limits<float>::infinity());
+	const VF zero_f(0.0F);
+	const VD rd = ccm::internal::impl::cbrt_simd_impl(nan_d) + ccm::internal::impl::cbrt_simd_impl(inf_d);
+	const VD zd = ccm::internal::impl::cbrt_simd_impl(zero_d);
+	const VF rf = ccm::internal::impl::cbrt_simd_impl(nan_f) + ccm::internal::impl::cbrt_simd_impl(inf_f);
+	const VF zf = ccm::internal::impl::cbrt_simd_impl(zero_f);
+	EXPECT_EQ(std::fetestexcept(FE_ALL_EXCEPT & ~FE_INEXACT), 0);
+	EXPECT_TRUE(std::isnan(rd[0]));
+	EXPECT_TRUE(std::signbit(zd[0]));
+	EXPECT_TRUE(std::isnan(rf[0]));
+	EXPECT_EQ(zf[0], 0.0F);
+}
+
+TEST(CcmathCbrtSimd, ScalarKernelAccuracy)
+{
+	long double worst_float = 0;
+	for (float x : cbrt_inputs<float>())
+	{
+		if (!std::isfinite(x)) { continue; }
+		worst_float = std::max(worst_float, ulp_error(ccm::internal::impl::cbrt_impl(x), std::cbrt(static_cast<long double>(x))));
+	}
+	EXPECT_LE(worst_float, 0.5L);
+
+	if constexpr (std::numeric_limits<long double>::digits > std::numeric_limits<double>::digits)
+	{
+		long double worst_double = 0;
+		for (double x : cbrt_inputs<double>())
+		{
+			if (!std::isfinite(x)) { continue; }
+			worst_double = std::max(worst_double, ulp_error(ccm::internal::impl::cbrt_impl(x), std::cbrt(static_cast<long double>(x))));
+		}
+		EXPECT_LT(worst_double, 0.667L);
+	}
+}
@@ -64,6 +64,15 @@ TEST(CcmathPowerTests, HypotThreeArgsMatchesStd)
 	ccm::test::ExpectSameFloatingAsStd(ccm::hypot(2.0F, 3.0F, 6.0F), std::hypot(2.0F, 3.0F, 6.0F));
 }
 
+TEST(CcmathPowerTests, HypotThreeArgsLongDoubleConstexprMatchesRuntime)
+{
+	// The small middle argument only survives at long double precision.
+	constexpr long double ct = ccm::hypot(1.0L, 1e-10L, 3.0L);
+	volatile long double y	 = 1e-10L;
+	EXPECT_EQ(ct, ccm::hypot(1.0L, static_cast<long double>(y), 3.0L));
+	if constexpr (ccm::builtin::has_constexpr_hypot<long double>) { EXPECT_EQ(ct, std::hypot(std::hypot(1.0L, 1e-10L), 3.0L)); }
+}
+
 TEST(CcmathPowerTests, CbrtMatchesStdGrid)
 {
 	for (double input : ccm::test::samples::kCbrtDouble)
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The vectorized two and three argument hypot kernels are contractually bit identical to the
+// scalar kernels on every lane. These tests pin that contract across several vector widths, with
+// lanes from every scaling band, subnormals, infinities and NaN mixed in one vector. They also pin
+// the accuracy of the fused three argument kernel against a long double reference.
+
+#include "ccmath/internal/math/generic/func/power/impl/hypot_impl.hpp"
+#include "ccmath/internal/math/generic/func/power/impl/hypot_simd_impl.hpp"
+#include "ccmath/internal/math/runtime/pp/pp.hpp"
+#include "ccmath/math/power/hypot.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace ccm::pp;
+
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	// Coordinates drawn from every binade; the triples below combine them at random.
+	template <typename T>
+	std::vector<T> coordinate_pool()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  T(1),
+							  T(-3),
+							  T(4),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest() };
+
+		std::mt19937_64 rng(20260717ULL);
+		std::uniform_real_distribution<T> mantissa(T(1), T(2));
+		std::uniform_int_distribution<int> exponent(std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits,
+													std::numeric_limits<T>::max_exponent - 1);
+		for (int i = 0; i < 4000; ++i)
+		{
+			const T v = std::ldexp(mantissa(rng), exponent(rng));
+			xs.push_back((i & 1) != 0 ? -v : v);
+		}
+		// Scaling thresholds of the double kernel.
+		for (T v : { T(0x1p500), T(0x1p-500) })
+		{
+			if (std::isfinite(v) && v != T(0))
+			{
+				xs.push_back(v);
+				xs.push_back(std::nextafter(v, inf));
+				xs.push_back(std::nextafter(v, T(0)));
+			}
+		}
+		return xs;
+	}
+
+	template <typename V>
+	void expect_kernels_match_scalar(const char * tag)
+	{
+		using T					  = typename V::value_type;
+		constexpr int width		  = static_cast<int>(V::size());
+		const std::vector<T> pool = coordinate_pool<T>();
+
+		std::mt19937_64 rng(20260718ULL);
+		std::uniform_int_distribution<std::size_t> pick(0, pool.size() - 1);
+		// Mostly nearby magnitudes, so the smaller coordinates are not lost in the sum.
+		std::uniform_int_distribution<int> nearby(-30, 30);
+		for (int block = 0; block < 4000; ++block)
+		{
+			alignas(64) T xb[64];
+			alignas(64) T yb[64];
+			alignas(64) T zb[64];
+			for (int i = 0; i < width; ++i)
+			{
+				xb[i] = pool[pick(rng)];
+				yb[i] = (block & 1) != 0 ? pool[pick(rng)] : std::ldexp(xb[i], nearby(rng));
+				zb[i] = (block & 2) != 0 ? pool[pick(rng)] : std::ldexp(yb[i], nearby(rng));
+			}
+
+			const V x(xb, element_aligned);
+			const V y(yb, element_aligned);
+			const V z(zb, element_aligned);
+			const V r2 = ccm::internal::impl::hypot_simd_impl(x, y);
+			const V r3 = ccm::internal::impl::hypot_simd_impl(x, y, z);
+			for (int i = 0; i < width; ++i)
+			{
+				const T ref2 = ccm::internal::impl::hypot_impl(xb[i], yb[i]);
+				const T ref3 = ccm::internal::impl::hypot_impl(xb[i], yb[i], zb[i]);
+				EXPECT_TRUE(bit_equal<T>(r2[i], ref2)) << tag << " x=" << xb[i] << " y=" << yb[i] << " got=0x" << std::hex << float_bits<T>(r2[i]);
+				EXPECT_TRUE(bit_equal<T>(r3[i], ref3)) << tag << " x=" << xb[i] << " y=" << yb[i] << " z=" << zb[i] << " got=0x" << std::hex
+													   << float_bits<T>(r3[i]);
+			}
+		}
+	}
+
+	template <typename T>
+	void expect_all_widths()
+	{
+		expect_kernels_match_scalar<native_simd<T>>("native");
+		expect_kernels_match_scalar<simd<T, 2>>("w2");
+		expect_kernels_match_scalar<simd<T, 4>>("w4");
+		if constexpr (VecAbi<8>::template IsValid<T>::value) { expect_kernels_match_scalar<simd<T, 8>>("w8"); }
+		else { GTEST_SKIP() << "8-wide simd not available on this target"; }
+	}
+
+	// Distance in ulps of T between got and a long double reference.
+	template <typename T>
+	long double ulp_error(T got, long double ref)
+	{
+		int exp = 0;
+		static_cast<void>(std::frexp(static_cast<T>(ref), &exp));
+		exp = std::max(exp, std::numeric_limits<T>::min_exponent);
+		return std::fabs(static_cast<long double>(got) - ref) / std::ldexp(1.0L, exp - std::numeric_limits<T>::digits);
+	}
+} // namespace
+
+static_assert(ccm::internal::impl::hypot_impl(2.0, 3.0, 6.0) == 7.0);
+static_assert(ccm::internal::impl::hypot_impl(1.0F, 4.0F, 8.0F) == 9.0F);
+
+TEST(CcmathHypotSimd, BitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths<float>();
+}
+
+TEST(CcmathHypotSimd, BitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths<double>();
+}
+
+TEST(CcmathHypotSimd, PpHypotRoutesThroughKernels)
+{
+	const native_simd<double> xd([](auto i) { return -3.0 + 1.7 * static_cast<double>(i); });
+	const native_simd<double> yd([](auto i) { return 4.0 - 0.9 * static_cast<double>(i); });
+	const native_simd<float> xf([](auto i) { return -3.0F + 1.7F * static_cast<float>(i); });
+	const native_simd<float> yf([](auto i) { return 4.0F - 0.9F * static_cast<float>(i); });
+
+	const auto h2d = ccm::pp::hypot(xd, yd);
+	const auto h3d = ccm::pp::hypot(xd, yd, xd * yd);
+	const auto h2f = ccm::pp::hypot(xf, yf);
+	const auto h3f = ccm::pp::hypot(xf, yf, xf * yf);
+	for (int i = 0; i < static_cast<int>(xd.size()); ++i)
+	{
+		EXPECT_TRUE(bit_equal<double>(h2d[i], ccm::internal::impl::hypot_impl<double>(xd[i], yd[i])));
+		EXPECT_TRUE(bit_equal<double>(h3d[i], ccm::internal::impl::hypot_impl<double>(xd[i], yd[i], xd[i] * yd[i])));
+	}
+	for (int i = 0; i < static_cast<int>(xf.size()); ++i)
+	{
+		EXPECT_TRUE(bit_equal<float>(h2f[i], ccm::internal::impl::hypot_impl<float>(xf[i], yf[i])));
+		EXPECT_TRUE(bit_equal<float>(h3f[i], ccm::internal::impl::hypot_impl<float>(xf[i], yf[i], xf[i] * yf[i])));
+	}
+}
+
+TEST(CcmathHypotSimd, SpecialLanesRaiseNothing)
+{
+	using VD = native_simd<double>;
+	using VF = native_simd<float>;
+
+	std::feclearexcept(FE_ALL_EXCEPT);
+	const VD inf_d(std::numeric_limits<double>::infinity());
+	const VD nan_d(std::numeric_limits<double>::quiet_NaN());
+	const VD max_d(std::numeric_limits<double>::max());
+	const VF inf_f(-std::numeric_limits<float>::infinity());
+	const VF nan_f(std::numeric_limits<float>::quiet_NaN());
+	const VF max_f(std::numeric_limits<float>::max());
+	const VD rd = ccm::internal::impl::hypot_simd_impl(inf_d, -inf_d, nan_d);
+	const VD nd = ccm::internal::impl::hypot_simd_impl(max_d, nan_d, max_d);
+	const VF rf = ccm::internal::impl::hypot_simd_impl(nan_f, inf_f);
+	const VF nf = ccm::internal::impl::hypot_simd_impl(max_f, nan_f);
+	EXPECT_EQ(std::fetestexcept(FE_ALL_EXCEPT & ~FE_INEXACT), 0);
+	EXPECT_EQ(rd[0], std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(nd[0]));
+	EXPECT_EQ(rf[0], std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(nf[0]));
+}
+
+TEST(CcmathHypotSimd, ThreeArgumentKernelAccuracy)
+{
+	EXPECT_TRUE(std::isfinite(ccm::hypot(1e308, 1e308, 1e308)));
+	EXPECT_EQ(ccm::hypot(3e-320, 4e-320, 0.0), ccm::hypot(3e-320, 4e-320));
+	EXPECT_EQ(ccm::hypot(std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity(), 1.0), std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::hypot(std::numeric_limits<float>::quiet_NaN(), 1.0F, 2.0F)));
+
+	std::mt19937_64 rng(20260719ULL);
+	std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+	std::uniform_int_distribution<int> nearby(-4, 4);
+	std::uniform_int_distribution<int> exponent_f(-140, 120);
+	std::uniform_int_distribution<int> exponent_d(-1060, 1015);
+	long double worst_float	 = 0;
+	long double worst_double = 0;
+	for (int i = 0; i < 100000; ++i)
+	{
+		const int ef			= exponent_f(rng);
+		const float x			= static_cast<float>(std::ldexp(mantissa(rng), ef));
+		const float y			= static_cast<float>(std::ldexp(mantissa(rng), ef + nearby(rng)));
+		const float z			= static_cast<float>(std::ldexp(mantissa(rng), ef + nearby(rng)));
+		const long double ref_f	= std::sqrt(static_cast<long double>(x) * x + static_cast<long double>(y) * y + static_cast<long double>(z) * z);
+		worst_float				= std::max(worst_float, ulp_error(ccm::internal::impl::hypot_impl(x, y, z), ref_f));
+
+		const int ed			= exponent_d(rng);
+		const double xd			= std::ldexp(mantissa(rng), ed);
+		const double yd			= std::ldexp(mantissa(rng), ed + nearby(rng));
+		const double zd			= std::ldexp(mantissa(rng), ed + nearby(rng));
+		const long double ref_d	= std::sqrt(static_cast<long double>(xd) * xd + static_cast<long double>(yd) * yd + static_cast<long double>(zd) * zd);
+		worst_double			= std::max(worst_double, ulp_error(ccm::internal::impl::hypot_impl(xd, yd, zd), ref_d));
+	}
+	// The float kernel rounds an almost exact double result once more.
+	EXPECT_LE(worst_float, 0.5L + 0x1p-20L);
+	if constexpr (std::numeric_limits<long double>::digits > std::numeric_limits<double>::digits) { EXPECT_LE(worst_double, 1.5L); }
+}
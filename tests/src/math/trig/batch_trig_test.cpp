@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The trigonometric ccm::batch entry points are contractually bit identical to the scalar generic
+// path element by element, whichever of the vector or scalar paths handled the element. These
+// tests pin that contract for every tail length, in place and through the range overloads. The
+// vector kernels themselves are pinned lane by lane in sincos_simd_test.cpp and
+// inv_trig_simd_test.cpp.
+
+#include "ccmath/internal/math/generic/func/trig/acos_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/asin_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/atan2_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/atan_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/cos_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/sin_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/tan_gen.hpp"
+#include "ccmath/math/batch/trig.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cerrno>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	template <typename T>
+	std::vector<T> build_inputs()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0.5), T(-0.0), T(0), T(1e-30), inf, T(3), -inf, std::numeric_limits<T>::quiet_NaN(), T(1e6), T(-2e7), T(1e30) };
+
+		std::mt19937_64 rng(20260705ULL);
+		std::uniform_real_distribution<T> dist(T(-100), T(100));
+		for (int i = 0; i < 5000; ++i) { xs.push_back(dist(rng)); }
+		return xs;
+	}
+
+	// The asin/acos domain, its edges and a few out-of-domain values.
+	template <typename T>
+	std::vector<T> build_unit_inputs()
+	{
+		std::vector<T> xs = { T(1), T(-1), T(0.5), T(-0.5), T(-0.0), T(0), T(1e-30), T(1.5), std::numeric_limits<T>::quiet_NaN(), T(-2) };
+
+		std::mt19937_64 rng(20260708ULL);
+		std::uniform_real_distribution<T> dist(T(-1), T(1));
+		for (int i = 0; i < 5000; ++i) { xs.push_back(dist(rng)); }
+		return xs;
+	}
+
+	template <typename T, typename BatchFn, typename RefFn>
+	void expect_batch_matches_reference(const std::vector<T> & xs, BatchFn batch_fn, RefFn ref_fn, const char * tag)
+	{
+		// Every length up to a few native widths, so each tail length is exercised.
+		for (std::size_t n = 0; n <= 40; ++n)
+		{
+			std::vector<T> out(n + 1, T(-12345));
+			batch_fn(xs.data(), out.data(), n);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				EXPECT_TRUE(bit_equal(out[i], ref_fn(xs[i]))) << tag << " n=" << n << " i=" << i << " x=" << xs[i];
+			}
+			EXPECT_EQ(out[n], T(-12345)) << tag << " wrote past the end for n=" << n;
+		}
+
+		std::vector<T> out(xs.size());
+		batch_fn(xs.data(), out.data(), xs.size());
+		for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], ref_fn(xs[i]))) << tag << " x=" << xs[i]; }
+	}
+
+	template <typename T>
+	void expect_batch_family()
+	{
+		const std::vector<T> xs = build_inputs<T>();
+		expect_batch_matches_reference<T>(xs, [](T const * in, T * out, std::size_t n) { ccm::batch::sin(in, out, n); },
+										  [](T x) { return ccm::gen::sin_gen(x); }, "sin");
+		expect_batch_matches_reference<T>(xs, [](T const * in, T * out, std::size_t n) { ccm::batch::cos(in, out, n); },
+										  [](T x) { return ccm::gen::cos_gen(x); }, "cos");
+		expect_batch_matches_reference<T>(xs, [](T const * in, T * out, std::size_t n) { ccm::batch::tan(in, out, n); },
+										  [](T x) { return ccm::gen::tan_gen(x); }, "tan");
+
+		// Both outputs of sincos, each checked through its own pass.
+		expect_batch_matches_reference<T>(xs, [](T const * in, T * out, std::size_t n) { std::vector<T> c(n); ccm::batch::sincos(in, out, c.data(), n); },
+										  [](T x) { return ccm::gen::sin_gen(x); }, "sincos.sin");
+		expect_batch_matches_reference<T>(xs, [](T const * in, T * out, std::size_t n) { std::vector<T> s(n); ccm::batch::sincos(in, s.data(), out, n); },
+										  [](T x) { return ccm::gen::cos_gen(x); }, "sincos.cos");
+
+		const std::vector<T> unit = build_unit_inputs<T>();
+		expect_batch_matches_reference<T>(unit, [](T const * in, T * out, std::size_t n) { ccm::batch::asin(in, out, n); },
+										  [](T x) { return ccm::gen::asin_gen(x); }, "asin");
+		expect_batch_matches_reference<T>(unit, [](T const * in, T * out, std::size_t n) { ccm::batch::acos(in, out, n); },
+										  [](T x) { return ccm::gen::acos_gen(x); }, "acos");
+		expect_batch_matches_reference<T>(xs, [](T const * in, T * out, std::size_t n) { ccm::batch::atan(in, out, n); },
+										  [](T x) { return ccm::gen::atan_gen(x); }, "atan");
+	}
+
+	// atan2 pairs the inputs with the same list reversed, so every quadrant and special case meets a
+	// range of partners.
+	template <typename T>
+	void expect_atan2_batch()
+	{
+		const std::vector<T> ys = build_inputs<T>();
+		const std::vector<T> xs(ys.rbegin(), ys.rend());
+
+		for (std::size_t n = 0; n <= 40; ++n)
+		{
+			std::vector<T> out(n + 1, T(-12345));
+			ccm::batch::atan2(ys.data(), xs.data(), out.data(), n);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				EXPECT_TRUE(bit_equal(out[i], ccm::gen::atan2_gen(ys[i], xs[i]))) << "atan2 n=" << n << " y=" << ys[i] << " x=" << xs[i];
+			}
+			EXPECT_EQ(out[n], T(-12345)) << "atan2 wrote past the end for n=" << n;
+		}
+
+		std::vector<T> out(ys.size());
+		ccm::batch::atan2(ys.data(), xs.data(), out.data(), ys.size());
+		for (std::size_t i = 0; i < ys.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], ccm::gen::atan2_gen(ys[i], xs[i]))) << "atan2 y=" << ys[i] << " x=" << xs[i]; }
+	}
+} // namespace
+
+TEST(CcmathBatchTrig, BatchMatchesScalarFloat)
+{
+	expect_batch_family<float>();
+}
+
+TEST(CcmathBatchTrig, BatchMatchesScalarDouble)
+{
+	expect_batch_family<double>();
+}
+
+TEST(CcmathBatchTrig, Atan2MatchesScalarFloat)
+{
+	expect_atan2_batch<float>();
+}
+
+TEST(CcmathBatchTrig, Atan2MatchesScalarDouble)
+{
+	expect_atan2_batch<double>();
+}
+
+TEST(CcmathBatchTrig, RangeOverloadsAndInPlace)
+{
+	std::vector<double> xs = { 0.25, 1.0, 2.0, 3.5, -7.0, 100.0, 0.0, 1e-300, 42.0 };
+	std::array<double, 9> out{};
+	ccm::batch::sin(xs, out);
+	for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(out[i], ccm::gen::sin_gen(xs[i]))); }
+
+	// Only min(size(in), size(out)) elements are written.
+	std::array<double, 4> short_out{};
+	ccm::batch::cos(xs, short_out);
+	for (std::size_t i = 0; i < short_out.size(); ++i) { EXPECT_TRUE(bit_equal(short_out[i], ccm::gen::cos_gen(xs[i]))); }
+
+	std::vector<double> in_place = xs;
+	ccm::batch::cos(in_place, in_place);
+	for (std::size_t i = 0; i < xs.size(); ++i) { EXPECT_TRUE(bit_equal(in_place[i], ccm::gen::cos_gen(xs[i]))); }
+
+	// sincos writes min(size(in), size(sin_out), size(cos_out)) elements, and the input may be reused
+	// as the sine output.
+	std::vector<double> angles = xs;
+	std::array<double, 6> cosines{};
+	ccm::batch::sincos(angles, angles, cosines);
+	for (std::size_t i = 0; i < cosines.size(); ++i)
+	{
+		EXPECT_TRUE(bit_equal(angles[i], ccm::gen::sin_gen(xs[i])));
+		EXPECT_TRUE(bit_equal(cosines[i], ccm::gen::cos_gen(xs[i])));
+	}
+	for (std::size_t i = cosines.size(); i < xs.size(); ++i) { EXPECT_EQ(angles[i], xs[i]); }
+
+	// atan2 writes min(size(y), size(x), size(out)) elements, and either input may be the output.
+	std::vector<double> gy		   = xs;
+	const std::array<double, 7> gx = { -1.0, 2.0, 0.0, -0.0, 5.0, -3.0, 1e-3 };
+	ccm::batch::atan2(gy, gx, gy);
+	for (std::size_t i = 0; i < gx.size(); ++i) { EXPECT_TRUE(bit_equal(gy[i], ccm::gen::atan2_gen(xs[i], gx[i]))); }
+	for (std::size_t i = gx.size(); i < xs.size(); ++i) { EXPECT_EQ(gy[i], xs[i]); }
+}
+
+TEST(CcmathBatchTrig, InfinityRaisesInvalid)
+{
+	const std::vector<double> xs = { 0.5, 1.0, std::numeric_limits<double>::infinity(), 2.0, 4.0, 8.0, 16.0, 32.0, 64.0 };
+	std::vector<double> out(xs.size());
+
+	std::feclearexcept(FE_ALL_EXCEPT);
+	errno = 0;
+	ccm::batch::sin(xs.data(), out.data(), xs.size());
+	EXPECT_TRUE(std::isnan(out[2]));
+	if (math_errhandling & MATH_ERREXCEPT) { EXPECT_NE(std::fetestexcept(FE_INVALID), 0); }
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The vectorized asin, acos, atan and atan2 kernels are contractually bit identical to the scalar
+// kernels of inv_trig_impl on every lane. These tests pin that contract across several vector
+// widths, over every band boundary of the scalar kernels (2^-14, 2^-10, 0.5, 1) and over the lanes
+// resolved by select or routed scalar side: signed zeros, +/-1, out-of-domain, infinite and NaN
+// inputs. pp::asin, pp::acos, pp::atan and pp::atan2 are checked to route through the kernels.
+
+#include "ccmath/internal/math/runtime/pp/pp.hpp"
+#include "ccmath/math/trig/impl/inv_trig_impl.hpp"
+#include "ccmath/math/trig/impl/inv_trig_simd_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using namespace ccm::pp;
+
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	template <typename T>
+	std::vector<T> build_inputs()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  T(1),
+							  T(-1),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  -std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest() };
+
+		// Each band edge of the scalar kernels and its neighbours, on both signs.
+		for (T edge : { T(0x1.0p-14), T(0x1.0p-10), T(0.5), T(1), T(0x1.0p+14) })
+		{
+			for (T v : { edge, std::nextafter(edge, T(0)), std::nextafter(edge, inf) })
+			{
+				xs.push_back(v);
+				xs.push_back(-v);
+			}
+		}
+
+		// Dense sampling over and just past the asin/acos domain.
+		for (T x = T(-1.1); x <= T(1.1); x += T(0.0003)) { xs.push_back(x); }
+
+		// Every binade, plus the negated values.
+		for (int e = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits; e < std::numeric_limits<T>::max_exponent; e += 2)
+		{
+			const T v = std::ldexp(T(1.3), e);
+			if (std::isfinite(v))
+			{
+				xs.push_back(v);
+				xs.push_back(-v);
+			}
+		}
+
+		std::mt19937_64 rng(20260708ULL);
+		std::uniform_real_distribution<T> unit(T(-1), T(1));
+		std::uniform_real_distribution<T> wide(T(-1000), T(1000));
+		for (int i = 0; i < 10000; ++i)
+		{
+			xs.push_back(unit(rng));
+			xs.push_back(wide(rng));
+		}
+		return xs;
+	}
+
+	template <typename V, typename VectorFn, typename ScalarFn>
+	void expect_kernel_matches_scalar(const std::vector<typename V::value_type> & xs, VectorFn vector_fn, ScalarFn scalar_fn, const char * tag)
+	{
+		using T				= typename V::value_type;
+		constexpr int width = static_cast<int>(V::size());
+
+		for (std::size_t base = 0; base < xs.size(); base += width)
+		{
+			alignas(64) T xb[64];
+			const int count = static_cast<int>(std::min<std::size_t>(width, xs.size() - base));
+			for (int i = 0; i < width; ++i) { xb[i] = i < count ? xs[base + static_cast<std::size_t>(i)] : T(0.25); }
+
+			const V rv = vector_fn(V(xb, element_aligned));
+			for (int i = 0; i < count; ++i)
+			{
+				const T got = rv[i];
+				const T ref = scalar_fn(xb[i]);
+				EXPECT_TRUE(bit_equal(got, ref)) << tag << " x=" << xb[i] << " got=0x" << std::hex << float_bits(got) << " ref=0x" << float_bits(ref);
+			}
+		}
+	}
+
+	template <typename T, typename VectorFn, typename ScalarFn>
+	void expect_all_widths(const std::vector<T> & xs, VectorFn vector_fn, ScalarFn scalar_fn)
+	{
+		expect_kernel_matches_scalar<native_simd<T>>(xs, vector_fn, scalar_fn, "native");
+		expect_kernel_matches_scalar<simd<T, 1>>(xs, vector_fn, scalar_fn, "w1");
+		expect_kernel_matches_scalar<simd<T, 2>>(xs, vector_fn, scalar_fn, "w2");
+		expect_kernel_matches_scalar<simd<T, 4>>(xs, vector_fn, scalar_fn, "w4");
+		if constexpr (VecAbi<8>::template IsValid<T>::value) { expect_kernel_matches_scalar<simd<T, 8>>(xs, vector_fn, scalar_fn, "w8"); }
+		// Sixteen float lanes have no double vector of the same width, which exercises the split
+		// into halves of the float asin and atan bands.
+		if constexpr (VecAbi<16>::template IsValid<T>::value) { expect_kernel_matches_scalar<simd<T, 16>>(xs, vector_fn, scalar_fn, "w16"); }
+	}
+
+	// Every (y, x) pair drawn from a set covering each atan2 special case and every quadrant.
+	template <typename V>
+	void expect_atan2_matches_scalar(const char * tag)
+	{
+		using T				= typename V::value_type;
+		constexpr int width = static_cast<int>(V::size());
+		constexpr T inf		= std::numeric_limits<T>::infinity();
+
+		std::vector<T> values = { T(0), T(-0.0), inf, -inf, std::numeric_limits<T>::quiet_NaN(), T(1), T(-1), T(0.5), T(-3), T(1e-30), T(1e30),
+								  std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest() };
+		std::mt19937_64 rng(20260709ULL);
+		std::uniform_real_distribution<T> dist(T(-10), T(10));
+		for (int i = 0; i < 40; ++i) { values.push_back(dist(rng)); }
+
+		std::vector<T> ys;
+		std::vector<T> xs;
+		for (T y : values)
+		{
+			for (T x : values)
+			{
+				ys.push_back(y);
+				xs.push_back(x);
+			}
+		}
+
+		for (std::size_t base = 0; base < xs.size(); base += width)
+		{
+			alignas(64) T yb[64];
+			alignas(64) T xb[64];
+			const int count = static_cast<int>(std::min<std::size_t>(width, xs.size() - base));
+			for (int i = 0; i < width; ++i)
+			{
+				yb[i] = i < count ? ys[base + static_cast<std::size_t>(i)] : T(1);
+				xb[i] = i < count ? xs[base + static_cast<std::size_t>(i)] : T(1);
+			}
+
+			const V rv = ccm::internal::impl::atan2_simd_impl(V(yb, element_aligned), V(xb, element_aligned));
+			const V pv = ccm::pp::atan2(V(yb, element_aligned), V(xb, element_aligned));
+			for (int i = 0; i < count; ++i)
+			{
+				const T ref = ccm::internal::impl::atan2_impl<T>(yb[i], xb[i]);
+				EXPECT_TRUE(bit_equal(T(rv[i]), ref)) << tag << " y=" << yb[i] << " x=" << xb[i] << " got=" << T(rv[i]) << " ref=" << ref;
+				EXPECT_TRUE(bit_equal(T(pv[i]), ref)) << tag << " pp y=" << yb[i] << " x=" << xb[i];
+			}
+		}
+	}
+
+	template <typename T>
+	void expect_atan2_all_widths()
+	{
+		expect_atan2_matches_scalar<native_simd<T>>("native");
+		expect_atan2_matches_scalar<simd<T, 2>>("w2");
+		expect_atan2_matches_scalar<simd<T, 4>>("w4");
+		if constexpr (VecAbi<16>::template IsValid<T>::value) { expect_atan2_matches_scalar<simd<T, 16>>("w16"); }
+	}
+
+	template <typename T>
+	void expect_pp_routes_through_kernels()
+	{
+		const std::vector<T> xs = build_inputs<T>();
+		expect_kernel_matches_scalar<native_simd<T>>(xs, [](auto const & v) { return ccm::pp::asin(v); }, ccm::internal::impl::asin_impl<T>, "pp::asin");
+		expect_kernel_matches_scalar<native_simd<T>>(xs, [](auto const & v) { return ccm::pp::acos(v); }, ccm::internal::impl::acos_impl<T>, "pp::acos");
+		expect_kernel_matches_scalar<native_simd<T>>(xs, [](auto const & v) { return ccm::pp::atan(v); }, ccm::internal::impl::atan_impl<T>, "pp::atan");
+	}
+} // namespace
+
+TEST(CcmathInvTrigSimd, AsinBitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(build_inputs<float>(), [](auto const & v) { return ccm::internal::impl::asin_simd_impl(v); }, ccm::internal::impl::asin_impl<float>);
+}
+
+TEST(CcmathInvTrigSimd, AsinBitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(build_inputs<double>(), [](auto const & v) { return ccm::internal::impl::asin_simd_impl(v); }, ccm::internal::impl::asin_impl<double>);
+}
+
+TEST(CcmathInvTrigSimd, AcosBitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(build_inputs<float>(), [](auto const & v) { return ccm::internal::impl::acos_simd_impl(v); }, ccm::internal::impl::acos_impl<float>);
+}
+
+TEST(CcmathInvTrigSimd, AcosBitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(build_inputs<double>(), [](auto const & v) { return ccm::internal::impl::acos_simd_impl(v); }, ccm::internal::impl::acos_impl<double>);
+}
+
+TEST(CcmathInvTrigSimd, AtanBitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(build_inputs<float>(), [](auto const & v) { return ccm::internal::impl::atan_simd_impl(v); }, ccm::internal::impl::atan_impl<float>);
+}
+
+TEST(CcmathInvTrigSimd, AtanBitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(build_inputs<double>(), [](auto const & v) { return ccm::internal::impl::atan_simd_impl(v); }, ccm::internal::impl::atan_impl<double>);
+}
+
+TEST(CcmathInvTrigSimd, Atan2BitIdenticalToScalarKernelFloat)
+{
+	expect_atan2_all_widths<float>();
+}
+
+TEST(CcmathInvTrigSimd, Atan2BitIdenticalToScalarKernelDouble)
+{
+	expect_atan2_all_widths<double>();
+}
+
+TEST(CcmathInvTrigSimd, PpRoutesThroughKernelsFloat)
+{
+	expect_pp_routes_through_kernels<float>();
+}
+
+TEST(CcmathInvTrigSimd, PpRoutesThroughKernelsDouble)
+{
+	expect_pp_routes_through_kernels<double>();
+}
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// The vectorized sin, cos and tan kernels are contractually bit identical to the scalar kernels
+// on every lane, and so is each output of the fused sincos kernel. These tests pin that contract
+// across several vector widths, around the pi/8 reduction boundaries, across the small reduction
+// bound where lanes switch to Payne-Hanek, and on the signed zero, infinite and NaN lanes. The
+// lane Payne-Hanek reduction is pinned against the scalar one over every binade it serves.
+// pp::sin, pp::cos and pp::tan are checked to route through the kernels, and the fenv side effects of the
+// non-finite lanes are pinned against the scalar kernels.
+
+#include "ccmath/internal/math/runtime/pp/pp.hpp"
+#include "ccmath/math/trig/impl/sincos_simd_impl.hpp"
+#include "ccmath/math/trig/impl/tan_simd_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+	using namespace ccm::pp;
+
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	template <typename T>
+	T sin_scalar(T x)
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::sin_float_impl(x); }
+		else { return ccm::internal::impl::sin_double_impl(x); }
+	}
+
+	template <typename T>
+	T cos_scalar(T x)
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::cos_float_impl(x); }
+		else { return ccm::internal::impl::cos_double_impl(x); }
+	}
+
+	template <typename T>
+	T tan_scalar(T x)
+	{
+		if constexpr (std::is_same_v<T, float>) { return ccm::internal::impl::tan_float_impl(x); }
+		else { return ccm::internal::impl::tan_double_impl(x); }
+	}
+
+	template <typename T>
+	std::vector<T> build_inputs()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  T(1),
+							  T(-1),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::signaling_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  -std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::min(),
+							  std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest() };
+
+		for (T x = T(-20); x <= T(20); x += T(0.00731))
+		{
+			xs.push_back(x);
+		}
+
+		// Multiples of pi/8 and their neighbours, where k and the table index change.
+		const T pi_over_8 = static_cast<T>(0.39269908169872415481);
+		for (int m = -200; m <= 200; ++m)
+		{
+			const T c = static_cast<T>(m) * pi_over_8;
+			xs.push_back(c);
+			xs.push_back(std::nextafter(c, inf));
+			xs.push_back(std::nextafter(c, -inf));
+			xs.push_back(c + pi_over_8 / T(2));
+		}
+
+		// Around the small reduction bound (2^20 for double, 2^18 for float) and far beyond it.
+		for (int e = 14; e <= 24; ++e)
+		{
+			const T b = std::ldexp(T(1), e);
+			xs.push_back(b);
+			xs.push_back(-b);
+			xs.push_back(std::nextafter(b, T(0)));
+			xs.push_back(std::nextafter(b, inf));
+			xs.push_back(b * T(1.37));
+		}
+		for (int e = -60; e <= std::numeric_limits<T>::max_exponent - 1; e += 3)
+		{
+			xs.push_back(std::ldexp(T(1.3), e));
+			xs.push_back(-std::ldexp(T(1.7), e));
+		}
+
+		std::mt19937_64 rng(20260704ULL);
+		std::uniform_real_distribution<T> small(T(-1000), T(1000));
+		for (int i = 0; i < 20000; ++i) { xs.push_back(small(rng)); }
+		std::uniform_real_distribution<T> mantissa(T(1), T(2));
+		std::uniform_int_distribution<int> exponent(-30, std::numeric_limits<T>::max_exponent - 1);
+		for (int i = 0; i < 4000; ++i) { xs.push_back(std::ldexp(mantissa(rng), exponent(rng))); }
+		return xs;
+	}
+
+	template <typename V, typename VectorFn, typename ScalarFn>
+	void expect_kernel_matches_scalar(const std::vector<typename V::value_type> & xs, VectorFn vector_fn, ScalarFn scalar_fn, const char * tag)
+	{
+		using T				= typename V::value_type;
+		constexpr int width = static_cast<int>(V::size());
+
+		for (std::size_t base = 0; base < xs.size(); base += width)
+		{
+			alignas(64) T xb[64];
+			const int count = static_cast<int>(std::min<std::size_t>(width, xs.size() - base));
+			for (int i = 0; i < width; ++i) { xb[i] = i < count ? xs[base + static_cast<std::size_t>(i)] : T(1.5); }
+
+			const V rv = vector_fn(V(xb, element_aligned));
+			for (int i = 0; i < count; ++i)
+			{
+				const T got = rv[i];
+				const T ref = scalar_fn(xb[i]);
+				EXPECT_TRUE(bit_equal(got, ref)) << tag << " x=" << xb[i] << " got=0x" << std::hex << float_bits(got) << " ref=0x" << float_bits(ref);
+			}
+		}
+	}
+
+	template <typename T, typename VectorFn, typename ScalarFn>
+	void expect_all_widths(const std::vector<T> & xs, VectorFn vector_fn, ScalarFn scalar_fn)
+	{
+		expect_kernel_matches_scalar<native_simd<T>>(xs, vector_fn, scalar_fn, "native");
+		expect_kernel_matches_scalar<simd<T, 2>>(xs, vector_fn, scalar_fn, "w2");
+		expect_kernel_matches_scalar<simd<T, 4>>(xs, vector_fn, scalar_fn, "w4");
+		if constexpr (VecAbi<8>::template IsValid<T>::value) { expect_kernel_matches_scalar<simd<T, 8>>(xs, vector_fn, scalar_fn, "w8"); }
+		else { GTEST_SKIP() << "8-wide simd not available on this target"; }
+	}
+
+	struct FenvObservation
+	{
+		bool invalid;
+		int err;
+	};
+
+	template <typename F>
+	FenvObservation observe_fenv(F && run)
+	{
+		std::feclearexcept(FE_ALL_EXCEPT);
+		errno = 0;
+		run();
+		return { std::fetestexcept(FE_INVALID) != 0, errno };
+	}
+} // namespace
+
+TEST(CcmathSinCosSimd, SinBitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(build_inputs<float>(), [](auto const & v) { return ccm::internal::impl::sin_simd_impl(v); }, sin_scalar<float>);
+}
+
+TEST(CcmathSinCosSimd, SinBitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(build_inputs<double>(), [](auto const & v) { return ccm::internal::impl::sin_simd_impl(v); }, sin_scalar<double>);
+}
+
+TEST(CcmathSinCosSimd, CosBitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(build_inputs<float>(), [](auto const & v) { return ccm::internal::impl::cos_simd_impl(v); }, cos_scalar<float>);
+}
+
+TEST(CcmathSinCosSimd, CosBitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(build_inputs<double>(), [](auto const & v) { return ccm::internal::impl::cos_simd_impl(v); }, cos_scalar<double>);
+}
+
+TEST(CcmathSinCosSimd, TanBitIdenticalToScalarKernelFloat)
+{
+	expect_all_widths(build_inputs<float>(), [](auto const & v) { return ccm::internal::impl::tan_simd_impl(v); }, tan_scalar<float>);
+}
+
+TEST(CcmathSinCosSimd, TanBitIdenticalToScalarKernelDouble)
+{
+	expect_all_widths(build_inputs<double>(), [](auto const & v) { return ccm::internal::impl::tan_simd_impl(v); }, tan_scalar<double>);
+}
+
+TEST(CcmathSinCosSimd, FusedSinCosBitIdenticalToScalarKernelFloat)
+{
+	const auto xs = build_inputs<float>();
+	expect_all_widths(xs, [](auto const & v) { std::decay_t<decltype(v)> s, c; ccm::internal::impl::sincos_simd_impl(v, s, c); return s; }, sin_scalar<float>);
+	expect_all_widths(xs, [](auto const & v) { std::decay_t<decltype(v)> s, c; ccm::internal::impl::sincos_simd_impl(v, s, c); return c; }, cos_scalar<float>);
+}
+
+TEST(CcmathSinCosSimd, FusedSinCosBitIdenticalToScalarKernelDouble)
+{
+	const auto xs = build_inputs<double>();
+	expect_all_widths(xs, [](auto const & v) { std::decay_t<decltype(v)> s, c; ccm::internal::impl::sincos_simd_impl(v, s, c); return s; }, sin_scalar<double>);
+	expect_all_widths(xs, [](auto const & v) { std::decay_t<decltype(v)> s, c; ccm::internal::impl::sincos_simd_impl(v, s, c); return c; }, cos_scalar<double>);
+}
+
+TEST(CcmathSinCosSimd, LanePayneHanekMatchesScalarReduction)
+{
+	using VD = native_simd<double>;
+	using VK = native_simd<std::int64_t>;
+
+	// Every binade from the float bound 2^18 up, at both ends of the mantissa and in between, so
+	// every limb offset and word window of the reduction is exercised.
+	std::vector<double> xs;
+	std::mt19937_64 rng(20260707ULL);
+	std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+	for (int e = 18; e <= 1023; ++e)
+	{
+		const double lo = std::ldexp(1.0, e);
+		xs.push_back(lo);
+		xs.push_back(-std::nextafter(lo * 2.0, 0.0));
+		for (int i = 0; i < 6; ++i) { xs.push_back(std::ldexp(i % 2 == 0 ? mantissa(rng) : -mantissa(rng), e)); }
+	}
+	// The range an orbital propagator feeds through sin and cos.
+	std::uniform_real_distribution<double> orbital(1e12, 1e15);
+	for (int i = 0; i < 2000; ++i) { xs.push_back(orbital(rng)); }
+
+	constexpr int width = static_cast<int>(VD::size());
+	for (std::size_t base = 0; base < xs.size(); base += width)
+	{
+		const VD x([&](auto i) { return base + i < xs.size() ? xs[base + i] : 0x1.0p20; });
+		VD y;
+		const VK k = ccm::internal::impl::sincos_simd_detail::payne_hanek_reduce(x, y);
+		for (int i = 0; i < width; ++i)
+		{
+			double ref_y{};
+			const unsigned ref_k = ccm::internal::impl::sincos_ph::payne_hanek_reduce(x[i], ref_y);
+			EXPECT_EQ(static_cast<unsigned>(k[i]), ref_k) << "x=" << x[i];
+			EXPECT_TRUE(bit_equal(static_cast<double>(y[i]), ref_y)) << "x=" << x[i];
+		}
+	}
+}
+
+TEST(CcmathSinCosSimd, PpSinCosTanRouteThroughKernels)
+{
+	const native_simd<double> xd([](auto i) { return -3.0 + 1.7 * static_cast<double>(i); });
+	const native_simd<float> xf([](auto i) { return -3.0F + 1.7F * static_cast<float>(i); });
+
+	const auto sd = ccm::pp::sin(xd);
+	const auto cd = ccm::pp::cos(xd);
+	const auto sf = ccm::pp::sin(xf);
+	const auto cf = ccm::pp::cos(xf);
+	const auto td = ccm::pp::tan(xd);
+	const auto tf = ccm::pp::tan(xf);
+	for (int i = 0; i < static_cast<int>(xd.size()); ++i)
+	{
+		EXPECT_TRUE(bit_equal(sd[i], sin_scalar(xd[i])));
+		EXPECT_TRUE(bit_equal(cd[i], cos_scalar(xd[i])));
+		EXPECT_TRUE(bit_equal(td[i], tan_scalar(xd[i])));
+	}
+	for (int i = 0; i < static_cast<int>(xf.size()); ++i)
+	{
+		EXPECT_TRUE(bit_equal(sf[i], sin_scalar(xf[i])));
+		EXPECT_TRUE(bit_equal(cf[i], cos_scalar(xf[i])));
+		EXPECT_TRUE(bit_equal(tf[i], tan_scalar(xf[i])));
+	}
+}
+
+TEST(CcmathSinCosSimd, FenvAndErrnoParityWithScalarKernel)
+{
+	using VD = native_simd<double>;
+	using VF = native_simd<float>;
+
+	for (double x : { std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), 1e300, 0.5 })
+	{
+		volatile double simd_out		= 0.0;
+		volatile double scal_out		= 0.0;
+		const FenvObservation simd_obs = observe_fenv([&] { simd_out = ccm::internal::impl::sin_simd_impl(VD(x))[0]; });
+		const FenvObservation scal_obs = observe_fenv([&] { scal_out = sin_scalar(x); });
+		EXPECT_EQ(simd_obs.invalid, scal_obs.invalid) << "FE_INVALID differs for sin(" << x << ")";
+		EXPECT_EQ(simd_obs.err, scal_obs.err) << "errno differs for sin(" << x << ")";
+	}
+
+	for (float x : { std::numeric_limits<float>::infinity(), 3e38F, 0.5F })
+	{
+		volatile float simd_out		= 0.0F;
+		volatile float scal_out		= 0.0F;
+		const FenvObservation simd_obs = observe_fenv([&] { simd_out = ccm::internal::impl::cos_simd_impl(VF(x))[0]; });
+		const FenvObservation scal_obs = observe_fenv([&] { scal_out = cos_scalar(x); });
+		EXPECT_EQ(simd_obs.invalid, scal_obs.invalid) << "FE_INVALID differs for cosf(" << x << ")";
+		EXPECT_EQ(simd_obs.err, scal_obs.err) << "errno differs for cosf(" << x << ")";
+	}
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include "ccmath/ccmath.hpp"
+#include "ccmath/internal/math/generic/func/trig/cos_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/sin_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	auto float_bits(T value)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			std::uint32_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+		else
+		{
+			std::uint64_t out{};
+			std::memcpy(&out, &value, sizeof(out));
+			return out;
+		}
+	}
+
+	// NaN payloads are not part of the contract, so any NaN matches any NaN.
+	template <typename T>
+	bool bit_equal(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return float_bits(a) == float_bits(b);
+	}
+
+	template <typename T>
+	std::vector<T> build_inputs()
+	{
+		constexpr T inf	  = std::numeric_limits<T>::infinity();
+		std::vector<T> xs = { T(0),
+							  T(-0.0),
+							  inf,
+							  -inf,
+							  std::numeric_limits<T>::quiet_NaN(),
+							  std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::max(),
+							  std::numeric_limits<T>::lowest() };
+		for (int e = -40; e <= std::numeric_limits<T>::max_exponent - 1; ++e)
+		{
+			xs.push_back(std::ldexp(T(1.3), e));
+			xs.push_back(-std::ldexp(T(1.9), e));
+		}
+
+		std::mt19937_64 rng(20260706ULL);
+		std::uniform_real_distribution<T> dist(T(-50), T(50));
+		for (int i = 0; i < 5000; ++i) { xs.push_back(dist(rng)); }
+		return xs;
+	}
+
+	template <typename T>
+	void expect_fused_kernel_matches_separate()
+	{
+		for (T x : build_inputs<T>())
+		{
+			T s{};
+			T c{};
+			ccm::gen::sincos_gen(x, s, c);
+			EXPECT_TRUE(bit_equal(s, ccm::gen::sin_gen(x))) << "sin x=" << x;
+			EXPECT_TRUE(bit_equal(c, ccm::gen::cos_gen(x))) << "cos x=" << x;
+		}
+	}
+
+	template <typename T>
+	void expect_public_matches_sin_and_cos()
+	{
+		for (T x : build_inputs<T>())
+		{
+			T s{};
+			T c{};
+			ccm::sincos(x, &s, &c);
+			EXPECT_TRUE(bit_equal(s, ccm::sin(x))) << "sin x=" << x;
+			EXPECT_TRUE(bit_equal(c, ccm::cos(x))) << "cos x=" << x;
+
+			const auto [ps, pc] = ccm::sincos(x);
+			EXPECT_TRUE(bit_equal(ps, s)) << "pair sin x=" << x;
+			EXPECT_TRUE(bit_equal(pc, c)) << "pair cos x=" << x;
+		}
+	}
+} // namespace
+
+TEST(CcmathSinCosTests, ConstexprSmoke)
+{
+	constexpr auto zero = ccm::sincos(0.0);
+	static_assert(zero.first == 0.0 && zero.second == 1.0, "ccm::sincos(0) must be (0, 1) at compile time");
+
+	constexpr auto half = ccm::sincos(0.5F);
+	static_assert(half.first == ccm::sin(0.5F) && half.second == ccm::cos(0.5F), "ccm::sincos must match ccm::sin and ccm::cos at compile time");
+}
+
+TEST(CcmathSinCosTests, FusedKernelMatchesSeparateKernelsFloat)
+{
+	expect_fused_kernel_matches_separate<float>();
+}
+
+TEST(CcmathSinCosTests, FusedKernelMatchesSeparateKernelsDouble)
+{
+	expect_fused_kernel_matches_separate<double>();
+}
+
+TEST(CcmathSinCosTests, MatchesSinAndCosFloat)
+{
+	expect_public_matches_sin_and_cos<float>();
+}
+
+TEST(CcmathSinCosTests, MatchesSinAndCosDouble)
+{
+	expect_public_matches_sin_and_cos<double>();
+}
+
+TEST(CcmathSinCosTests, TypedAliasesAndIntegralPromotion)
+{
+	float sf{};
+	float cf{};
+	ccm::sincosf(1.0F, &sf, &cf);
+	EXPECT_EQ(sf, ccm::sinf(1.0F));
+	EXPECT_EQ(cf, ccm::cosf(1.0F));
+
+	long double sl{};
+	long double cl{};
+	ccm::sincosl(1.0L, &sl, &cl);
+	EXPECT_EQ(sl, ccm::sinl(1.0L));
+	EXPECT_EQ(cl, ccm::cosl(1.0L));
+
+	const auto [si, ci] = ccm::sincos(2);
+	EXPECT_EQ(si, ccm::sin(2));
+	EXPECT_EQ(ci, ccm::cos(2));
+}
+
+TEST(CcmathSinCosTests, InfinityIsADomainError)
+{
+	for (double x : { std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity() })
+	{
+		std::feclearexcept(FE_ALL_EXCEPT);
+		errno = 0;
+		double s{};
+		double c{};
+		ccm::gen::sincos_gen(x, s, c);
+		EXPECT_TRUE(std::isnan(s));
+		EXPECT_TRUE(std::isnan(c));
+		if (math_errhandling & MATH_ERRNO) { EXPECT_EQ(errno, EDOM); }
+		if (math_errhandling & MATH_ERREXCEPT) { EXPECT_NE(std::fetestexcept(FE_INVALID), 0); }
+	}
+}
@@ -11,7 +11,7 @@
 // Regression coverage for the generic trig kernels (the path used for constexpr and the
 // non-builtin runtime). Pins the defects fixed in the trig overhaul: the large-argument
 // reduction collapse, the float-grade double kernel, the sign of a signed zero, the asin
-// tiny-|x| cubic sign, and the float atan accuracy. Goldens are MPFR correctly-rounded values;
+// tiny-|x| cubic sign, and the float atan accuracy, plus the single-reduction tan kernel. Goldens are MPFR correctly-rounded values;
 // the accuracy contract is 4 ULP.
 
 #include "ccmath/internal/math/generic/func/trig/cos_gen.hpp"
@@ -21,8 +21,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <random>
 
 namespace
 {
@@ -83,6 +85,29 @@ TEST(CcmathTrigKernelRegression, FloatWithinContract)
 	EXPECT_LE(f_ulp(ccm::internal::impl::atan_impl<float>(f_from(0x3f210625U)), f_from(0x3f0fbc89U)), 4); // atan(0.629)
 }
 
+TEST(CcmathTrigKernelRegression, TanWithinContract)
+{
+	// The tan kernel reuses the sin/cos reduction with its own polynomial and one quotient, so
+	// it has to hold the same contract on every pi/8 sector, near the poles and past the small
+	// reduction bound. The long double tan, rounded once, is the reference.
+	std::mt19937_64 rng(20260708ULL);
+	std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+	for (int e = -12; e <= 40; ++e)
+	{
+		for (int i = 0; i < 2000; ++i)
+		{
+			const double x = std::ldexp(i % 2 == 0 ? mantissa(rng) : -mantissa(rng), e);
+			EXPECT_LE(d_ulp(ccm::gen::tan_gen<double>(x), static_cast<double>(std::tan(static_cast<long double>(x)))), 4) << "x=" << x;
+
+			// The float small-range reduction only keeps k * MPI[0] exact past |x| ~ 25 when
+			// multiply_add is fused, which sin and cos share, so the float check stays below that.
+			if (e > 3) { continue; }
+			const auto xf = static_cast<float>(x);
+			EXPECT_LE(f_ulp(ccm::gen::tan_gen<float>(xf), static_cast<float>(std::tan(static_cast<double>(xf)))), 4) << "x=" << xf;
+		}
+	}
+}
+
 TEST(CcmathTrigKernelRegression, AsinTinyArgument)
 {
 	// The tiny-|x| fast path used the wrong cubic sign (returned x - x^3/6 instead of x + x^3/6).
@@ -10,6 +10,7 @@
 
 import json
 import os
+import re
 import shutil
 import subprocess
 import sys
@@ -333,6 +334,89 @@ def load_benchmark_profiles():
     return load_json_registry(BENCHMARK_PROFILES_PATH)
 
 
+PERF_COUNTER_NAMES = ("cycles_per_op", "instructions_per_op", "ipc",
+                      "branch_misses_per_op", "l1d_misses_per_op")
+# Google Benchmark prints counters with SI prefixes: kMGTPEZY above one, munpfazy below it.
+_SI_SCALE = {"": 1.0}
+_SI_SCALE.update({u: 1e3 ** (i + 1) for i, u in enumerate("kMGTPEZY")})
+_SI_SCALE.update({u: 1e-3 ** (i + 1) for i, u in enumerate("munpfazy")})
+_SI_VALUE = r"([\d.]+(?:[eE][-+]?\d+)?)([%s]?)" % "".join(u for u in _SI_SCALE if u)
+_PERF_COUNTER_RE = re.compile(r"\b(%s)=%s" % ("|".join(PERF_COUNTER_NAMES), _SI_VALUE))
+
+
+def parse_perf_counters(raw):
+    """Hardware counters per benchmark from Google Benchmark console output.
+
+    The ccm_benchmark_* harness reports them when run with CCM_BENCH_PERF=1 and
+    the kernel grants perf_event_open (benchmarks/shared/perf_counters.hpp).
+    Returns {benchmark_name: {counter: value}}; empty when none were reported.
+    """
+    out = {}
+    for line in raw.splitlines():
+        hits = _PERF_COUNTER_RE.findall(line)
+        if not hits or not line.startswith("BM_"):
+            continue
+        out[line.split()[0]] = {name: float(v) * _SI_SCALE[unit] for name, v, unit in hits}
+    return out
+
+
+_PATH_STAT_RE = re.compile(r"\bpath\.([a-z0-9_]+\.[a-z0-9_]+)=%s" % _SI_VALUE)
+
+
+def load_path_stat_labels():
+    """Counter name -> {category, slow} from path_categories.json's path_stats section."""
+    return load_json_registry(PATH_CATEGORIES_PATH).get("path_stats", {})
+
+
+def parse_path_stats(raw):
+    """Kernel path hits per element from Google Benchmark console output.
+
+    A ccmath built with CCMATH_ENABLE_PATH_STATS reports them as path.<name>
+    counters (benchmarks/shared/perf_counters.hpp). Each hit is labelled from
+    path_categories.json; counters the registry does not know get "unknown".
+    Returns {benchmark_name: {"paths": {name: {...}}, "slow_per_op": x}}.
+    """
+    labels = load_path_stat_labels()
+    out = {}
+    for line in raw.splitlines():
+        if not line.startswith("BM_"):
+            continue
+        hits = _PATH_STAT_RE.findall(line)
+        if not hits:
+            continue
+        paths = {}
+        slow = 0.0
+        for name, v, unit in hits:
+            per_op = float(v) * _SI_SCALE[unit]
+            label = labels.get(name, {})
+            paths[name] = {
+                "per_op": per_op,
+                "category": label.get("category", "unknown"),
+                "slow": bool(label.get("slow", False)),
+            }
+            if paths[name]["slow"]:
+                slow += per_op
+        out[line.split()[0]] = {"paths": paths, "slow_per_op": slow}
+    return out
+
+
+def static_estimates(fn):
+    """llvm-mca cycle estimates per analyzed variant of fn, read from out/asmlab/<fn>/*/metrics.json."""
+    out = {}
+    fn_dir = OUT_DIR / fn
+    if not fn_dir.is_dir():
+        return out
+    for path in sorted(fn_dir.glob("*/metrics.json")):
+        try:
+            mca = json.loads(path.read_text()).get("llvm_mca") or {}
+        except (OSError, ValueError):
+            continue
+        est = mca.get("static_model_estimate_cycles", mca.get("block_rthroughput"))
+        if est is not None:
+            out[path.parent.name] = est
+    return out
+
+
 def harness_mode(target):
     return target.get("harness_mode", "runtime_flatten")
 
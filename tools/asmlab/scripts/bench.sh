@@ -16,6 +16,12 @@
 #   scripts/bench.sh sqrt --profile positive_finite_general --mode latency
 #   scripts/bench.sh diff sqrt --profile positive_finite_general
 #   scripts/bench.sh powf --profile near_one   # fails clearly if not wired
+#
+# Hardware counters (cycles, instructions, branch and L1D misses per op) are
+# requested from the harness with CCM_BENCH_PERF=1 unless the caller sets it;
+# they are stored next to the llvm-mca estimates of analyzed variants.
+# Kernel path hits (ccmath configured with CCMATH_ENABLE_PATH_STATS=ON) are
+# stored too, labelled from registry/path_categories.json.
 
 set -euo pipefail
 
@@ -25,6 +31,7 @@ profiles_json="${script_dir}/../registry/benchmark_profiles.json"
 registry_json="${script_dir}/../registry/functions.json"
 benches_dir="${project_root}/out/asmlab/benches"
 build_dir="${project_root}/out/asmlab-bench"
+export CCM_BENCH_PERF="${CCM_BENCH_PERF:-1}"
 
 action="run"
 fn=""
@@ -194,10 +201,15 @@ run_bench() {
     echo "${output}"
 
     mkdir -p "${benches_dir}"
-    python3 - "${benches_dir}/${fn}-${profile}.json" "${fn}" "${profile}" "${bench_mode}" "${output}" <<'PY'
+    python3 - "${benches_dir}/${fn}-${profile}.json" "${fn}" "${profile}" "${bench_mode}" "${output}" "${script_dir}" <<'PY'
 import json, sys, re, datetime
-out_path, fn, profile, mode, raw = sys.argv[1:6]
+out_path, fn, profile, mode, raw, script_dir = sys.argv[1:7]
+sys.path.insert(0, script_dir)
+import _asmlab_common as C
 ns_vals = [float(x) for x in re.findall(r"([\d.]+)\s*ns", raw)]
+counters = C.parse_perf_counters(raw)
+path_stats = C.parse_path_stats(raw)
+estimates = C.static_estimates(fn)
 doc = {
     "function": fn,
     "profile": profile,
@@ -206,11 +218,24 @@ doc = {
     "bench_note": "bench alone is not a merge signal",
     "samples": len(ns_vals),
     "result_ns": min(ns_vals) if ns_vals else None,
+    "perf_counters": counters or None,
+    "perf_note": None if counters else "no hardware counters reported (perf_event_open unavailable or CCM_BENCH_PERF=0)",
+    "static_model_estimate_cycles": estimates or None,
+    "path_stats": path_stats or None,
     "raw_excerpt": raw[-2000:],
 }
 with open(out_path, "w") as fh:
     json.dump(doc, fh, indent=2)
     fh.write("\n")
+if counters and estimates:
+    print("measured cycles/op vs llvm-mca static estimate:")
+    for name in sorted(counters):
+        if "cycles_per_op" in counters[name]:
+            print("  %-60s %8.2f" % (name, counters[name]["cycles_per_op"]))
+    for variant in sorted(estimates):
+        print("  %-60s %8s (static)" % (variant, estimates[variant]))
+for name in sorted(path_stats):
+    print("%-60s slow paths per op: %.4f" % (name, path_stats[name]["slow_per_op"]))
 print("wrote", out_path)
 PY
 }
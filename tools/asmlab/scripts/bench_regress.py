@@ -0,0 +1,424 @@
+#!/usr/bin/env python3
+# Copyright (c) Ian Pike
+# Copyright (c) CCMath contributors
+#
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+"""Benchmark regression tracking: Google Benchmark JSON baselines per function/profile.
+
+record stores a repeated run of a function's profile benchmarks as the baseline.
+compare repeats the run and tests every benchmark against the baseline with a
+one-sided Mann-Whitney U test on the per-repetition times. A benchmark regresses
+only when the slowdown is significant at --alpha after a Holm correction over all
+ccmath benchmarks of the profile and the median moved by more than --threshold, so
+neither run-to-run noise nor the number of sizes tested fails the gate. The
+std benchmarks of the same run are controls: they never fail, but a control that
+moves past the threshold is reported as likely machine drift.
+"""
+
+import json
+import math
+import os
+import re
+import sys
+from pathlib import Path
+
+import _asmlab_common as C
+import run_meta as prov_mod
+
+BUILD_DIR = C.PROJECT_ROOT / "out" / "asmlab-bench"
+BASELINE_DIR = C.OUT_DIR / "baselines" / "bench"
+BENCHES_DIR = C.OUT_DIR / "benches"
+REPORTS_DIR = C.OUT_DIR / "reports"
+MODULE_REGISTRY = C.PROJECT_ROOT / "cmake" / "config" / "BenchmarkModuleRegistry.cmake"
+
+DEFAULT_REPETITIONS = 10
+DEFAULT_MIN_TIME = 0.1
+DEFAULT_THRESHOLD = 0.05
+DEFAULT_ALPHA = 0.05
+MIN_SAMPLES = 5
+EXACT_LIMIT = 40
+
+_TIME_SCALE = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+# Suites that are not asmlab profiles but are tracked the same way.
+EXTRA_SUITES = ("path_mix", "latency", "throughput")
+
+
+def bench_module(fn):
+    """Benchmark module of fn from BenchmarkModuleRegistry.cmake, or None."""
+    text = MODULE_REGISTRY.read_text()
+    for m in re.finditer(r"set\(CCMATH_BENCH_MODULE_(\w+)_FUNCTIONS\s+([^)]*)\)", text):
+        if fn in m.group(2).split():
+            return m.group(1)
+    return None
+
+
+def resolve(fn, profile):
+    """Target, configure option and name filter for fn's profile benchmarks."""
+    module = bench_module(fn)
+    if module is None:
+        return {"error": "no ccm_benchmark target for %s in %s" % (
+            fn, MODULE_REGISTRY.relative_to(C.PROJECT_ROOT))}
+    profiles = C.load_benchmark_profiles().get("profiles", {})
+    if profile in profiles:
+        suite = "%s_stream" % profile
+    elif profile in EXTRA_SUITES:
+        suite = profile
+    else:
+        return {"error": "unknown profile %s (registry profiles or %s)" % (
+            profile, ", ".join(EXTRA_SUITES))}
+    return {
+        "module": module,
+        "cmake_opt": "CCM_BENCH_%s" % module.upper(),
+        "target": "ccm_benchmark_%s" % fn,
+        "filter": "^BM_%s_%s_(ccm|std)(_rt)?_%s(/|$)" % (module, fn, suite),
+    }
+
+
+def build_target(info):
+    BUILD_DIR.mkdir(parents=True, exist_ok=True)
+    gen_args, build_config = C.cmake_generator_args()
+    res = C.run(["cmake", "-S", str(C.PROJECT_ROOT), "-B", str(BUILD_DIR), *gen_args,
+                 "-DCCMATH_BUILD_BENCHMARKS=ON", "-DCCMATH_BUILD_TESTS=OFF",
+                 "-DCCMATH_BUILD_EXAMPLES=OFF", "-D%s=ON" % info["cmake_opt"]])
+    if res.returncode != 0:
+        return None, "cmake configure failed: %s" % res.stderr[-2000:]
+    res = C.run(C.cmake_build_command(BUILD_DIR, info["target"], build_config))
+    if res.returncode != 0:
+        return None, "build failed for %s: %s" % (info["target"], res.stderr[-2000:])
+    binary = C.find_built_program(BUILD_DIR, info["target"])
+    if not binary:
+        return None, "binary not found: %s" % info["target"]
+    return binary, None
+
+
+def run_benchmarks(binary, info, repetitions, min_time, extra_args=()):
+    """Run the profile benchmarks with repetitions; returns (Google Benchmark JSON, error)."""
+    cmd = [str(binary), "--benchmark_filter=%s" % info["filter"],
+           "--benchmark_repetitions=%d" % repetitions,
+           "--benchmark_min_time=%g" % min_time,
+           "--benchmark_enable_random_interleaving=true",
+           "--benchmark_format=json", *extra_args]
+    # Hardware counters and path stats add work to every iteration; time without them.
+    env = dict(os.environ, CCM_BENCH_PERF="0")
+    res = C.run(cmd, env=env)
+    if res.returncode != 0:
+        return None, "benchmark exited %d: %s" % (res.returncode, res.stderr[-2000:])
+    try:
+        return json.loads(res.stdout), None
+    except ValueError:
+        return None, "benchmark did not print JSON"
+
+
+def load_run(fn, profile, args):
+    """Google Benchmark JSON for fn/profile from --input, --binary, or a fresh build."""
+    if args.input:
+        return json.loads(Path(args.input).read_text()), None
+    info = resolve(fn, profile)
+    if info.get("error"):
+        return None, info["error"]
+    binary = Path(args.binary) if args.binary else None
+    if binary is None:
+        binary, err = build_target(info)
+        if err:
+            return None, err
+    return run_benchmarks(binary, info, args.repetitions, args.min_time, args.bench_args)
+
+
+def samples(doc, metric):
+    """Per-repetition times in ns keyed by benchmark name; aggregates are skipped."""
+    out = {}
+    for b in doc.get("benchmarks", []):
+        if b.get("run_type", "iteration") != "iteration" or b.get("error_occurred"):
+            continue
+        scale = _TIME_SCALE.get(b.get("time_unit", "ns"), 1.0)
+        out.setdefault(b.get("run_name", b["name"]), []).append(float(b[metric]) * scale)
+    return out
+
+
+def _median(xs):
+    s = sorted(xs)
+    n = len(s)
+    return s[n // 2] if n % 2 else 0.5 * (s[n // 2 - 1] + s[n // 2])
+
+
+def _ranks(values):
+    order = sorted(range(len(values)), key=lambda i: values[i])
+    ranks = [0.0] * len(values)
+    i = 0
+    while i < len(order):
+        j = i
+        while j + 1 < len(order) and values[order[j + 1]] == values[order[i]]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[order[k]] = 0.5 * (i + j) + 1.0
+        i = j + 1
+    return ranks
+
+
+def _exact_u_cdf(u, n1, n2):
+    """P(U <= u) for the Mann-Whitney U of n1 against n2 untied samples."""
+    # counts[n][m][k]: arrangements of n and m samples whose U is k.
+    counts = {(0, m): [1] for m in range(n2 + 1)}
+    counts.update({(n, 0): [1] for n in range(n1 + 1)})
+    for n in range(1, n1 + 1):
+        for m in range(1, n2 + 1):
+            a, b = counts[(n - 1, m)], counts[(n, m - 1)]
+            size = n * m + 1
+            row = [0] * size
+            for k, c in enumerate(a):
+                row[k + m] += c
+            for k, c in enumerate(b):
+                row[k] += c
+            counts[(n, m)] = row
+    row = counts[(n1, n2)]
+    return sum(row[:int(math.floor(u)) + 1]) / float(sum(row))
+
+
+def mann_whitney_greater(xs, ys):
+    """One-sided p-value that xs tend to be larger than ys."""
+    n1, n2 = len(xs), len(ys)
+    ranks = _ranks(list(xs) + list(ys))
+    u = sum(ranks[:n1]) - n1 * (n1 + 1) / 2.0
+    tied = len(set(xs) | set(ys)) < n1 + n2
+    if not tied and n1 + n2 <= EXACT_LIMIT:
+        # U >= u is U' <= n1 n2 - u for the mirrored statistic.
+        return _exact_u_cdf(n1 * n2 - u, n1, n2)
+    n = n1 + n2
+    tie_sum = 0.0
+    for v in set(xs) | set(ys):
+        t = list(xs).count(v) + list(ys).count(v)
+        tie_sum += t ** 3 - t
+    var = n1 * n2 / 12.0 * ((n + 1) - tie_sum / (n * (n - 1)))
+    if var <= 0:
+        return 1.0
+    z = (u - n1 * n2 / 2.0 - 0.5) / math.sqrt(var)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def _cv(xs):
+    if len(xs) < 2:
+        return None
+    mean = sum(xs) / len(xs)
+    var = sum((x - mean) ** 2 for x in xs) / (len(xs) - 1)
+    return math.sqrt(var) / mean if mean else None
+
+
+def compare_samples(base, cur):
+    """Medians, noise and U-test p-values of one benchmark's baseline and current times."""
+    b_med, c_med = _median(base), _median(cur)
+    row = {
+        "baseline_median_ns": b_med,
+        "current_median_ns": c_med,
+        "delta": (c_med - b_med) / b_med if b_med else None,
+        "baseline_cv": _cv(base),
+        "current_cv": _cv(cur),
+        "samples": [len(base), len(cur)],
+    }
+    if min(len(base), len(cur)) < MIN_SAMPLES:
+        row.update(p_slower=None, p_faster=None, verdict="inconclusive",
+                   reason="fewer than %d repetitions" % MIN_SAMPLES)
+        return row
+    row["p_slower"] = mann_whitney_greater(cur, base)
+    row["p_faster"] = mann_whitney_greater(base, cur)
+    return row
+
+
+def holm_adjust(pvalues):
+    """Holm step-down adjusted p-values, keyed like pvalues."""
+    order = sorted(pvalues, key=lambda k: pvalues[k])
+    m = len(order)
+    out, running = {}, 0.0
+    for i, key in enumerate(order):
+        running = max(running, min(1.0, (m - i) * pvalues[key]))
+        out[key] = running
+    return out
+
+
+def _judge(rows, threshold, alpha):
+    """Set the verdict of every compared row, correcting each role's p-values together."""
+    for role in ("ccmath", "control"):
+        tested = {n: r for n, r in rows.items() if r["role"] == role and r.get("p_slower") is not None}
+        slower = holm_adjust({n: r["p_slower"] for n, r in tested.items()})
+        faster = holm_adjust({n: r["p_faster"] for n, r in tested.items()})
+        for name, r in tested.items():
+            r["p_slower_holm"], r["p_faster_holm"] = slower[name], faster[name]
+            if slower[name] < alpha and r["delta"] > threshold:
+                r["verdict"] = "regression"
+            elif faster[name] < alpha and r["delta"] < -threshold:
+                r["verdict"] = "improvement"
+            else:
+                r["verdict"] = "unchanged"
+
+
+def _context_warnings(base_doc, cur_doc):
+    b, c = base_doc.get("context", {}), cur_doc.get("context", {})
+    warnings = []
+    for key in ("host_name", "num_cpus", "mhz_per_cpu"):
+        if b.get(key) != c.get(key):
+            warnings.append("%s differs from the baseline (%s -> %s)" % (key, b.get(key), c.get(key)))
+    if c.get("cpu_scaling_enabled"):
+        warnings.append("CPU frequency scaling is enabled; timings are noisy")
+    if c.get("library_build_type") == "debug":
+        warnings.append("Google Benchmark library is a debug build")
+    return warnings
+
+
+def compare_runs(base_doc, cur_doc, metric, threshold, alpha):
+    """Per-benchmark verdicts plus the overall pass/fail of cur_doc against base_doc."""
+    base, cur = samples(base_doc, metric), samples(cur_doc, metric)
+    rows = {}
+    for name in sorted(set(base) | set(cur)):
+        role = "control" if "_std_" in name else "ccmath"
+        if name not in cur:
+            rows[name] = {"role": role, "verdict": "missing"}
+        elif name not in base:
+            rows[name] = {"role": role, "verdict": "new"}
+        else:
+            rows[name] = dict(compare_samples(base[name], cur[name]), role=role)
+    _judge(rows, threshold, alpha)
+
+    regressions = sorted(n for n, r in rows.items() if r["role"] == "ccmath" and r["verdict"] == "regression")
+    drift = [r["delta"] for r in rows.values()
+             if r["role"] == "control" and r.get("delta") is not None and abs(r["delta"]) > threshold]
+    warnings = _context_warnings(base_doc, cur_doc)
+    if drift:
+        warnings.append("%d std control(s) moved past the threshold (median %+.1f%%); "
+                        "the machine may have drifted" % (len(drift), 100.0 * _median(drift)))
+    return {
+        "metric": metric,
+        "threshold": threshold,
+        "alpha": alpha,
+        "test": "one-sided Mann-Whitney U, Holm-corrected",
+        "status": "fail" if regressions else "pass",
+        "regressions": regressions,
+        "improvements": sorted(n for n, r in rows.items() if r["role"] == "ccmath" and r["verdict"] == "improvement"),
+        "warnings": warnings,
+        "benchmarks": rows,
+    }
+
+
+def _fmt_ns(v):
+    return "-" if v is None else "%.2f" % v
+
+
+def render_md(fn, profile, result, prov):
+    md = ["# asmlab bench regression: %s (%s)" % (fn, profile), ""]
+    md.append("- generated: %s (commit %s%s, baseline commit %s)" % (
+        prov["timestamp"], prov["git_commit"], ", dirty" if prov["git_dirty"] else "",
+        result.get("baseline_commit", "unknown")))
+    md.append("- test: %s on %s per repetition, alpha %g, threshold %.1f%%" % (
+        result["test"], result["metric"], result["alpha"], 100.0 * result["threshold"]))
+    md.append("- result: **%s** (%d regression(s), %d improvement(s))" % (
+        result["status"].upper(), len(result["regressions"]), len(result["improvements"])))
+    for w in result["warnings"]:
+        md.append("- warning: %s" % w)
+    md.append("")
+    md.append("| benchmark | role | base ns | now ns | delta | Holm p(slower) | cv base/now | verdict |")
+    md.append("| --- | --- | --- | --- | --- | --- | --- | --- |")
+    for name, r in sorted(result["benchmarks"].items()):
+        delta = "-" if r.get("delta") is None else "%+.2f%%" % (100.0 * r["delta"])
+        p = "-" if r.get("p_slower_holm") is None else "%.4f" % r["p_slower_holm"]
+        cv = "/".join("-" if v is None else "%.1f%%" % (100.0 * v)
+                      for v in (r.get("baseline_cv"), r.get("current_cv")))
+        verdict = r["verdict"].upper() if r["verdict"] == "regression" else r["verdict"]
+        md.append("| %s | %s | %s | %s | %s | %s | %s | %s |" % (
+            name, r["role"], _fmt_ns(r.get("baseline_median_ns")), _fmt_ns(r.get("current_median_ns")),
+            delta, p, cv if r.get("samples") else "-", verdict))
+    md.append("")
+    md.append("Medians and deltas are per benchmark iteration. bench alone is not a merge signal.")
+    return md
+
+
+def baseline_path(fn, profile):
+    return BASELINE_DIR / ("%s-%s.json" % (fn, profile))
+
+
+def _run_meta(fn, profile, doc, args):
+    build_dir = BUILD_DIR
+    if args.binary:
+        build_dir = next((d for d in Path(args.binary).resolve().parents
+                          if (d / "CMakeCache.txt").exists()), BUILD_DIR)
+    return prov_mod.collect_bench(fn, profile, build_dir, context=doc.get("context"))
+
+
+def cmd_record(args):
+    doc, err = load_run(args.fn, args.profile, args)
+    if err:
+        C.fail(err)
+    if not samples(doc, args.metric):
+        C.fail("no %s benchmarks in the run" % args.profile)
+    doc["asmlab"] = {"function": args.fn, "profile": args.profile,
+                     "run": _run_meta(args.fn, args.profile, doc, args)}
+    path = baseline_path(args.fn, args.profile)
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text(json.dumps(doc, indent=2) + "\n")
+    print("bench baseline for %s (%s) saved (%d benchmarks) -> %s" % (
+        args.fn, args.profile, len(samples(doc, args.metric)), path.relative_to(C.PROJECT_ROOT)))
+    return 0
+
+
+def cmd_compare(args):
+    base_path = baseline_path(args.fn, args.profile)
+    if not base_path.exists():
+        C.fail("no bench baseline for %s (%s); run: bench_regress.py record %s --profile %s" % (
+            args.fn, args.profile, args.fn, args.profile))
+    base_doc = json.loads(base_path.read_text())
+    cur_doc, err = load_run(args.fn, args.profile, args)
+    if err:
+        C.fail(err)
+
+    BENCHES_DIR.mkdir(parents=True, exist_ok=True)
+    (BENCHES_DIR / ("%s-%s.gbench.json" % (args.fn, args.profile))).write_text(
+        json.dumps(cur_doc, indent=2) + "\n")
+
+    result = compare_runs(base_doc, cur_doc, args.metric, args.threshold, args.alpha)
+    prov = _run_meta(args.fn, args.profile, cur_doc, args)
+    result.update(function=args.fn, profile=args.profile, run=prov,
+                  baseline_commit=base_doc.get("asmlab", {}).get("run", {}).get("git_commit", "unknown"))
+
+    REPORTS_DIR.mkdir(parents=True, exist_ok=True)
+    stem = "%s-%s.bench" % (args.fn, args.profile)
+    md_path = REPORTS_DIR / ("%s.md" % stem)
+    md_path.write_text("\n".join(render_md(args.fn, args.profile, result, prov)) + "\n")
+    (REPORTS_DIR / ("%s.json" % stem)).write_text(json.dumps(result, indent=2) + "\n")
+    prov_mod.write_run_json(REPORTS_DIR / ("%s.run.json" % stem), prov)
+
+    for name in result["regressions"]:
+        r = result["benchmarks"][name]
+        print("  REGRESSION %s: %+.2f%% (Holm p=%.4f)" % (name, 100.0 * r["delta"], r["p_slower_holm"]))
+    for w in result["warnings"]:
+        print("  warning: %s" % w)
+    print("bench %s (%s): %s -> %s" % (args.fn, args.profile, result["status"].upper(),
+                                       md_path.relative_to(C.PROJECT_ROOT)))
+    return 1 if result["status"] == "fail" else 0
+
+
+def main(argv=None):
+    import argparse
+    ap = argparse.ArgumentParser(description=__doc__,
+                                 formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    for name, func in (("record", cmd_record), ("compare", cmd_compare)):
+        p = sub.add_parser(name)
+        p.add_argument("fn", help="benchmarked function, e.g. pow")
+        p.add_argument("--profile", default="positive_finite_general",
+                       help="registry profile, or %s" % ", ".join(EXTRA_SUITES))
+        p.add_argument("--input", default="", help="use this Google Benchmark JSON instead of running")
+        p.add_argument("--binary", default="", help="run this ccm_benchmark_* binary instead of building")
+        p.add_argument("--repetitions", type=int, default=DEFAULT_REPETITIONS)
+        p.add_argument("--min-time", type=float, default=DEFAULT_MIN_TIME,
+                       help="seconds per repetition")
+        p.add_argument("--metric", default="cpu_time", choices=["cpu_time", "real_time"])
+        p.add_argument("bench_args", nargs="*", help="extra Google Benchmark flags")
+        if name == "compare":
+            p.add_argument("--threshold", type=float, default=DEFAULT_THRESHOLD,
+                           help="smallest median slowdown that fails (fraction)")
+            p.add_argument("--alpha", type=float, default=DEFAULT_ALPHA,
+                           help="significance level of the U test")
+        p.set_defaults(func=func)
+    args = ap.parse_args(argv)
+    return args.func(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -107,6 +107,43 @@ def collect(fn, flags, compiler, arches, extra=None):
     return prov
 
 
+def _cmake_cache_value(build_dir, key):
+    cache = build_dir / "CMakeCache.txt"
+    if not cache.exists():
+        return None
+    m = re.search(r"^%s:[A-Z]+=(.*)$" % re.escape(key), cache.read_text(), re.M)
+    return m.group(1) if m else None
+
+
+def collect_bench(fn, profile, build_dir, context=None):
+    """Build run metadata for a benchmark run from its CMake build and Google Benchmark context."""
+    git = _git_commit()
+    cxx = _cmake_cache_value(build_dir, "CMAKE_CXX_COMPILER")
+    compiler = {"executable": cxx or "unknown", "version": "unknown"}
+    if cxx and shutil.which(cxx):
+        res = C.run([cxx, "--version"])
+        if res.returncode == 0 and res.stdout:
+            compiler["version"] = res.stdout.strip().splitlines()[0]
+    context = context or {}
+    return {
+        "timestamp": datetime.datetime.now(timezone.utc).strftime("%Y-%m-%dT%H:%M:%SZ"),
+        "function": fn,
+        "profile": profile,
+        "git_commit": git["short"],
+        "git_commit_full": git["full"],
+        "git_dirty": _git_dirty(),
+        "compiler": compiler,
+        "build_type": _cmake_cache_value(build_dir, "CMAKE_BUILD_TYPE"),
+        "host_os": platform.system(),
+        "host_cpu": _host_cpu(),
+        "host_machine": platform.machine(),
+        "num_cpus": context.get("num_cpus"),
+        "mhz_per_cpu": context.get("mhz_per_cpu"),
+        "cpu_scaling_enabled": context.get("cpu_scaling_enabled"),
+        "load_avg": context.get("load_avg"),
+    }
+
+
 def write_run_json(path, prov):
     path.parent.mkdir(parents=True, exist_ok=True)
     path.write_text(json.dumps(prov, indent=2) + "\n")
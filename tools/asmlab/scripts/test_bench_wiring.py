@@ -19,6 +19,110 @@ BENCH_CPP = ASMLAB_DIR / "bench" / "powf_impl_bench.cpp"
 BENCH_CMAKE = ASMLAB_DIR / "bench" / "CMakeLists.txt"
 
 
+PATH_STATS_HPP = ASMLAB_DIR.parent.parent / "include" / "ccmath" / "internal" / "support" / "path_stats.hpp"
+
+
+class PathStatsLabelTest(unittest.TestCase):
+    def test_every_counter_has_a_label(self):
+        text = PATH_STATS_HPP.read_text()
+        block = text[text.index("path_names[path_count]"):]
+        names = re.findall(r'"([a-z0-9_]+\.[a-z0-9_]+)"', block[:block.index("};")])
+        labels = C.load_path_stat_labels()
+        categories = set(json.loads(C.PATH_CATEGORIES_PATH.read_text())["categories"])
+        self.assertTrue(names, "no counter names found in path_stats.hpp")
+        self.assertEqual(sorted(names), sorted(labels), "path_categories.json path_stats out of sync with path_stats.hpp")
+        for name, label in labels.items():
+            self.assertIn(label["category"], categories, name)
+
+    def test_parse_path_stats_labels_hits(self):
+        raw = "BM_pow_rt/0   12.0 ns   12.0 ns   1000 path.pow.double_double=750m path.pow.clamped=250m"
+        stats = C.parse_path_stats(raw)["BM_pow_rt/0"]
+        self.assertAlmostEqual(stats["paths"]["pow.double_double"]["per_op"], 0.75)
+        self.assertEqual(stats["paths"]["pow.clamped"]["category"], "special_case_path")
+        self.assertAlmostEqual(stats["slow_per_op"], 0.25)
+
+
+class PerfCounterParseTest(unittest.TestCase):
+    def test_si_suffixes_above_and_below_one(self):
+        raw = ("BM_pow_rt/0   12.0 ns   12.0 ns   1000 cycles_per_op=42.5 instructions_per_op=1.2k "
+               "ipc=2.83 branch_misses_per_op=12.5m l1d_misses_per_op=3u\n"
+               "BM_log_rt/0   5.0 ns   5.0 ns   1000 branch_misses_per_op=250n\n"
+               "not a benchmark cycles_per_op=1\n")
+        counters = C.parse_perf_counters(raw)
+        self.assertEqual(sorted(counters), ["BM_log_rt/0", "BM_pow_rt/0"])
+        pow_counters = counters["BM_pow_rt/0"]
+        self.assertAlmostEqual(pow_counters["cycles_per_op"], 42.5)
+        self.assertAlmostEqual(pow_counters["instructions_per_op"], 1200.0)
+        self.assertAlmostEqual(pow_counters["branch_misses_per_op"], 0.0125)
+        self.assertAlmostEqual(pow_counters["l1d_misses_per_op"], 3e-6)
+        self.assertAlmostEqual(counters["BM_log_rt/0"]["branch_misses_per_op"], 2.5e-7)
+
+
+def _gbench_doc(times_by_name):
+    return {"context": {"host_name": "ci", "num_cpus": 8, "mhz_per_cpu": 3000},
+            "benchmarks": [{"name": name, "run_name": name, "run_type": "iteration",
+                            "cpu_time": t, "real_time": t, "time_unit": "ns"}
+                           for name, times in times_by_name.items() for t in times]}
+
+
+class BenchRegressTest(unittest.TestCase):
+    CCM = "BM_power_pow_ccm_near_one_stream/64"
+    STD = "BM_power_pow_std_near_one_stream/64"
+    BASE = [100.0, 101.0, 99.5, 100.5, 100.2, 99.8, 100.7, 99.9, 100.1, 100.4]
+
+    def _compare(self, ccm, std=None):
+        import bench_regress as br
+        base = _gbench_doc({self.CCM: self.BASE, self.STD: self.BASE})
+        cur = _gbench_doc({self.CCM: ccm, self.STD: std or self.BASE})
+        return br.compare_runs(base, cur, "cpu_time", 0.05, 0.05)
+
+    def test_exact_u_test(self):
+        import bench_regress as br
+        lo, hi = [1.0, 2.0, 3.0, 4.0, 5.0], [6.0, 7.0, 8.0, 9.0, 10.0]
+        self.assertAlmostEqual(br.mann_whitney_greater(hi, lo), 1.0 / 252.0)
+        self.assertAlmostEqual(br.mann_whitney_greater(lo, hi), 1.0)
+
+    def test_holm_adjust(self):
+        import bench_regress as br
+        adj = br.holm_adjust({"a": 0.01, "b": 0.04, "c": 0.03})
+        self.assertAlmostEqual(adj["a"], 0.03)
+        self.assertAlmostEqual(adj["c"], 0.06)
+        self.assertAlmostEqual(adj["b"], 0.06)
+
+    def test_slowdown_past_threshold_fails(self):
+        res = self._compare([t * 1.10 for t in self.BASE])
+        self.assertEqual(res["status"], "fail")
+        self.assertEqual(res["regressions"], [self.CCM])
+
+    def test_significant_shift_inside_threshold_passes(self):
+        res = self._compare([t * 1.02 for t in self.BASE])
+        self.assertEqual(res["status"], "pass")
+        self.assertEqual(res["benchmarks"][self.CCM]["verdict"], "unchanged")
+
+    def test_std_control_never_fails_but_warns(self):
+        res = self._compare(self.BASE, std=[t * 1.20 for t in self.BASE])
+        self.assertEqual(res["status"], "pass")
+        self.assertEqual(res["benchmarks"][self.STD]["verdict"], "regression")
+        self.assertTrue(any("drifted" in w for w in res["warnings"]))
+
+    def test_too_few_repetitions_are_inconclusive(self):
+        import bench_regress as br
+        base = _gbench_doc({self.CCM: self.BASE[:3]})
+        cur = _gbench_doc({self.CCM: [t * 2.0 for t in self.BASE[:3]]})
+        res = br.compare_runs(base, cur, "cpu_time", 0.05, 0.05)
+        self.assertEqual(res["status"], "pass")
+        self.assertEqual(res["benchmarks"][self.CCM]["verdict"], "inconclusive")
+
+    def test_resolves_profile_stream_filter(self):
+        import bench_regress as br
+        info = br.resolve("pow", "near_one")
+        self.assertEqual(info["target"], "ccm_benchmark_pow")
+        self.assertEqual(info["cmake_opt"], "CCM_BENCH_POWER")
+        self.assertRegex(self.CCM, info["filter"])
+        self.assertNotRegex("BM_power_powf_ccm_near_one_stream/64", info["filter"])
+        self.assertIn("error", br.resolve("pow", "no_such_profile"))
+
+
 class PowfImplBenchWiringTest(unittest.TestCase):
     def test_powf_impl_wired_in_registry(self):
         data = json.loads(REGISTRY.read_text())
@@ -34,6 +34,15 @@ int main() {
 }
 """
 
+SIMD_AVX512F_PROBE = """#include <immintrin.h>
+int main() {
+  __m512 value = _mm512_set1_ps(1.0f);
+  __mmask16 mask = _mm512_cmp_ps_mask(value, _mm512_setzero_ps(), _CMP_GT_OQ);
+  value = _mm512_mask_add_ps(value, mask, value, value);
+  return static_cast<int>(_mm512_reduce_add_ps(value));
+}
+"""
+
 SIMD_SVML_PROBE = """#include <immintrin.h>
 int main() {
   __m128d value = _mm_sin_pd(_mm_set1_pd(1.0));
@@ -87,14 +96,9 @@ def meson_define_lines(options: list[dict[str, Any]]) -> list[str]:
     for option in options:
         meson_name = option["meson_option"]
         define = option["define"]
-        # Deterministic mode routes every call through the generic kernels, so the runtime SIMD
-        # path (a separate, non-generic evaluation) must stay off even if the user left it enabled.
-        condition = f"get_option('{meson_name}')"
-        if deterministic is not None and option["key"] == "runtime_simd":
-            condition += f" and not get_option('{deterministic}')"
         lines.extend(
             [
-                f"if {condition}",
+                f"if get_option('{meson_name}')",
                 f"  _ccmath_defines += '-D{define}'",
                 "endif",
             ]
@@ -120,8 +124,11 @@ def meson_runtime_probe_lines(options: list[dict[str, Any]]) -> list[str]:
     meson_name = runtime_option["meson_option"]
     deterministic = _deterministic_meson_option(options)
     guard = f"get_option('{meson_name}')"
+    # Deterministic builds keep runtime SIMD, whose kernels are bit identical to the generic ones,
+    # but never SVML, whose results are not.
+    svml_guard = guard
     if deterministic is not None:
-        guard += f" and not get_option('{deterministic}')"
+        svml_guard += f" and not get_option('{deterministic}')"
     return [
         "",
         "_ccmath_simd_fma_probe = '''",
@@ -132,11 +139,19 @@ def meson_runtime_probe_lines(options: list[dict[str, Any]]) -> list[str]:
         "  _ccmath_defines += '-DCCM_CONFIG_RT_SIMD_HAS_FMA'",
         "endif",
         "",
+        "_ccmath_simd_avx512f_probe = '''",
+        SIMD_AVX512F_PROBE.rstrip(),
+        "'''",
+        "",
+        f"if {guard} and cpp.compiles(_ccmath_simd_avx512f_probe, name : 'ccmath runtime SIMD AVX-512F intrinsics')",
+        "  _ccmath_defines += '-DCCM_CONFIG_RT_SIMD_HAS_AVX512F'",
+        "endif",
+        "",
         "_ccmath_simd_svml_probe = '''",
         SIMD_SVML_PROBE.rstrip(),
         "'''",
         "",
-        f"if {guard} and cpp.compiles(_ccmath_simd_svml_probe, name : 'ccmath runtime SIMD SVML intrinsics')",
+        f"if {svml_guard} and cpp.compiles(_ccmath_simd_svml_probe, name : 'ccmath runtime SIMD SVML intrinsics')",
         "  _ccmath_defines += '-DCCM_CONFIG_RT_SIMD_HAS_SVML'",
         "endif",
     ]
@@ -247,8 +262,6 @@ def premake_options(options: list[dict[str, Any]]) -> str:
 
 
 def premake_defines_block(options: list[dict[str, Any]]) -> str:
-    deterministic = next((opt for opt in options if opt["key"] == "deterministic"), None)
-    deterministic_trigger = premake_trigger_name(deterministic["meson_option"]) if deterministic is not None else None
     lines = [
         "function ccmath.defines()",
         "    local defs = {}",
@@ -258,11 +271,8 @@ def premake_defines_block(options: list[dict[str, Any]]) -> str:
         trigger = premake_trigger_name(option["meson_option"])
         default = "true" if option["meson_default"] else "false"
         define = option["define"]
-        # Deterministic mode forces the runtime SIMD path off; the generic kernels are the only
-        # cross-hardware-stable evaluation.
+        # Deterministic mode keeps runtime SIMD; the header drops SVML, the one non-identical path.
         condition = f'_ccmath_option_enabled("{trigger}", {default})'
-        if deterministic_trigger is not None and option["key"] == "runtime_simd":
-            condition += f' and not _ccmath_option_enabled("{deterministic_trigger}", false)'
         lines.extend(
             [
                 f"    if {condition} then",